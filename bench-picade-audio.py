@@ -0,0 +1,124 @@
+import argparse
+import glob
+import json
+import statistics
+import sys
+
+# Usage: bench-picade-audio.py [--baseline BASELINE] [--threshold PERCENT] [--advisory] RESULTS...
+# Prints benchmark results, or compares them against a baseline and exits
+# with an error if any case got slower by more than PERCENT (default 10) or
+# started allocating. With --advisory slower cases are only reported.
+#
+# RESULTS and BASELINE are the JSON Lines output of bench/ built for the PC,
+# or of the `_bnj` command, or "board" to fetch `_bnj` from a connected board.
+# Given several RESULTS, each case takes the median of them, so one run
+# disturbed by the rest of the machine doesn't count. Host results are in
+# nanoseconds per frame and board results in cycles per frame, so only
+# compare like with like. See "Benchmarks" in README.md.
+
+THRESHOLD_PERCENT = 10
+
+
+def read_results(source):
+    if source == "board":
+        # Only needed for the board, the host comparison runs without pyserial
+        import serial
+        picade = glob.glob("/dev/serial/by-id/usb-Pimoroni_Picade_USB_Audio_*")[0]
+        device = serial.Serial(picade, timeout=1)
+        device.write(b"multiverse:_bnj")
+        lines = [line.decode() for line in device.readlines()]
+        device.close()
+    else:
+        lines = open(source).readlines()
+
+    header = None
+    cases = {}
+    for line in lines:
+        if not line.strip():
+            continue
+        result = json.loads(line)
+        if "error" in result:
+            sys.exit(f"{source}: {result['error']}")
+        if "name" in result:
+            cases[result["name"]] = result
+        else:
+            header = result
+    if header is None:
+        sys.exit(f"{source}: no results")
+    return header, cases
+
+
+def cost(result):
+    return result["ns_per_frame"] if "ns_per_frame" in result else result["cycles_per_frame"]
+
+
+# The run with the median cost of each case, and the most any run allocated
+def median_results(sources):
+    runs = [read_results(source) for source in sources]
+    header = runs[0][0]
+    for other, _ in runs[1:]:
+        if other["platform"] != header["platform"]:
+            sys.exit(f"Can't take the median of {header['platform']} and {other['platform']} results")
+
+    cases = {}
+    for name in runs[0][1]:
+        results = [cases_run[name] for _, cases_run in runs if name in cases_run]
+        median = statistics.median_low(cost(result) for result in results)
+        result = dict(next(result for result in results if cost(result) == median))
+        if "allocations" in result:
+            result["allocations"] = max(r.get("allocations", 0) for r in results)
+        cases[name] = result
+    if len(runs) > 1:
+        header = dict(header, median_of=len(runs))
+    return header, cases
+
+
+parser = argparse.ArgumentParser()
+parser.add_argument("results", nargs="+")
+parser.add_argument("--baseline")
+parser.add_argument("--threshold", type=float, default=THRESHOLD_PERCENT)
+parser.add_argument("--advisory", action="store_true")
+args = parser.parse_args()
+
+results_header, results = median_results(args.results)
+
+if not args.baseline:
+    # As compact as bench/ prints them, so a regenerated baseline diffs cleanly
+    print(json.dumps(results_header, separators=(",", ":")))
+    for result in results.values():
+        print(json.dumps(result, separators=(",", ":")))
+    sys.exit(0)
+
+baseline_header, baseline = read_results(args.baseline)
+threshold = args.threshold
+
+if results_header["platform"] != baseline_header["platform"]:
+    sys.exit(f"Can't compare {results_header['platform']} results against a {baseline_header['platform']} baseline")
+
+unit = "ns/frame" if results_header["platform"] == "host" else "cycles/frame"
+failures = []
+slower = []
+print(f"{'case':<20} {'baseline':>10} {'now':>10} {'change':>8}  {unit}")
+for name, base in baseline.items():
+    if name not in results:
+        failures.append(f"{name} is missing")
+        continue
+    result = results[name]
+    change = (cost(result) / cost(base) - 1) * 100
+    print(f"{name:<20} {cost(base):>10.3f} {cost(result):>10.3f} {change:>+7.1f}%")
+    if change > threshold:
+        slower.append(f"{name} is {change:.1f}% slower")
+    if result.get("allocations", 0) > base.get("allocations", 0):
+        failures.append(f"{name} allocates {result['allocations']} times, was {base.get('allocations', 0)}")
+
+for name in results.keys() - baseline.keys():
+    print(f"{name:<20} {'':>10} {cost(results[name]):>10.3f}      new")
+
+if slower and args.advisory:
+    print("\n".join([f"Slower by over {threshold:g}%, not counted as a regression with --advisory:"] + slower))
+else:
+    failures += slower
+if failures:
+    print("\n".join([f"Regressions over {threshold:g}%:"] + failures))
+    sys.exit(1)
+print("No regressions" if slower else f"No regressions over {threshold:g}%")
@@ -0,0 +1,119 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <new>
+#include <chrono>
+#include <algorithm>
+
+#include "bench_cases.h"
+#include "i2s_audio.h"
+#include "dsp.h"
+
+// Times each of src/bench_cases.cpp on the PC and prints one JSON object per
+// line, a header first. bench-picade-audio.py compares the output against a
+// stored baseline, see "Benchmarks" in README.md.
+//
+// Usage: bench [BATCHES]
+
+// Batches are long enough to swamp the clock's resolution and the loop
+static const double MIN_BATCH_NS = 2e6;
+static const int WARMUP_RUNS = 100;
+
+// Allocations made while a case runs, the audio path should never allocate
+static uint32_t allocations = 0;
+
+extern "C" {
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size) {
+    allocations++;
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+    allocations++;
+    return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+    allocations++;
+    return __real_realloc(ptr, size);
+}
+}
+
+void *operator new(size_t size) {
+    allocations++;
+    if(void *ptr = __real_malloc(size ? size : 1)) return ptr;
+    throw std::bad_alloc();
+}
+
+void *operator new[](size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void *ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept {
+    free(ptr);
+}
+
+#if defined(__clang__)
+#define COMPILER "clang " __clang_version__
+#elif defined(__GNUC__)
+#define COMPILER "gcc " __VERSION__
+#else
+#define COMPILER "unknown"
+#endif
+
+int main(int argc, char *argv[]) {
+    int batches = argc > 1 ? atoi(argv[1]) : 20;
+
+    i2s_audio_init();
+    bench_cases_begin();
+
+    printf("{\"platform\":\"host\",\"compiler\":\"%s\",\"dsp\":\"%s\",\"frames\":%zu,\"batches\":%d}\n",
+        COMPILER, dsp_target_name(), BENCH_CASE_FRAMES, batches);
+
+    for(auto i = 0u; i < BENCH_CASE_COUNT; i++) {
+        const bench_case_t *c = &bench_cases[i];
+        c->setup();
+        for(auto r = 0; r < WARMUP_RUNS; r++) c->run();
+
+        auto time_batch = [c](int runs) {
+            auto start = std::chrono::steady_clock::now();
+            for(auto r = 0; r < runs; r++) c->run();
+            std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+            return elapsed.count();
+        };
+
+        uint32_t allocations_before = allocations;
+        int runs_per_batch = WARMUP_RUNS;
+        while(time_batch(runs_per_batch) < MIN_BATCH_NS) runs_per_batch *= 2;
+
+        // Best batch, the others lost time to the rest of the PC
+        double best = 1e30;
+        for(auto b = 0; b < batches; b++) {
+            best = std::min(best, time_batch(runs_per_batch));
+        }
+        uint32_t case_allocations = allocations - allocations_before;
+
+        double ns_per_frame = best / runs_per_batch / BENCH_CASE_FRAMES;
+        printf("{\"name\":\"%s\",\"runs\":%d,\"ns_per_frame\":%.3f,\"frames_per_second\":%.0f,\"allocations\":%u}\n",
+            c->name, batches * runs_per_batch, ns_per_frame, 1e9 / ns_per_frame, case_allocations);
+    }
+
+    bench_cases_end();
+    return 0;
+}
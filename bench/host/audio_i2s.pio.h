@@ -0,0 +1,7 @@
+#pragma once
+#include "hardware/pio.h"
+
+// pico_audio_i2s's PIO program, as pioasm would generate it
+static const pio_program_t audio_i2s_program = {};
+
+static inline void audio_i2s_program_init(PIO, uint, uint, uint, uint) {}
@@ -0,0 +1,6 @@
+#pragma once
+#include "pico/stdlib.h"
+
+enum clock_index { clk_sys = 5 };
+
+static inline uint32_t clock_get_hz(enum clock_index) { return 250000000; }
@@ -0,0 +1,49 @@
+#pragma once
+#include "pico/stdlib.h"
+
+// The DMA's registers, and its channels' setup kept in bench/host/host.cpp.
+// Nothing moves unless a test moves it, a channel is busy while it has
+// transfers left. See host_dma_read_addr() in host.h.
+typedef struct {
+    io_rw_32 read_addr;
+    io_rw_32 write_addr;
+    io_rw_32 transfer_count;
+    io_rw_32 ctrl_trig;
+    io_rw_32 al3_read_addr_trig;
+} dma_channel_hw_t;
+
+typedef struct {
+    dma_channel_hw_t ch[12];
+    io_rw_32 intf0;
+    io_rw_32 intf1;
+} dma_hw_t;
+
+extern dma_hw_t *dma_hw;
+
+enum dma_channel_transfer_size { DMA_SIZE_8 = 0, DMA_SIZE_16 = 1, DMA_SIZE_32 = 2 };
+
+typedef struct {
+    uint32_t ctrl;
+} dma_channel_config;
+
+int dma_claim_unused_channel(bool required);
+static inline void dma_channel_unclaim(uint) {}
+void dma_channel_abort(uint channel);
+static inline bool dma_channel_is_busy(uint channel) { return dma_hw->ch[channel].transfer_count != 0; }
+static inline dma_channel_hw_t *dma_channel_hw_addr(uint channel) { return &dma_hw->ch[channel]; }
+static inline void dma_irqn_set_channel_enabled(uint, uint, bool) {}
+static inline void dma_irqn_acknowledge_channel(uint, uint) {}
+
+static inline dma_channel_config dma_channel_get_default_config(uint) { return {}; }
+static inline void channel_config_set_transfer_data_size(dma_channel_config *, enum dma_channel_transfer_size) {}
+static inline void channel_config_set_read_increment(dma_channel_config *, bool) {}
+static inline void channel_config_set_write_increment(dma_channel_config *, bool) {}
+static inline void channel_config_set_dreq(dma_channel_config *, uint) {}
+static inline void channel_config_set_chain_to(dma_channel_config *, uint) {}
+static inline void dma_channel_set_config(uint, const dma_channel_config *, bool) {}
+
+void dma_channel_configure(uint channel, const dma_channel_config *config, volatile void *write_addr,
+    const volatile void *read_addr, uint transfer_count, bool trigger);
+// Starts the channel's transfers over. A channel set up to write another's
+// al3_read_addr_trig, as a control channel, starts that one from what it reads.
+void dma_channel_start(uint channel);
@@ -0,0 +1,120 @@
+#pragma once
+#include <stdint.h>
+
+// The RP2040 interpolator, emulated for the host builds. Covers the lane
+// shift/mask/sign, ADD_RAW, FORCE_MSB, CROSS_INPUT and interp1's clamp mode,
+// through the same names as the SDK's hardware/interp.h. Blend mode,
+// CROSS_RESULT and the POP side effects aren't emulated.
+
+#define SIO_INTERP0_CTRL_LANE0_SHIFT_LSB        0
+#define SIO_INTERP0_CTRL_LANE0_SHIFT_BITS       0x0000001fu
+#define SIO_INTERP0_CTRL_LANE0_MASK_LSB_LSB     5
+#define SIO_INTERP0_CTRL_LANE0_MASK_LSB_BITS    0x000003e0u
+#define SIO_INTERP0_CTRL_LANE0_MASK_MSB_LSB     10
+#define SIO_INTERP0_CTRL_LANE0_MASK_MSB_BITS    0x00007c00u
+#define SIO_INTERP0_CTRL_LANE0_SIGNED_BITS      0x00008000u
+#define SIO_INTERP0_CTRL_LANE0_CROSS_INPUT_BITS 0x00010000u
+#define SIO_INTERP0_CTRL_LANE0_ADD_RAW_BITS     0x00040000u
+#define SIO_INTERP0_CTRL_LANE0_FORCE_MSB_LSB    19
+#define SIO_INTERP0_CTRL_LANE0_FORCE_MSB_BITS   0x00180000u
+#define SIO_INTERP1_CTRL_LANE0_CLAMP_BITS       0x00400000u
+
+typedef struct {
+    uint32_t ctrl;
+} interp_config;
+
+struct interp_hw_t {
+    uint32_t accum[2];
+    uint32_t base[3];
+    uint32_t ctrl[2];
+    const bool clamp;   // Only interp1 has clamp mode
+
+    struct peek_t {
+        const interp_hw_t *hw;
+        uint32_t operator[](unsigned int lane) const { return hw->result(lane); }
+    } peek;
+
+    explicit interp_hw_t(bool has_clamp) : accum{}, base{}, ctrl{}, clamp(has_clamp), peek{this} {}
+
+    uint32_t masked(unsigned int lane) const {
+        uint32_t c = ctrl[lane];
+        uint32_t input = accum[(c & SIO_INTERP0_CTRL_LANE0_CROSS_INPUT_BITS) ? !lane : lane];
+        uint32_t shift = (c & SIO_INTERP0_CTRL_LANE0_SHIFT_BITS) >> SIO_INTERP0_CTRL_LANE0_SHIFT_LSB;
+        uint32_t lsb = (c & SIO_INTERP0_CTRL_LANE0_MASK_LSB_BITS) >> SIO_INTERP0_CTRL_LANE0_MASK_LSB_LSB;
+        uint32_t msb = (c & SIO_INTERP0_CTRL_LANE0_MASK_MSB_BITS) >> SIO_INTERP0_CTRL_LANE0_MASK_MSB_LSB;
+        uint32_t mask = (msb >= lsb) ? ((uint32_t)(((uint64_t)2 << msb) - 1) & ~((1u << lsb) - 1)) : 0;
+        uint32_t value = (input >> shift) & mask;
+        // Sign extended from the top bit of the mask
+        if((c & SIO_INTERP0_CTRL_LANE0_SIGNED_BITS) && msb < 31 && (value & (1u << msb))) {
+            value |= ~(uint32_t)(((uint64_t)2 << msb) - 1);
+        }
+        return value;
+    }
+
+    uint32_t result(unsigned int lane) const {
+        uint32_t c = ctrl[lane & 1];
+        uint32_t value;
+        if(lane == 2) {
+            // FULL is always base2 plus both masked lanes
+            value = base[2] + masked(0) + masked(1);
+        } else if(lane == 0 && clamp && (c & SIO_INTERP1_CTRL_LANE0_CLAMP_BITS)) {
+            value = masked(0);
+            if(c & SIO_INTERP0_CTRL_LANE0_SIGNED_BITS) {
+                if((int32_t)value < (int32_t)base[0]) value = base[0];
+                if((int32_t)value > (int32_t)base[1]) value = base[1];
+            } else {
+                if(value < base[0]) value = base[0];
+                if(value > base[1]) value = base[1];
+            }
+        } else {
+            value = base[lane] + ((c & SIO_INTERP0_CTRL_LANE0_ADD_RAW_BITS) ? accum[lane] : masked(lane));
+        }
+        if(lane < 2) {
+            value |= ((c & SIO_INTERP0_CTRL_LANE0_FORCE_MSB_BITS) >> SIO_INTERP0_CTRL_LANE0_FORCE_MSB_LSB) << 28;
+        }
+        return value;
+    }
+};
+
+static interp_hw_t interp0_host(false);
+static interp_hw_t interp1_host(true);
+#define interp0 (&interp0_host)
+#define interp1 (&interp1_host)
+
+static inline interp_config interp_default_config() {
+    interp_config c = {31u << SIO_INTERP0_CTRL_LANE0_MASK_MSB_LSB};
+    return c;
+}
+
+static inline void interp_config_set_shift(interp_config *c, unsigned int shift) {
+    c->ctrl = (c->ctrl & ~SIO_INTERP0_CTRL_LANE0_SHIFT_BITS) | (shift << SIO_INTERP0_CTRL_LANE0_SHIFT_LSB);
+}
+
+static inline void interp_config_set_mask(interp_config *c, unsigned int mask_lsb, unsigned int mask_msb) {
+    c->ctrl = (c->ctrl & ~(SIO_INTERP0_CTRL_LANE0_MASK_LSB_BITS | SIO_INTERP0_CTRL_LANE0_MASK_MSB_BITS)) |
+              (mask_lsb << SIO_INTERP0_CTRL_LANE0_MASK_LSB_LSB) | (mask_msb << SIO_INTERP0_CTRL_LANE0_MASK_MSB_LSB);
+}
+
+static inline void interp_config_set_signed(interp_config *c, bool _signed) {
+    c->ctrl = (c->ctrl & ~SIO_INTERP0_CTRL_LANE0_SIGNED_BITS) | (_signed ? SIO_INTERP0_CTRL_LANE0_SIGNED_BITS : 0);
+}
+
+static inline void interp_config_set_cross_input(interp_config *c, bool cross_input) {
+    c->ctrl = (c->ctrl & ~SIO_INTERP0_CTRL_LANE0_CROSS_INPUT_BITS) | (cross_input ? SIO_INTERP0_CTRL_LANE0_CROSS_INPUT_BITS : 0);
+}
+
+static inline void interp_config_set_add_raw(interp_config *c, bool add_raw) {
+    c->ctrl = (c->ctrl & ~SIO_INTERP0_CTRL_LANE0_ADD_RAW_BITS) | (add_raw ? SIO_INTERP0_CTRL_LANE0_ADD_RAW_BITS : 0);
+}
+
+static inline void interp_config_set_force_bits(interp_config *c, unsigned int bits) {
+    c->ctrl = (c->ctrl & ~SIO_INTERP0_CTRL_LANE0_FORCE_MSB_BITS) | (bits << SIO_INTERP0_CTRL_LANE0_FORCE_MSB_LSB);
+}
+
+static inline void interp_config_set_clamp(interp_config *c, bool clamp) {
+    c->ctrl = (c->ctrl & ~SIO_INTERP1_CTRL_LANE0_CLAMP_BITS) | (clamp ? SIO_INTERP1_CTRL_LANE0_CLAMP_BITS : 0);
+}
+
+static inline void interp_set_config(interp_hw_t *interp, unsigned int lane, interp_config *config) {
+    interp->ctrl[lane] = config->ctrl;
+}
@@ -0,0 +1,9 @@
+#pragma once
+#include "pico/stdlib.h"
+
+#define DMA_IRQ_0 11
+#define PICO_SHARED_IRQ_HANDLER_LOWEST_ORDER_PRIORITY 0
+#define PICO_SHARED_IRQ_HANDLER_HIGHEST_ORDER_PRIORITY 0xff
+
+typedef void (*irq_handler_t)(void);
+static inline void irq_add_shared_handler(uint, irq_handler_t, uint8_t) {}
@@ -0,0 +1,33 @@
+#pragma once
+#include "pico/stdlib.h"
+
+typedef struct {
+    io_rw_32 execctrl;
+} pio_sm_hw_t;
+
+typedef struct {
+    io_rw_32 txf[4];
+    pio_sm_hw_t sm[4];
+} pio_hw_t;
+
+typedef pio_hw_t *PIO;
+
+typedef struct {
+    const uint16_t *instructions;
+    uint8_t length;
+    int8_t origin;
+} pio_program_t;
+
+#define PIO_SM0_EXECCTRL_WRAP_TOP_BITS 0x0001f000u
+#define PIO_SM0_EXECCTRL_WRAP_TOP_LSB 12
+
+PIO pio_get_instance(uint instance);
+static inline void pio_sm_claim(PIO, uint) {}
+static inline uint pio_add_program(PIO, const pio_program_t *) { return 0; }
+static inline uint pio_get_dreq(PIO, uint, bool) { return 0; }
+static inline void pio_sm_set_clkdiv_int_frac(PIO, uint, uint16_t, uint8_t) {}
+static inline void pio_sm_set_enabled(PIO, uint, bool) {}
+static inline void pio_sm_clear_fifos(PIO, uint) {}
+static inline void pio_sm_restart(PIO, uint) {}
+static inline void pio_sm_exec(PIO, uint, uint) {}
+static inline uint pio_encode_jmp(uint address) { return address; }
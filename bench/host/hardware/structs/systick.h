@@ -0,0 +1,12 @@
+#pragma once
+#include <stdint.h>
+
+// Never counts, the host benchmark times with the system clock instead
+typedef struct {
+    volatile uint32_t csr;
+    volatile uint32_t rvr;
+    volatile uint32_t cvr;
+    volatile uint32_t calib;
+} systick_hw_t;
+
+extern systick_hw_t *systick_hw;
@@ -0,0 +1,159 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <chrono>
+#include <algorithm>
+
+#include "pico/stdlib.h"
+#include "pico/audio.h"
+#include "hardware/dma.h"
+#include "hardware/pio.h"
+#include "hardware/structs/systick.h"
+#include "host.h"
+
+// Definitions behind the headers in bench/host. Buffers come from fixed
+// arrays, so any allocation the benchmark counts is the firmware's own.
+
+static systick_hw_t systick;
+systick_hw_t *systick_hw = &systick;
+
+static dma_hw_t dma;
+dma_hw_t *dma_hw = &dma;
+
+static struct {
+    volatile void *write_addr;
+    const volatile void *read_addr;
+    uint transfer_count;
+} dma_setup[count_of(dma.ch)];
+static uint dma_claimed = 0;
+
+static pio_hw_t pio;
+
+PIO pio_get_instance(uint) {
+    return &pio;
+}
+
+void panic(const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+    vfprintf(stderr, format, args);
+    va_end(args);
+    abort();
+}
+
+int dma_claim_unused_channel(bool) {
+    if(dma_claimed == count_of(dma.ch)) panic("out of host DMA channels\n");
+    return dma_claimed++;
+}
+
+void dma_channel_configure(uint channel, const dma_channel_config *, volatile void *write_addr,
+    const volatile void *read_addr, uint transfer_count, bool trigger) {
+    dma_setup[channel] = {write_addr, read_addr, transfer_count};
+    if(trigger) dma_channel_start(channel);
+}
+
+void dma_channel_start(uint channel) {
+    for(auto target = 0u; target < count_of(dma.ch); target++) {
+        if(dma_setup[channel].write_addr == &dma.ch[target].al3_read_addr_trig) {
+            dma_setup[target].read_addr = *(const volatile void *const *)dma_setup[channel].read_addr;
+            dma.ch[target].transfer_count = dma_setup[target].transfer_count;
+            return;
+        }
+    }
+    dma.ch[channel].transfer_count = dma_setup[channel].transfer_count;
+}
+
+void dma_channel_abort(uint channel) {
+    dma.ch[channel].transfer_count = 0;
+}
+
+const volatile void *host_dma_read_addr(uint channel) {
+    return dma_setup[channel].read_addr;
+}
+
+static bool time_set = false;
+static uint64_t time_now_us;
+
+void host_set_time_us(uint64_t us) {
+    time_set = true;
+    time_now_us = us;
+}
+
+uint64_t time_us_64() {
+    if(time_set) return time_now_us;
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::microseconds>(now).count();
+}
+
+uint32_t time_us_32() {
+    return (uint32_t)time_us_64();
+}
+
+static const size_t MAX_BUFFERS = 8;
+static audio_buffer_pool_t pools[2];
+static size_t pool_count = 0;
+static audio_buffer_t buffers[MAX_BUFFERS];
+static mem_buffer_t memories[MAX_BUFFERS];
+static size_t buffer_count = 0;
+static size_t memory_count = 0;
+
+audio_buffer_pool_t *audio_new_producer_pool(audio_buffer_format_t *, int buffer_count, int) {
+    if(buffer_count || pool_count == count_of(pools)) panic("host pools start empty\n");
+    return &pools[pool_count++];
+}
+
+mem_buffer_t *pico_buffer_wrap(uint8_t *bytes, uint size) {
+    if(memory_count == MAX_BUFFERS) panic("out of host buffers\n");
+    mem_buffer_t *memory = &memories[memory_count++];
+    memory->bytes = bytes;
+    memory->size = size;
+    return memory;
+}
+
+audio_buffer_t *audio_new_wrapping_buffer(audio_buffer_format_t *format, mem_buffer_t *memory) {
+    if(buffer_count == MAX_BUFFERS) panic("out of host buffers\n");
+    audio_buffer_t *buffer = &buffers[buffer_count++];
+    buffer->buffer = memory;
+    buffer->format = format;
+    buffer->sample_count = 0;
+    buffer->max_sample_count = memory->size / format->sample_stride;
+    buffer->next = nullptr;
+    return buffer;
+}
+
+void queue_free_audio_buffer(audio_buffer_pool_t *pool, audio_buffer_t *buffer) {
+    buffer->next = pool->free_list;
+    pool->free_list = buffer;
+}
+
+audio_buffer_t *take_audio_buffer(audio_buffer_pool_t *pool, bool) {
+    audio_buffer_t *buffer = pool->free_list;
+    if(buffer) pool->free_list = buffer->next;
+    return buffer;
+}
+
+static int16_t *capture = nullptr;
+static size_t capture_frames = 0;
+static size_t captured = 0;
+
+void host_capture(int16_t *samples, size_t frames) {
+    capture = samples;
+    capture_frames = frames;
+    captured = 0;
+}
+
+size_t host_captured() {
+    return captured;
+}
+
+// Played the moment it's given, and kept if a test is capturing
+void give_audio_buffer(audio_buffer_pool_t *pool, audio_buffer_t *buffer) {
+    pool->given_frames += buffer->sample_count;
+    size_t frames = std::min<size_t>(buffer->sample_count, capture_frames - captured);
+    if(capture && frames) {
+        memcpy(capture + captured * 2, buffer->buffer->bytes, frames * sizeof(int16_t) * 2);
+        captured += frames;
+    }
+    queue_free_audio_buffer(pool, buffer);
+}
@@ -0,0 +1,16 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// For the host tests, what the audio path gives to I2S, as stereo frames.
+// Capturing starts over with each call, and stops once samples is full.
+void host_capture(int16_t *samples, size_t frames);
+size_t host_captured();
+
+// What a DMA channel was last set up to read, for a test playing the transfers
+// itself by counting down its transfer_count
+const volatile void *host_dma_read_addr(unsigned int channel);
+
+// Stops the clock at us, from then on time_us_32() and time_us_64() only move
+// when a test sets them
+void host_set_time_us(uint64_t us);
@@ -0,0 +1,46 @@
+#pragma once
+#include "pico/stdlib.h"
+
+// pico_audio's buffer pools, with a consumer that takes every buffer as soon
+// as it's given, so the benchmark times only the producer side.
+
+typedef struct {
+    uint8_t *bytes;
+    uint32_t size;
+} mem_buffer_t;
+
+enum { AUDIO_BUFFER_FORMAT_PCM_S16 = 1 };
+
+typedef struct {
+    uint32_t sample_freq;
+    uint16_t format;
+    uint16_t channel_count;
+} audio_format_t;
+
+typedef struct {
+    const audio_format_t *format;
+    uint16_t sample_stride;
+} audio_buffer_format_t;
+
+typedef struct audio_buffer {
+    mem_buffer_t *buffer;
+    const audio_buffer_format_t *format;
+    uint32_t sample_count;
+    uint32_t max_sample_count;
+    struct audio_buffer *next;
+} audio_buffer_t;
+
+typedef struct audio_buffer_pool {
+    audio_buffer_t *free_list;
+    audio_buffer_t *prepared_list;
+    uint32_t given_frames;
+} audio_buffer_pool_t;
+
+typedef struct audio_connection audio_connection_t;
+
+audio_buffer_pool_t *audio_new_producer_pool(audio_buffer_format_t *format, int buffer_count, int buffer_sample_count);
+audio_buffer_t *audio_new_wrapping_buffer(audio_buffer_format_t *format, mem_buffer_t *buffer);
+mem_buffer_t *pico_buffer_wrap(uint8_t *bytes, uint size);
+void queue_free_audio_buffer(audio_buffer_pool_t *pool, audio_buffer_t *buffer);
+audio_buffer_t *take_audio_buffer(audio_buffer_pool_t *pool, bool block);
+void give_audio_buffer(audio_buffer_pool_t *pool, audio_buffer_t *buffer);
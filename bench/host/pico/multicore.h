@@ -0,0 +1,6 @@
+#pragma once
+#include "pico/stdlib.h"
+
+// There's no second core, whatever would run on it is called directly
+static inline void multicore_launch_core1(void (*)()) {}
+static inline void multicore_lockout_victim_init() {}
@@ -0,0 +1,39 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <assert.h>
+
+// Just enough of the Pico SDK to build the audio path on a PC, see bench/
+
+typedef unsigned int uint;
+typedef volatile uint32_t io_rw_32;
+
+#define __unused __attribute__((unused))
+#define __isr
+#define __not_in_flash_func(name) name
+#define count_of(a) (sizeof(a) / sizeof((a)[0]))
+
+enum gpio_function { GPIO_FUNC_SIO = 5 };
+#define GPIO_OUT 1
+
+static inline void gpio_init(uint) {}
+static inline void gpio_set_function(uint, enum gpio_function) {}
+static inline void gpio_set_dir(uint, bool) {}
+static inline void gpio_put(uint, bool) {}
+
+static inline void hw_set_bits(io_rw_32 *addr, uint32_t mask) { *addr |= mask; }
+static inline void hw_clear_bits(io_rw_32 *addr, uint32_t mask) { *addr &= ~mask; }
+
+void panic(const char *format, ...);
+uint32_t time_us_32();
+uint64_t time_us_64();
+
+// Time passes, but nothing sleeps
+typedef uint64_t absolute_time_t;
+static inline absolute_time_t get_absolute_time() { return time_us_64(); }
+static inline absolute_time_t delayed_by_ms(absolute_time_t t, uint32_t ms) { return t + ms * 1000ull; }
+static inline absolute_time_t make_timeout_time_ms(uint32_t ms) { return delayed_by_ms(get_absolute_time(), ms); }
+static inline bool time_reached(absolute_time_t t) { return time_us_64() >= t; }
+static inline void sleep_until(absolute_time_t) {}
+
+#include "hardware/sync.h"
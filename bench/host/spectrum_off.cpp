@@ -0,0 +1,7 @@
+#include "pico/stdlib.h"
+#include "spectrum.h"
+
+// The analyser is on core 1, and only copies anything while streaming to the
+// host. Left out of everything but its own test.
+void spectrum_push(const int16_t *, size_t) {
+}
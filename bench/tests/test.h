@@ -0,0 +1,36 @@
+#pragma once
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+
+// Just enough to check results in the host tests. A failed CHECK prints where
+// and why and carries on, so one run shows every failure.
+
+static int test_failures = 0;
+
+#define CHECK(condition, ...) do { \
+    if(!(condition)) { \
+        test_failures++; \
+        printf("FAIL %s:%d: ", __FILE__, __LINE__); \
+        printf(__VA_ARGS__); \
+        printf("\n"); \
+    } \
+} while(0)
+
+static inline int test_result() {
+    if(test_failures) printf("%d checks failed\n", test_failures);
+    return test_failures ? 1 : 0;
+}
+
+static inline double db(double ratio) {
+    return 20.0 * log10(ratio);
+}
+
+// Repeatable from one run to the next, the top half of a 64-bit LCG as the
+// low bits of an LCG are far from random
+static uint64_t test_seed = 1;
+
+static inline uint32_t random_u32() {
+    test_seed = test_seed * 6364136223846793005ull + 1442695040888963407ull;
+    return (uint32_t)(test_seed >> 32);
+}
@@ -0,0 +1,97 @@
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+
+#include "pico/stdlib.h"
+#include "test.h"
+#include "host.h"
+#include "i2s_audio.h"
+#include "mixer.h"
+#include "dsp.h"
+
+// The 16 and 24-bit kernels, with and without system sounds mixed in, against
+// the conversion written out sample by sample: the top 16 bits times volume /
+// 256, plus the system sound at the same volume, saturated, with left and
+// right swapped. Built again as test_convert_interp with AUDIO_INTERP_KERNEL,
+// and as test_convert_simd with DSP_TARGET=DSP_SIMD, where 16-bit packets go
+// through dsp_convert_s16(), so every kernel is held to the same output.
+
+static const size_t FRAMES = 48;
+static const uint8_t MIX_GAIN = 255;
+
+// Full scale and its neighbours a quarter of the time, where saturation matters
+static int32_t random_sample() {
+    static const int32_t edges[] = {INT16_MIN, INT16_MIN + 1, -1, 0, 1, INT16_MAX - 1, INT16_MAX};
+    uint32_t r = random_u32();
+    return r >> 30 ? (int16_t)(r >> 8) : edges[(r >> 8) % count_of(edges)];
+}
+
+static uint32_t checked = 0;
+static uint32_t mismatches = 0;
+
+// `in` holds FRAMES frames of samples as 16-bit values, `low` the bits below
+// them for 24-bit, `mix` the system sound or nullptr
+static void check(uint8_t bit_depth, const int16_t *in, const uint16_t *low, const int16_t *mix, uint8_t volume, size_t offset) {
+    // One spare word in front, to give 16-bit input unaligned
+    alignas(4) int16_t s16[FRAMES * 2 + 2];
+    int32_t s24[FRAMES * 2];
+    for(auto i = 0u; i < FRAMES * 2; i++) {
+        s16[i + offset] = in[i];
+        s24[i] = (int32_t)((uint32_t)(uint16_t)in[i] << 16 | low[i]);
+    }
+
+    int16_t mixed[FRAMES * 2];
+    mixer_system_set_streaming(mix != nullptr);
+    if(mix) {
+        mixer_system_write(mix, FRAMES, MIX_GAIN);
+        // As queued by the mixer
+        for(auto i = 0u; i < FRAMES * 2; i++) mixed[i] = (mix[i] * MIX_GAIN) >> 8;
+    }
+
+    int16_t out[FRAMES * 2];
+    host_capture(out, FRAMES);
+    if(bit_depth == 16) {
+        i2s_audio_give_buffer(s16 + offset, FRAMES * 2 * sizeof(int16_t), 16, volume);
+    } else {
+        i2s_audio_give_buffer(s24, sizeof(s24), 24, volume);
+    }
+    CHECK(host_captured() == FRAMES, "%zu frames out, expected %zu", host_captured(), FRAMES);
+
+    for(auto i = 0u; i < FRAMES * 2; i++) {
+        int32_t expected = (in[i] * volume) >> 8;
+        if(mix) expected = std::clamp(expected + ((mixed[i] * volume) >> 8), (int32_t)INT16_MIN, (int32_t)INT16_MAX);
+        int16_t got = out[i ^ 1];
+        checked++;
+        if(got != expected && mismatches++ < 10) {
+            CHECK(false, "s%u%s%s sample %u (%d) at volume %u: %d, expected %d", bit_depth, mix ? " mixing" : "",
+                offset ? " unaligned" : "", i, in[i], volume, got, expected);
+        }
+    }
+}
+
+int main() {
+    i2s_audio_init();
+    printf("%s kernel, %s dsp\n", AUDIO_INTERP_KERNEL ? "interpolator" : "software", dsp_target_name());
+
+    int16_t in[FRAMES * 2], mix[FRAMES * 2];
+    uint16_t low[FRAMES * 2];
+    for(auto volume = 0u; volume < 256; volume++) {
+        for(auto pass = 0u; pass < 16; pass++) {
+            for(auto i = 0u; i < FRAMES * 2; i++) {
+                in[i] = random_sample();
+                mix[i] = random_sample();
+                low[i] = random_u32() >> 16;
+            }
+            check(16, in, low, nullptr, volume, 0);
+            check(16, in, low, mix, volume, 0);
+            check(16, in, low, nullptr, volume, 1);
+            check(16, in, low, mix, volume, 1);
+            check(24, in, low, nullptr, volume, 0);
+            check(24, in, low, mix, volume, 0);
+        }
+    }
+
+    printf("%u samples checked, %u mismatches\n", checked, mismatches);
+    CHECK(mismatches == 0, "%u mismatches", mismatches);
+    return test_result();
+}
@@ -0,0 +1,114 @@
+#include <stdint.h>
+#include <algorithm>
+
+#include "pico/stdlib.h"
+#include "test.h"
+#include "dsp.h"
+
+// The kernels in src/dsp.cpp against the same arithmetic written out sample
+// by sample. Built again as test_dsp_simd with DSP_TARGET=DSP_SIMD, which runs
+// the M33 kernels on the emulated intrinsics, so scalar and SIMD are held to
+// the same output bit for bit.
+
+static const size_t FRAMES = 64;
+static const uint32_t PASSES = 4096;
+
+// Full scale and its neighbours a quarter of the time, where saturation matters
+static int16_t random_sample() {
+    static const int16_t edges[] = {INT16_MIN, INT16_MIN + 1, -1, 0, 1, INT16_MAX - 1, INT16_MAX};
+    uint32_t r = random_u32();
+    return r >> 30 ? (int16_t)(r >> 8) : edges[(r >> 8) % count_of(edges)];
+}
+
+static int32_t saturate16(int64_t value) {
+    return (int32_t)std::clamp(value, (int64_t)INT16_MIN, (int64_t)INT16_MAX);
+}
+
+static uint32_t checked = 0;
+static uint32_t mismatches = 0;
+
+static void expect(const char *kernel, uint32_t i, int32_t got, int32_t expected) {
+    checked++;
+    if(got != expected && mismatches++ < 10) {
+        CHECK(false, "%s sample %u: %d, expected %d", kernel, i, got, expected);
+    }
+}
+
+// Aligned and unaligned, with and without a system sound, at every volume
+static void test_convert() {
+    int16_t in[FRAMES * 2 + 1], mix[FRAMES * 2 + 1], out[FRAMES * 2 + 1];
+    for(auto volume = 0u; volume < 256; volume++) {
+        for(auto pass = 0u; pass < PASSES / 256; pass++) {
+            for(auto i = 0u; i < count_of(in); i++) {
+                in[i] = random_sample();
+                mix[i] = random_sample();
+            }
+            for(auto offset = 0u; offset < 2; offset++) {
+                for(auto mixing = 0u; mixing < 2; mixing++) {
+                    const int16_t *sound = mixing ? mix + offset : nullptr;
+                    dsp_convert_s16(out + offset, in + offset, FRAMES, volume, sound);
+                    for(auto i = 0u; i < FRAMES * 2; i++) {
+                        int32_t expected = (in[offset + i] * (int32_t)volume) >> 8;
+                        if(sound) expected = saturate16(expected + ((sound[i] * (int32_t)volume) >> 8));
+                        expect(mixing ? "convert mix" : "convert", i, out[offset + (i ^ 1)], expected);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Odd counts too, for the sample the SIMD kernel leaves over
+static void test_gain() {
+    static const int16_t gains[] = {0, 1, -1, 1 << DSP_GAIN_BITS, 3 << (DSP_GAIN_BITS - 1), INT16_MAX, INT16_MIN};
+    int16_t samples[FRAMES * 2], before[FRAMES * 2];
+    for(auto pass = 0u; pass < PASSES; pass++) {
+        int16_t gain = pass < count_of(gains) ? gains[pass] : (int16_t)random_u32();
+        size_t count = FRAMES * 2 - (pass & 1);
+        for(auto i = 0u; i < count; i++) before[i] = samples[i] = random_sample();
+        dsp_gain(samples, count, gain);
+        for(auto i = 0u; i < count; i++) {
+            int64_t product = (int64_t)before[i] * gain;
+            expect("gain", i, samples[i], saturate16((product + (1 << (DSP_GAIN_BITS - 1))) >> DSP_GAIN_BITS));
+        }
+    }
+}
+
+// Direct form 1, the accumulator wrapping at 32 bits, each channel carried
+// over from one block to the next
+static void test_biquad() {
+    for(auto pass = 0u; pass < PASSES / 16; pass++) {
+        dsp_biquad_t c = {64, 128, 64, -29743, 13615};
+        if(pass) {
+            c = {(int16_t)random_u32(), (int16_t)random_u32(), (int16_t)random_u32(), (int16_t)random_u32(), (int16_t)random_u32()};
+        }
+        dsp_biquad_state_t state = {};
+        int32_t x1[2] = {}, x2[2] = {}, y1[2] = {}, y2[2] = {};
+        for(auto block = 0u; block < 16; block++) {
+            int16_t samples[FRAMES * 2], before[FRAMES * 2];
+            for(auto i = 0u; i < FRAMES * 2; i++) before[i] = samples[i] = random_sample();
+            dsp_biquad(samples, FRAMES, &c, &state);
+            for(auto i = 0u; i < FRAMES * 2; i++) {
+                auto ch = i & 1;
+                int64_t acc = (int64_t)c.b0 * before[i] + (1 << (DSP_BIQUAD_BITS - 1)) + (int64_t)c.b1 * x1[ch] + (int64_t)c.b2 * x2[ch]
+                            - (int64_t)c.a1 * y1[ch] - (int64_t)c.a2 * y2[ch];
+                int32_t y0 = saturate16((int32_t)(uint32_t)acc >> DSP_BIQUAD_BITS);
+                expect("biquad", i, samples[i], y0);
+                x2[ch] = x1[ch]; x1[ch] = before[i];
+                y2[ch] = y1[ch]; y1[ch] = y0;
+            }
+        }
+    }
+}
+
+int main() {
+    printf("%s kernels\n", dsp_target_name());
+
+    test_convert();
+    test_gain();
+    test_biquad();
+
+    printf("%u samples checked, %u mismatches\n", checked, mismatches);
+    CHECK(mismatches == 0, "%u mismatches", mismatches);
+    return test_result();
+}
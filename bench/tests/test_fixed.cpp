@@ -0,0 +1,160 @@
+#include <stdint.h>
+#include <algorithm>
+
+#include "test.h"
+#include "pico/stdlib.h"
+#include "fixed.h"
+
+// Every fixed point operation against the same arithmetic done the long way
+// in 64 bits: round half up, then saturate. The Q15 operations are checked for
+// every pair of inputs, the Q31 ones for the corners and tens of millions of
+// random operands. Built again as test_fixed_m0 with
+// FIXED_NO_LONG_MULTIPLY, to check the RP2040's partial product multiplies.
+
+static const uint32_t RANDOM_Q31 = 1 << 25;
+
+static int64_t saturate(int64_t value, int64_t min, int64_t max) {
+    return value < min ? min : value > max ? max : value;
+}
+
+// Shifts of a 64-bit product, rounded half up
+static int64_t round_shift(int64_t value, int shift) {
+    return shift == 0 ? value : (value + ((int64_t)1 << (shift - 1))) >> shift;
+}
+
+static uint32_t mismatches = 0;
+
+#define EXPECT(name, got, expected, a, b) do { \
+    if((int64_t)(got) != (int64_t)(expected) && mismatches++ < 10) { \
+        CHECK(false, "%s(%lld, %lld) = %lld, expected %lld", name, \
+            (long long)(a), (long long)(b), (long long)(got), (long long)(expected)); \
+    } \
+} while(0)
+
+static void check_q15(int32_t a, int32_t b) {
+    q15_t qa = q15_t::from_raw(a), qb = q15_t::from_raw(b);
+    EXPECT("q15 add", fixed_add(qa, qb).raw, saturate(a + b, INT16_MIN, INT16_MAX), a, b);
+    EXPECT("q15 sub", fixed_sub(qa, qb).raw, saturate(a - b, INT16_MIN, INT16_MAX), a, b);
+    EXPECT("q15 mul", fixed_mul(qa, qb).raw, saturate(round_shift(a * b, 15), INT16_MIN, INT16_MAX), a, b);
+}
+
+// Counted without branching so the compiler can vectorise the four billion
+// pairs, then any row with a mismatch is gone over again to report it
+static void test_q15() {
+    for(int32_t a = INT16_MIN; a <= INT16_MAX; a++) {
+        q15_t qa = q15_t::from_raw(a);
+        uint32_t bad = 0;
+        for(int32_t b = INT16_MIN; b <= INT16_MAX; b++) {
+            q15_t qb = q15_t::from_raw(b);
+            bad += fixed_add(qa, qb).raw != std::clamp(a + b, INT16_MIN, INT16_MAX);
+            bad += fixed_sub(qa, qb).raw != std::clamp(a - b, INT16_MIN, INT16_MAX);
+            bad += fixed_mul(qa, qb).raw != std::clamp((a * b + (1 << 14)) >> 15, INT16_MIN, INT16_MAX);
+        }
+        if(bad) {
+            for(int32_t b = INT16_MIN; b <= INT16_MAX; b++) check_q15(a, b);
+        }
+    }
+}
+
+// Every top half, with the low halves either side of rounding up and a few
+// random ones
+static void test_conversions() {
+    static const int32_t lows[] = {0, 1, 0x7ffe, 0x7fff, 0x8000, 0x8001, 0xfffe, 0xffff};
+    for(int64_t hi = INT16_MIN; hi <= INT16_MAX; hi++) {
+        for(auto i = 0u; i < count_of(lows) + 8; i++) {
+            int32_t low = i < count_of(lows) ? lows[i] : random_u32() & 0xffff;
+            int64_t v = hi * 65536 + low;
+            EXPECT("to q15", fixed_to_q15(q31_t::from_raw((int32_t)v)).raw, saturate(round_shift(v, 16), INT16_MIN, INT16_MAX), v, 0);
+        }
+    }
+    for(int32_t v = INT16_MIN; v <= INT16_MAX; v++) {
+        EXPECT("to q31", fixed_to_q31(q15_t::from_raw(v)).raw, (int64_t)v * 65536, v, 0);
+    }
+}
+
+static void check_q31(int32_t a, int32_t b) {
+    q31_t qa = q31_t::from_raw(a), qb = q31_t::from_raw(b);
+    q15_t qb15 = q15_t::from_raw((int16_t)b);
+    EXPECT("q31 add", fixed_add(qa, qb).raw, saturate((int64_t)a + b, INT32_MIN, INT32_MAX), a, b);
+    EXPECT("q31 sub", fixed_sub(qa, qb).raw, saturate((int64_t)a - b, INT32_MIN, INT32_MAX), a, b);
+    EXPECT("q31 mul", fixed_mul(qa, qb).raw, saturate(round_shift((int64_t)a * b, 31), INT32_MIN, INT32_MAX), a, b);
+    EXPECT("q31 x q15", fixed_mul(qa, qb15).raw, saturate(round_shift((int64_t)a * (int16_t)b, 15), INT32_MIN, INT32_MAX), a, (int16_t)b);
+    EXPECT("q15 x q31", fixed_mul(qb15, qa).raw, fixed_mul(qa, qb15).raw, a, (int16_t)b);
+    int shift = b & 31;
+    EXPECT("shr_round", fixed_shr_round(a, shift), round_shift(a, shift), a, shift);
+}
+
+static void test_q31() {
+    // Where the partial products carry or saturate
+    static const int32_t corners[] = {
+        0, 1, -1, 2, -2, 0x7fff, 0x8000, 0xffff, 0x10000, -0x8000, -0x8001, -0x10000,
+        0x3fffffff, 0x40000000, -0x40000000, -0x40000001,
+        INT16_MAX, INT16_MIN, INT32_MAX, INT32_MAX - 1, INT32_MIN, INT32_MIN + 1,
+    };
+    for(auto a : corners) {
+        for(auto b : corners) check_q31(a, b);
+        for(int32_t b = INT16_MIN; b <= INT16_MAX; b++) check_q31(a, b);
+    }
+    for(auto i = 0u; i < RANDOM_Q31; i++) {
+        int32_t a = (int32_t)random_u32();
+        // Small values a quarter of the time, where rounding decides the result
+        int32_t b = (int32_t)random_u32() >> (i & 3 ? 0 : random_u32() % 31);
+        check_q31(a, b);
+    }
+}
+
+static void test_blocks() {
+    int16_t dst16[256], src16[256], scaled16[256];
+    int32_t dst32[256], src32[256], scaled32[256];
+    for(auto n = 0u; n < 256; n++) {
+        q15_t gain = q15_t::from_raw((int16_t)random_u32());
+        for(auto i = 0u; i < 256; i++) {
+            dst16[i] = scaled16[i] = (int16_t)random_u32();
+            src16[i] = (int16_t)random_u32();
+            dst32[i] = scaled32[i] = (int32_t)random_u32();
+            src32[i] = (int32_t)random_u32();
+        }
+        int16_t before16[256];
+        int32_t before32[256];
+        for(auto i = 0u; i < 256; i++) before16[i] = dst16[i], before32[i] = dst32[i];
+
+        fixed_block_mix(dst16, src16, 256, gain);
+        fixed_block_mix(dst32, src32, 256, gain);
+        fixed_block_scale(scaled16, 256, gain);
+        fixed_block_scale(scaled32, 256, gain);
+        for(auto i = 0u; i < 256; i++) {
+            EXPECT("mix16", dst16[i], saturate(before16[i] + round_shift(src16[i] * gain.raw, 15), INT16_MIN, INT16_MAX), src16[i], gain.raw);
+            int64_t mixed = before32[i] + saturate(round_shift((int64_t)src32[i] * gain.raw, 15), INT32_MIN, INT32_MAX);
+            EXPECT("mix32", dst32[i], saturate(mixed, INT32_MIN, INT32_MAX), src32[i], gain.raw);
+            EXPECT("scale16", scaled16[i], saturate(round_shift(before16[i] * gain.raw, 15), INT16_MIN, INT16_MAX), before16[i], gain.raw);
+            EXPECT("scale32", scaled32[i], saturate(round_shift((int64_t)before32[i] * gain.raw, 15), INT32_MIN, INT32_MAX), before32[i], gain.raw);
+        }
+    }
+}
+
+static void test_from_float() {
+    CHECK(q15_t::from_float(-1.0).raw == INT16_MIN, "q15 -1.0 is %d", q15_t::from_float(-1.0).raw);
+    CHECK(q31_t::from_float(1.0).raw == INT32_MAX, "q31 1.0 is %d", q31_t::from_float(1.0).raw);
+    CHECK(q31_t::from_float(-1.0).raw == INT32_MIN, "q31 -1.0 is %d", q31_t::from_float(-1.0).raw);
+    for(int32_t v = INT16_MIN; v <= INT16_MAX; v++) {
+        q15_t q = q15_t::from_raw(v);
+        EXPECT("q15 float round trip", q15_t::from_float(q.to_float()).raw, v, v, 0);
+    }
+    // Halves round away from zero
+    CHECK(q15_t::from_float(1.5 / 32768).raw == 2, "1.5 LSB is %d", q15_t::from_float(1.5 / 32768).raw);
+    CHECK(q15_t::from_float(-1.5 / 32768).raw == -2, "-1.5 LSB is %d", q15_t::from_float(-1.5 / 32768).raw);
+}
+
+int main() {
+    printf("%s multiplies\n", FIXED_NO_LONG_MULTIPLY ? "16x16 partial product" : "64-bit");
+
+    test_q15();
+    test_conversions();
+    test_q31();
+    test_blocks();
+    test_from_float();
+
+    printf("%u mismatches\n", mismatches);
+    CHECK(mismatches == 0, "%u mismatches", mismatches);
+    return test_result();
+}
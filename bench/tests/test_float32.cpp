@@ -0,0 +1,115 @@
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#include "pico/stdlib.h"
+#include "test.h"
+#include "host.h"
+#include "i2s_audio.h"
+
+// The integer-only float32 kernel against the same conversion in double
+// precision: the sample times 32768 times volume / 256, truncated towards
+// zero and saturated, with NaN as silence. It should match exactly for every
+// exponent, including denormals, infinities and NaN, at every volume.
+
+static const size_t FRAMES = 48;
+
+static int16_t expected_sample(uint32_t bits, uint8_t volume) {
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    // Infinity at volume 0 is still silence
+    if(isnan(value) || volume == 0) return 0;
+    double scaled = trunc((double)value * 32768.0 * volume / 256.0);
+    return (int16_t)fmax(-32768.0, fmin(32767.0, scaled));
+}
+
+static uint32_t mismatches = 0;
+static uint32_t checked = 0;
+
+// A packet of left and right samples, checked on the way out, where left and
+// right are swapped
+static void check_packet(const uint32_t *bits, uint8_t volume) {
+    int16_t out[FRAMES * 2];
+    host_capture(out, FRAMES);
+    i2s_audio_give_buffer((void *)bits, FRAMES * 2 * sizeof(uint32_t), 32, volume);
+    CHECK(host_captured() == FRAMES, "%zu frames out, expected %zu", host_captured(), FRAMES);
+
+    for(auto i = 0u; i < FRAMES * 2; i++) {
+        int16_t got = out[i ^ 1];
+        int16_t expected = expected_sample(bits[i], volume);
+        checked++;
+        if(got != expected && mismatches++ < 10) {
+            CHECK(got == expected, "0x%08x at volume %u: %d, expected %d", bits[i], volume, got, expected);
+        }
+    }
+}
+
+static void test_specials() {
+    static const uint32_t specials[] = {
+        0x00000000, 0x80000000,     // +/-0
+        0x00000001, 0x807fffff,     // Smallest and largest denormals
+        0x00800000,                 // Smallest normal
+        0x3f800000, 0xbf800000,     // +/-1.0, full scale
+        0x3f7fffff, 0xbf7fffff,     // Just inside
+        0x3f000000, 0xbf000000,     // +/-0.5
+        0x38000000, 0x37ffffff,     // 2^-15, one LSB, and just under it
+        0x40000000, 0xc0000000,     // +/-2.0
+        0x477fff00, 0x47800000,     // Either side of the shift running out
+        0x7f7fffff, 0xff7fffff,     // +/-FLT_MAX
+        0x7f800000, 0xff800000,     // +/-infinity
+        0x7fc00000, 0xffc00000,     // Quiet NaNs
+        0x7f800001, 0xff800001,     // Signalling NaNs
+        0x7fffffff,
+    };
+    static const uint8_t volumes[] = {0, 1, 2, 127, 128, 200, 255};
+
+    uint32_t bits[FRAMES * 2] = {};
+    for(auto v : volumes) {
+        for(auto i = 0u; i < count_of(specials); i++) bits[i] = specials[i];
+        check_packet(bits, v);
+    }
+}
+
+// Every exponent, both signs, mantissas from an LCG, every volume
+static void test_sweep() {
+    uint32_t seed = 1;
+    uint32_t bits[FRAMES * 2];
+    for(auto volume = 0u; volume < 256; volume++) {
+        for(auto exponent = 0u; exponent < 256; exponent++) {
+            for(auto i = 0u; i < FRAMES * 2; i++) {
+                seed = seed * 1664525u + 1013904223u;
+                bits[i] = (seed & 0x807fffff) | exponent << 23;
+            }
+            check_packet(bits, volume);
+        }
+    }
+}
+
+// A ramp from -1.0 to +1.0, and full scale at the top volume
+static void test_full_scale() {
+    uint32_t bits[FRAMES * 2];
+    for(auto i = 0u; i < FRAMES * 2; i++) {
+        float value = -1.0f + 2.0f * i / (FRAMES * 2 - 1);
+        memcpy(&bits[i], &value, sizeof(value));
+    }
+    check_packet(bits, 255);
+
+    int16_t out[FRAMES * 2];
+    host_capture(out, FRAMES);
+    float ends[FRAMES * 2] = {1.0f, -1.0f};
+    i2s_audio_give_buffer(ends, sizeof(ends), 32, 255);
+    printf("+1.0 -> %d, -1.0 -> %d at volume 255\n", out[1], out[0]);
+    CHECK(out[1] == 32640 && out[0] == -32640, "+/-1.0 at volume 255 gave %d, %d", out[1], out[0]);
+}
+
+int main() {
+    i2s_audio_init();
+
+    test_specials();
+    test_full_scale();
+    test_sweep();
+
+    printf("%u samples checked, %u mismatches\n", checked, mismatches);
+    CHECK(mismatches == 0, "%u mismatches", mismatches);
+    return test_result();
+}
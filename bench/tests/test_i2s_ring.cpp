@@ -0,0 +1,164 @@
+#include <stdint.h>
+#include <algorithm>
+
+#include "pico/stdlib.h"
+#include "test.h"
+#include "host.h"
+#include "hardware/dma.h"
+#include "i2s_ring.h"
+
+// The ring played by a model of its DMA: a frame every 1/48000s read from
+// where the data channel is in its pass, chaining through the control channel
+// back to the top. The main loop writes a packet a millisecond, every so often
+// a millisecond late, and is held up for a few milliseconds to longer than the
+// whole ring. Every frame carries a count, so audio heard out of order, ie: a
+// replay of what's already played, shows up. i2s_ring_service() and the
+// writes can't be interrupted on a PC, so the restart is only tested between
+// them.
+
+static const uint32_t RATE = 48000;
+static const size_t PACKET = 48;
+static const uint32_t RING_FRAMES = AUDIO_I2S_RING_FRAMES;
+static const uint32_t LEAD_FRAMES = AUDIO_I2S_RING_LEAD_FRAMES;
+// The most packets the host has buffered after a hold up, the rest are lost
+static const uint32_t MAX_OWED = 3;
+
+// Claimed in this order by i2s_ring_init()
+static const uint DATA_CHANNEL = 0;
+static const uint CONTROL_CHANNEL = 1;
+
+static uint64_t played = 0;         // Frames the DMA has read
+static uint32_t next_count = 1;     // The count in the next frame written
+static uint32_t last_heard = 0;     // The count in the last frame played
+static uint32_t owed = 0;           // Packets waiting for the main loop
+
+static uint32_t heard = 0;
+static uint32_t dropped = 0;        // Counts skipped, lost packets and underruns
+static uint32_t replayed = 0;       // Frames older than one already heard
+
+static uint32_t play_frame() {
+    dma_channel_hw_t *data = dma_channel_hw_addr(DATA_CHANNEL);
+    if(!data->transfer_count) dma_channel_start(CONTROL_CHANNEL);
+    const volatile uint32_t *ring = (const volatile uint32_t *)host_dma_read_addr(DATA_CHANNEL);
+    uint32_t frame = ring[RING_FRAMES - data->transfer_count];
+    data->transfer_count--;
+    played++;
+    host_set_time_us(played * 1000000 / RATE);
+    return frame;
+}
+
+// A millisecond of output. With checking off, while the main loop is held up,
+// the DMA is free to replay the ring, but it mustn't once it's serviced.
+static void play_ms(bool checking) {
+    for(auto i = 0u; i < RATE / 1000; i++) {
+        uint32_t frame = play_frame();
+        if(!frame) continue;
+        if(frame <= last_heard) {
+            if(checking) replayed++;
+            continue;
+        }
+        if(frame != last_heard + 1 && last_heard) dropped++;
+        last_heard = frame;
+        heard++;
+    }
+    owed = std::min(owed + 1, MAX_OWED);
+}
+
+static void main_loop() {
+    i2s_ring_service();
+    for(; owed; owed--) {
+        int16_t packet[PACKET * 2];
+        for(auto i = 0u; i < PACKET; i++, next_count++) {
+            packet[i * 2 + 0] = next_count & 0xffff;
+            packet[i * 2 + 1] = next_count >> 16;
+        }
+        i2s_ring_write(packet, PACKET);
+    }
+}
+
+// ms of streaming, the main loop a millisecond late every late_every
+static void stream(uint32_t ms, uint32_t late_every) {
+    for(auto i = 1u; i <= ms; i++) {
+        play_ms(true);
+        if(late_every && i % late_every == 0) continue;
+        main_loop();
+    }
+}
+
+// The main loop away for ms, then streaming again
+static void hold_up(uint32_t ms) {
+    for(auto i = 0u; i < ms; i++) play_ms(false);
+    main_loop();
+    stream(100, 0);
+}
+
+static i2s_ring_stats_t take_stats() {
+    i2s_ring_stats_t stats;
+    i2s_ring_get_stats(&stats, true);
+    return stats;
+}
+
+static void test_streaming() {
+    stream(10, 0);
+    take_stats();
+    uint32_t before = heard;
+    dropped = 0;
+    stream(10000, 7);
+    i2s_ring_stats_t stats = take_stats();
+    printf("streaming: heard %u frames, dropped %u, replayed %u, underruns %lu overruns %lu, queued %lu\n",
+        heard - before, dropped, replayed, (unsigned long)stats.underruns, (unsigned long)stats.overruns,
+        (unsigned long)i2s_ring_queued());
+    CHECK(heard - before == 10000 * PACKET, "%u frames heard in 10s, expected %zu", heard - before, 10000 * PACKET);
+    CHECK(dropped == 0 && stats.underruns == 0 && stats.overruns == 0, "a late main loop lost audio");
+    CHECK(i2s_ring_queued() >= LEAD_FRAMES - PACKET, "%lu frames queued, expected a lead", (unsigned long)i2s_ring_queued());
+}
+
+// Under the lap time it's an underrun like any other, beyond it the ring is
+// silenced rather than replayed
+static void test_hold_ups() {
+    static const uint32_t holds_ms[] = {2, 5, 7, 9, 11, 16, 25, 40, 100};
+    uint32_t lap_ms = (RING_FRAMES - LEAD_FRAMES) * 1000 / RATE;
+    for(auto ms : holds_ms) {
+        take_stats();
+        uint32_t before = heard;
+        hold_up(ms);
+        i2s_ring_stats_t stats = take_stats();
+        printf("held up %3ums: heard %u, replayed %u, underruns %lu laps %lu\n", ms, heard - before, replayed,
+            (unsigned long)stats.underruns, (unsigned long)stats.laps);
+        CHECK(replayed == 0, "held up %ums: %u frames replayed after the service", ms, replayed);
+        if(ms > lap_ms) {
+            CHECK(stats.laps == 1, "held up %ums: %lu laps, expected 1", ms, (unsigned long)stats.laps);
+        } else {
+            CHECK(stats.laps == 0, "held up %ums: %lu laps, expected none", ms, (unsigned long)stats.laps);
+        }
+        CHECK(stats.underruns == (ms * RATE / 1000 > LEAD_FRAMES ? 1u : 0u), "held up %ums: %lu underruns",
+            ms, (unsigned long)stats.underruns);
+        CHECK(heard - before > 90 * PACKET, "held up %ums: only %u frames heard after", ms, heard - before);
+        replayed = 0;
+    }
+}
+
+// As the health monitor does to a stalled ring, between services
+static void test_restart() {
+    for(auto restart_pio = 0u; restart_pio < 2; restart_pio++) {
+        play_ms(true);
+        i2s_ring_restart(restart_pio);
+        uint32_t before = heard;
+        stream(100, 7);
+        printf("restarted%s: heard %u, replayed %u\n", restart_pio ? " with the PIO" : "", heard - before, replayed);
+        CHECK(replayed == 0, "%u frames replayed after a restart", replayed);
+        CHECK(heard - before > 90 * PACKET, "only %u frames heard after a restart", heard - before);
+    }
+}
+
+int main() {
+    host_set_time_us(0);
+    i2s_ring_init(RATE);
+    i2s_ring_start();
+
+    test_streaming();
+    test_hold_ups();
+    test_restart();
+
+    return test_result();
+}
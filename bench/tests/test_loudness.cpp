@@ -0,0 +1,103 @@
+#include <stdint.h>
+#include <math.h>
+#include <complex>
+#include <algorithm>
+
+#include "pico/stdlib.h"
+#include "test.h"
+#include "loudness.h"
+#include "loudness_table.h"
+#include "siggen.h"
+
+// The loudness shelves measured at every volume step, against the response
+// generate-loudness.py designed them for: y = x + bass * lowpass(x) +
+// treble * (x - lowpass(x)), with the table's gains and the Q15 one poles.
+// The sines come from siggen.cpp.
+
+static const double RATE = 48000.0;
+static const size_t PACKET = 48;
+static const size_t WARMUP_PACKETS = 100;
+// 10Hz DFT bins, every test frequency falls on one
+static const size_t PACKETS = 100;
+static const size_t N = PACKETS * PACKET;
+
+// Quiet enough for the full 12dB of bass boost without clipping
+static const int8_t LEVEL_DB = -15;
+static const double TOLERANCE_DB = 0.05;
+
+static const uint16_t FREQS[] = {50, 200, 1000, 6000, 16000};
+
+static double design_db(uint8_t volume, double freq) {
+    double k_bass = (double)LOUDNESS_K_BASS / (1 << LOUDNESS_COEFF_BITS);
+    double k_treble = (double)LOUDNESS_K_TREBLE / (1 << LOUDNESS_COEFF_BITS);
+    double bass = (double)loudness_table[volume].bass / (1 << LOUDNESS_GAIN_BITS);
+    double treble = (double)loudness_table[volume].treble / (1 << LOUDNESS_GAIN_BITS);
+    std::complex<double> z = std::polar(1.0, 2.0 * M_PI * freq / RATE);
+    std::complex<double> low = k_bass / (1.0 - (1.0 - k_bass) / z);
+    std::complex<double> high = 1.0 - k_treble / (1.0 - (1.0 - k_treble) / z);
+    return db(std::abs(1.0 + bass * low + treble * high));
+}
+
+static double amplitude(const int16_t *samples, double freq) {
+    std::complex<double> sum = 0;
+    for(auto i = 0u; i < N; i++) {
+        sum += (double)samples[i] * std::polar(1.0, -2.0 * M_PI * freq * i / RATE);
+    }
+    return 2.0 * std::abs(sum) / N;
+}
+
+// Gain at freq, measured on the left channel with the right playing the same
+static double measure_db(uint8_t volume, uint16_t freq) {
+    static int16_t in[N], out[N];
+    loudness_set_enabled(false);
+    loudness_set_enabled(true);
+    siggen_config_t config = {SIGGEN_SINE, LEVEL_DB, freq, 0, 0};
+    siggen_start(&config, RATE);
+    for(auto p = 0u; p < WARMUP_PACKETS + PACKETS; p++) {
+        int16_t packet[PACKET * 2];
+        siggen_fill(packet, PACKET);
+        size_t at = (p - WARMUP_PACKETS) * PACKET;
+        if(p >= WARMUP_PACKETS) {
+            for(auto i = 0u; i < PACKET; i++) in[at + i] = packet[i * 2];
+        }
+        loudness_process(packet, PACKET, volume);
+        if(p >= WARMUP_PACKETS) {
+            for(auto i = 0u; i < PACKET; i++) {
+                out[at + i] = packet[i * 2];
+                CHECK(packet[i * 2] == packet[i * 2 + 1], "channels differ at volume %u %uHz", volume, freq);
+            }
+        }
+    }
+    return db(amplitude(out, freq) / amplitude(in, freq));
+}
+
+int main() {
+    double worst = 0;
+    double previous[count_of(FREQS)] = {};
+    for(int volume = 255; volume >= 0; volume--) {
+        double measured[count_of(FREQS)];
+        for(auto f = 0u; f < count_of(FREQS); f++) {
+            measured[f] = measure_db(volume, FREQS[f]);
+            double expected = design_db(volume, FREQS[f]);
+            worst = std::max(worst, fabs(measured[f] - expected));
+            CHECK(fabs(measured[f] - expected) <= TOLERANCE_DB, "volume %d %uHz: %+.3fdB, designed %+.3fdB",
+                volume, FREQS[f], measured[f], expected);
+            // Compensation only ever grows as the volume comes down
+            if(volume < 255) {
+                CHECK(measured[f] >= previous[f] - TOLERANCE_DB, "volume %d %uHz: %+.3fdB, less than %+.3fdB a step up",
+                    volume, FREQS[f], measured[f], previous[f]);
+            }
+            previous[f] = measured[f];
+        }
+        if(volume % 32 == 31 || volume < 4) {
+            printf("volume %3d:", volume);
+            for(auto f = 0u; f < count_of(FREQS); f++) printf(" %uHz %+.2fdB", FREQS[f], measured[f]);
+            printf("\n");
+        }
+        if(volume == 255) {
+            CHECK(fabs(measured[0]) <= TOLERANCE_DB && fabs(measured[4]) <= TOLERANCE_DB, "full volume isn't flat");
+        }
+    }
+    printf("worst difference from the design %.3fdB\n", worst);
+    return test_result();
+}
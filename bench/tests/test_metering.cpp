@@ -0,0 +1,122 @@
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+
+#include "test.h"
+#include "i2s_audio.h"
+
+// The levels accumulated in the conversion kernel, against the same figures
+// worked out here in double precision from what the kernel should output.
+
+static const size_t FRAMES = 48;
+static const uint8_t VOLUME = 200;
+
+struct reference_t {
+    uint32_t peak[2];
+    double sum_squares[2];
+    uint32_t frames;
+};
+
+static void reference_add(reference_t *ref, int32_t left, int32_t right) {
+    int32_t out[2] = {(left * VOLUME) >> 8, (right * VOLUME) >> 8};
+    for(auto c = 0u; c < 2; c++) {
+        ref->peak[c] = std::max<uint32_t>(ref->peak[c], abs(out[c]));
+        ref->sum_squares[c] += (double)out[c] * out[c];
+    }
+    ref->frames++;
+}
+
+static void check_levels(const char *name, const reference_t *ref) {
+    i2s_audio_levels_t levels;
+    i2s_audio_get_levels(&levels, true);
+    CHECK(levels.frames == ref->frames, "%s: %u frames, expected %u", name, levels.frames, ref->frames);
+    for(auto c = 0u; c < 2; c++) {
+        double rms = sqrt(ref->sum_squares[c] / ref->frames);
+        printf("%s ch%u peak %u (%u) rms %u (%.2f)\n", name, c, levels.peak[c], ref->peak[c], levels.rms[c], rms);
+        CHECK(levels.peak[c] == ref->peak[c], "%s ch%u: peak %u, expected %u", name, c, levels.peak[c], ref->peak[c]);
+        // Truncated to an integer square root of the mean
+        CHECK(fabs(levels.rms[c] - floor(rms)) <= 1.0, "%s ch%u: rms %u, expected %.2f", name, c, levels.rms[c], rms);
+    }
+}
+
+static void test_sines() {
+    reference_t ref = {};
+    int16_t packet[FRAMES * 2];
+    uint32_t n = 0;
+    for(auto p = 0u; p < 100; p++) {
+        for(auto i = 0u; i < FRAMES; i++, n++) {
+            packet[i * 2 + 0] = (int16_t)lrint(20000.0 * sin(2.0 * M_PI * 1000.0 * n / 48000.0));
+            packet[i * 2 + 1] = (int16_t)lrint(-3000.0 * sin(2.0 * M_PI * 440.0 * n / 48000.0));
+            reference_add(&ref, packet[i * 2 + 0], packet[i * 2 + 1]);
+        }
+        i2s_audio_give_buffer(packet, sizeof(packet), 16, VOLUME);
+    }
+    check_levels("s16 sines", &ref);
+
+    // A sine's RMS is its peak over root 2
+    double expected = 20000.0 * VOLUME / 256.0 / sqrt(2.0);
+    double rms = sqrt(ref.sum_squares[0] / ref.frames);
+    CHECK(fabs(db(rms / expected)) < 0.05, "1kHz sine rms %.2f, expected %.2f", rms, expected);
+}
+
+static void test_clips() {
+    int16_t s16[FRAMES * 2] = {};
+    int32_t s24[FRAMES * 2] = {};
+    uint32_t f32[FRAMES * 2] = {};
+
+    // Left at both ends of full scale, right one step inside
+    for(auto i = 0u; i < 8; i++) {
+        s16[i * 2 + 0] = i & 1 ? INT16_MIN : INT16_MAX;
+        s16[i * 2 + 1] = i & 1 ? INT16_MIN + 1 : INT16_MAX - 1;
+        s24[i * 2 + 0] = i & 1 ? (int32_t)0x80000000 : 0x7fffff00;
+        s24[i * 2 + 1] = 0x7ffeff00;
+    }
+    // +1.0, -2.0 and +infinity clip, just under 1.0 doesn't
+    f32[0] = 0x3f800000;
+    f32[2] = 0xc0000000;
+    f32[4] = 0x7f800000;
+    f32[1] = 0x3f7fffff;
+
+    i2s_audio_levels_t levels;
+    i2s_audio_get_levels(&levels, true);
+    i2s_audio_give_buffer(s16, sizeof(s16), 16, VOLUME);
+    i2s_audio_give_buffer(s24, sizeof(s24), 24, VOLUME);
+    i2s_audio_give_buffer(f32, sizeof(f32), 32, VOLUME);
+    i2s_audio_get_levels(&levels, true);
+    printf("clips ch0 %u ch1 %u\n", levels.clips[0], levels.clips[1]);
+    CHECK(levels.clips[0] == 8 + 8 + 3, "ch0 clips %u, expected 19", levels.clips[0]);
+    CHECK(levels.clips[1] == 0, "ch1 clips %u, expected none", levels.clips[1]);
+    // -2.0 saturates whatever the volume
+    CHECK(levels.peak[0] == 32768, "ch0 peak %u, expected 32768", levels.peak[0]);
+}
+
+static void test_silence() {
+    int16_t packet[FRAMES * 2] = {};
+    for(auto p = 0u; p < 250; p++) {
+        i2s_audio_give_buffer(packet, sizeof(packet), 16, VOLUME);
+    }
+    i2s_audio_levels_t levels;
+    i2s_audio_get_levels(&levels, true);
+    printf("silent_ms %u after 250ms of zeros\n", levels.silent_ms);
+    CHECK(levels.silent_ms == 250, "silent_ms %u, expected 250", levels.silent_ms);
+    CHECK(levels.peak[0] == 0 && levels.rms[0] == 0, "silence peak %u rms %u", levels.peak[0], levels.rms[0]);
+
+    // Silence survives a reset of the other levels, and a single LSB ends it.
+    // So does a sample the volume scales down to nothing.
+    packet[FRAMES] = 1;
+    i2s_audio_give_buffer(packet, sizeof(packet), 16, VOLUME);
+    i2s_audio_get_levels(&levels, true);
+    CHECK(levels.silent_ms == 0, "silent_ms %u after a 1 LSB sample", levels.silent_ms);
+    CHECK(levels.peak[0] == 0, "1 LSB peak %u, scaled below 1 LSB", levels.peak[0]);
+}
+
+int main() {
+    i2s_audio_init();
+
+    test_sines();
+    test_clips();
+    test_silence();
+
+    return test_result();
+}
@@ -0,0 +1,107 @@
+#include <stdint.h>
+#include <math.h>
+#include <algorithm>
+
+#include "test.h"
+#include "oversample.h"
+#include "halfband_taps.h"
+#include "siggen.h"
+
+// The 2x interpolator's measured response against what generate-halfband.py
+// designed: sines through the passband in packets, with the gain of each and
+// the level of its image at 48kHz - f read off a DFT of the 96kHz output. The
+// sines come from siggen.cpp.
+
+static const double RATE = 48000.0;
+static const size_t PACKET = 48;
+static const size_t WARMUP_PACKETS = 4;
+// 10Hz DFT bins, every test tone and its image falls on one
+static const size_t PACKETS = 100;
+static const size_t N = PACKETS * PACKET * 2;
+
+static const int8_t LEVEL_DB = -1;
+static const double MAX_RIPPLE_DB = 0.01;
+static const double MIN_REJECTION_DB = 78.0;
+
+// Amplitude at an exact bin of the block
+static double amplitude(const int16_t *samples, size_t n, size_t stride, double freq, double rate) {
+    double re = 0, im = 0;
+    for(auto i = 0u; i < n; i++) {
+        double phase = 2.0 * M_PI * freq * i / rate;
+        re += samples[i * stride] * cos(phase);
+        im -= samples[i * stride] * sin(phase);
+    }
+    return 2.0 * sqrt(re * re + im * im) / n;
+}
+
+// A sine on the left and silence on the right, returns the 96kHz left channel
+static void run_tone(uint16_t freq, int16_t *in, int16_t *out, bool *right_silent) {
+    oversample_reset();
+    siggen_config_t config = {SIGGEN_SINE, LEVEL_DB, freq, 0, 0};
+    siggen_start(&config, RATE);
+    *right_silent = true;
+    for(auto p = 0u; p < WARMUP_PACKETS + PACKETS; p++) {
+        int16_t packet[PACKET * 2 * 2];
+        siggen_fill(packet, PACKET);
+        for(auto i = 0u; i < PACKET; i++) packet[i * 2 + 1] = 0;
+        if(p >= WARMUP_PACKETS) {
+            for(auto i = 0u; i < PACKET; i++) in[(p - WARMUP_PACKETS) * PACKET + i] = packet[i * 2];
+        }
+        oversample_2x(packet, PACKET);
+        for(auto i = 0u; i < PACKET * 2; i++) {
+            if(p >= WARMUP_PACKETS) out[(p - WARMUP_PACKETS) * PACKET * 2 + i] = packet[i * 2];
+            if(packet[i * 2 + 1]) *right_silent = false;
+        }
+    }
+}
+
+static void test_response() {
+    static int16_t in[N / 2], out[N];
+    double min_gain = 1e9, max_gain = 0, worst_image = -1e9, worst_image_freq = 0;
+    for(uint16_t freq = 250; freq <= 20000; freq += 250) {
+        bool right_silent;
+        run_tone(freq, in, out, &right_silent);
+        CHECK(right_silent, "%uHz on the left leaked into the right", freq);
+
+        double input = amplitude(in, N / 2, 1, freq, RATE);
+        double gain = amplitude(out, N, 1, freq, 2 * RATE) / input;
+        double image = db(amplitude(out, N, 1, RATE - freq, 2 * RATE) / input);
+        min_gain = std::min(min_gain, gain);
+        max_gain = std::max(max_gain, gain);
+        if(image > worst_image) {
+            worst_image = image;
+            worst_image_freq = freq;
+        }
+    }
+    double ripple = db(max_gain / min_gain);
+    printf("passband %.4fdB to %.4fdB, ripple %.4fdB to 20kHz\n", db(min_gain), db(max_gain), ripple);
+    printf("worst image %.1fdB, of %.0fHz at %.0fHz\n", worst_image, worst_image_freq, RATE - worst_image_freq);
+    CHECK(ripple <= MAX_RIPPLE_DB, "ripple %.4fdB, expected under %.4fdB", ripple, MAX_RIPPLE_DB);
+    CHECK(fabs(db(max_gain)) <= MAX_RIPPLE_DB, "passband gain %.4fdB, expected unity", db(max_gain));
+    CHECK(-worst_image >= MIN_REJECTION_DB, "image only %.1fdB down, expected %.1fdB", -worst_image, MIN_REJECTION_DB);
+}
+
+// An input frame comes out as is on the odd outputs, oversample_delay_frames() later
+static void test_delay() {
+    oversample_reset();
+    siggen_config_t config = {SIGGEN_IMPULSE, -10, 1, 0, 0};
+    siggen_start(&config, RATE);
+    int16_t packet[PACKET * 2 * 2];
+    siggen_fill(packet, PACKET);
+    int16_t impulse = packet[0];
+    oversample_2x(packet, PACKET);
+
+    uint32_t peak = 0;
+    for(auto i = 0u; i < PACKET * 2; i++) {
+        if(abs(packet[i * 2]) > abs(packet[peak * 2])) peak = i;
+    }
+    printf("impulse out at frame %u, delay %u, centre tap %d\n", peak, oversample_delay_frames(), packet[peak * 2]);
+    CHECK(peak == oversample_delay_frames(), "impulse at frame %u, expected %u", peak, oversample_delay_frames());
+    CHECK(packet[peak * 2] == impulse, "impulse of %d came out as %d", impulse, packet[peak * 2]);
+}
+
+int main() {
+    test_response();
+    test_delay();
+    return test_result();
+}
@@ -0,0 +1,136 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "test.h"
+#include "settings_log.h"
+
+// The settings log on a simulated NOR flash, with the power cut at random
+// during erases and page programs, tearing them part way. After every cut
+// the log is loaded again, as at the next boot, and every key must hold
+// either the last value written in full or, for the keys in the write that
+// was cut, the new one. Then it carries on from there.
+
+static const uint32_t CYCLES = 20000;
+static const uint32_t CUT_ONE_IN = 40;
+
+static uint8_t flash[SETTINGS_LOG_SECTOR_SIZE * 2];
+
+struct power_cut {};
+
+enum { CUT_ERASE, CUT_PROGRAM, CUT_KINDS };
+static uint32_t cuts[CUT_KINDS];
+static uint32_t ops_until_cut = 0;
+static bool cut_erase = false;
+
+// Erases are rare next to programs, so one cut in four waits for the next
+static void next_cut() {
+    ops_until_cut = 1 + random_u32() % (2 * CUT_ONE_IN);
+    cut_erase = random_u32() % 4 == 0;
+}
+
+// Erasing sets bits and programming clears them. Cut part way, an erase
+// has set a random subset of the bits and a program has finished some bytes,
+// cleared some of the bits of the next, and not touched the rest.
+static void erase(uint32_t offset) {
+    uint8_t *sector = flash + offset;
+    if(cut_erase || --ops_until_cut == 0) {
+        for(auto i = 0u; i < SETTINGS_LOG_SECTOR_SIZE; i++) sector[i] |= random_u32();
+        cuts[CUT_ERASE]++;
+        throw power_cut();
+    }
+    memset(sector, 0xff, SETTINGS_LOG_SECTOR_SIZE);
+}
+
+static void program(uint32_t offset, const uint8_t *data) {
+    CHECK(offset % SETTINGS_LOG_PAGE_SIZE == 0, "program at %u isn't page aligned", offset);
+    uint8_t *page = flash + offset;
+    if(!cut_erase && --ops_until_cut == 0) {
+        uint32_t done = random_u32() % SETTINGS_LOG_PAGE_SIZE;
+        for(auto i = 0u; i < done; i++) page[i] &= data[i];
+        page[done] &= data[done] | random_u32();
+        cuts[CUT_PROGRAM]++;
+        throw power_cut();
+    }
+    for(auto i = 0u; i < SETTINGS_LOG_PAGE_SIZE; i++) page[i] &= data[i];
+}
+
+static const settings_log_flash_t sim = {flash, erase, program};
+
+static const uint8_t KEYS = 6;
+
+// What a reader may find for each key
+static int32_t committed[KEYS];
+static bool committed_present[KEYS];
+static int32_t torn[KEYS];
+static bool torn_present[KEYS];
+
+static uint32_t mismatches = 0;
+static uint32_t torn_taken = 0;
+static uint32_t compactions = 0;
+
+static void check_boot(settings_log_t *log) {
+    settings_log_load(log, &sim);
+    for(auto key = 0u; key < KEYS; key++) {
+        bool present = log->present & (1u << key);
+        bool ok_old = present == committed_present[key] && (!present || log->values[key] == committed[key]);
+        bool ok_new = torn_present[key] && present && log->values[key] == torn[key];
+        if(!ok_old && !ok_new) {
+            if(mismatches++ < 10) {
+                CHECK(false, "key %u after a cut: %s %d, expected %d or %d", key,
+                    present ? "present" : "absent", log->values[key], committed[key], torn[key]);
+            }
+        }
+        // Whichever survived is what the next boot must find
+        if(present) {
+            if(ok_new && !ok_old) torn_taken++;
+            committed[key] = log->values[key];
+            committed_present[key] = true;
+        }
+        torn_present[key] = false;
+    }
+}
+
+int main() {
+    memset(flash, 0xff, sizeof(flash));
+    settings_log_t log;
+    check_boot(&log);
+
+    for(auto cycle = 0u; cycle < CYCLES; cycle++) {
+        next_cut();
+        try {
+            // Writes until the power goes, as settings_task() batches them
+            while(true) {
+                uint8_t keys[3];
+                int32_t values[3];
+                size_t count = 1 + random_u32() % 3;
+                for(auto i = 0u; i < count; i++) {
+                    keys[i] = (cycle + i * 2) % KEYS;
+                    values[i] = (int32_t)random_u32();
+                    torn[keys[i]] = values[i];
+                    torn_present[keys[i]] = true;
+                }
+                if(!settings_log_append(&log, keys, values, count)) {
+                    // Nothing new is written by a compaction
+                    for(auto i = 0u; i < count; i++) torn_present[keys[i]] = false;
+                    settings_log_compact(&log);
+                    compactions++;
+                    for(auto i = 0u; i < count; i++) torn_present[keys[i]] = true;
+                    settings_log_append(&log, keys, values, count);
+                }
+                for(auto i = 0u; i < count; i++) {
+                    committed[keys[i]] = values[i];
+                    committed_present[keys[i]] = true;
+                    torn_present[keys[i]] = false;
+                }
+            }
+        } catch(power_cut &) {
+        }
+        check_boot(&log);
+    }
+
+    printf("%u power cuts, %u in erases and %u in programs, %u compactions\n",
+        cuts[CUT_ERASE] + cuts[CUT_PROGRAM], cuts[CUT_ERASE], cuts[CUT_PROGRAM], compactions);
+    printf("%u torn writes kept their new value, %u keys lost or corrupted\n", torn_taken, mismatches);
+    CHECK(cuts[CUT_ERASE] > 100, "only %u cuts during erases", cuts[CUT_ERASE]);
+    return test_result();
+}
@@ -0,0 +1,227 @@
+#include <stdint.h>
+#include <math.h>
+#include <complex>
+#include <algorithm>
+
+#include "pico/stdlib.h"
+#include "test.h"
+#include "siggen.h"
+
+// The test signal generator, which the other host tests take their input
+// from, against what each signal should be: sines against double precision,
+// the pink noise's slope per octave, where a sweep ends up and the spacing of
+// impulses.
+
+static const uint32_t RATE = 48000;
+static const size_t PACKET = 48;
+
+// Runs the generator for frames, keeping the left channel
+static void generate(const siggen_config_t *config, int16_t *samples, size_t frames) {
+    siggen_start(config, RATE);
+    for(auto at = 0u; at < frames; at += PACKET) {
+        int16_t packet[PACKET * 2];
+        siggen_fill(packet, PACKET);
+        for(auto i = 0u; i < PACKET && at + i < frames; i++) samples[at + i] = packet[i * 2];
+    }
+}
+
+static std::complex<double> bin(const int16_t *samples, size_t n, double freq) {
+    std::complex<double> sum = 0;
+    for(auto i = 0u; i < n; i++) sum += (double)samples[i] * std::polar(1.0, -2.0 * M_PI * freq * i / RATE);
+    return 2.0 * sum / (double)n;
+}
+
+// 10Hz bins, every test tone and its harmonics fall on one
+static const size_t SINE_FRAMES = 4800;
+static const uint32_t HARMONICS = 10;
+
+static void test_sine() {
+    static const uint16_t freqs[] = {50, 440, 1000, 6000, 15000};
+    static const int8_t levels[] = {0, -6, -20};
+    static int16_t samples[SINE_FRAMES];
+    double worst_thd = -1000, worst_thd_n = -1000, worst_level = 0, worst_error = 0;
+    for(auto freq : freqs) {
+        for(auto level : levels) {
+            siggen_config_t config = {SIGGEN_SINE, level, freq, 0, 0};
+            generate(&config, samples, SINE_FRAMES);
+
+            // The level is exact to within the generator's Q15 gain
+            double amplitude = 32767.0 * pow(10.0, level / 20.0);
+            std::complex<double> fundamental = bin(samples, SINE_FRAMES, freq);
+            double level_error = db(std::abs(fundamental) / amplitude);
+            worst_level = std::max(worst_level, fabs(level_error));
+
+            double harmonic_squares = 0;
+            for(auto n = 2u; n <= HARMONICS && n * freq < RATE / 2; n++) {
+                harmonic_squares += std::norm(bin(samples, SINE_FRAMES, n * freq));
+            }
+            double thd = db(sqrt(harmonic_squares) / amplitude);
+
+            // Everything but the fundamental, from the difference to a double
+            // precision sine of the same level and phase
+            double error_squares = 0, max_error = 0;
+            for(auto i = 0u; i < SINE_FRAMES; i++) {
+                double error = samples[i] - amplitude * sin(2.0 * M_PI * freq * i / RATE);
+                error_squares += error * error;
+                max_error = std::max(max_error, fabs(error));
+            }
+            double thd_n = db(sqrt(2.0 * error_squares / SINE_FRAMES) / amplitude);
+            worst_thd = std::max(worst_thd, thd);
+            worst_thd_n = std::max(worst_thd_n, thd_n);
+            worst_error = std::max(worst_error, max_error);
+
+            CHECK(fabs(level_error) <= 0.001, "%uHz %ddBFS is %+.4fdB out", freq, level, level_error);
+            CHECK(fabs(std::arg(fundamental) + M_PI_2) <= 0.001, "%uHz %ddBFS doesn't start at phase 0", freq, level);
+            // Down with 16-bit rounding, which is all that's left of a quiet tone
+            CHECK(thd + level <= -92, "%uHz %ddBFS THD %.1fdB", freq, level, thd);
+            CHECK(max_error <= 1.5, "%uHz %ddBFS %.2f LSB from the reference", freq, level, max_error);
+        }
+    }
+    printf("sine: level within %.4fdB, THD at most %.1fdB, THD+N %.1fdB, at most %.2f LSB from double precision\n",
+        worst_level, worst_thd, worst_thd_n, worst_error);
+}
+
+// In place, n a power of two
+static void fft(std::complex<double> *x, size_t n) {
+    for(size_t i = 1, j = 0; i < n; i++) {
+        size_t bit = n >> 1;
+        for(; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if(i < j) std::swap(x[i], x[j]);
+    }
+    for(size_t len = 2; len <= n; len <<= 1) {
+        std::complex<double> step = std::polar(1.0, -2.0 * M_PI / len);
+        for(size_t i = 0; i < n; i += len) {
+            std::complex<double> w = 1;
+            for(size_t k = 0; k < len / 2; k++, w *= step) {
+                std::complex<double> a = x[i + k], b = x[i + k + len / 2] * w;
+                x[i + k] = a + b;
+                x[i + k + len / 2] = a - b;
+            }
+        }
+    }
+}
+
+// Equal power in every octave, ie: 3dB down per octave in density, from
+// 94Hz to 12kHz, averaged over 64 blocks
+static void test_pink() {
+    static const size_t N = 4096;
+    static const size_t BLOCKS = 64;
+    static const size_t OCTAVES = 7;
+    static int16_t samples[N * BLOCKS];
+    siggen_config_t config = {SIGGEN_PINK, -6, 0, 0, 0};
+    generate(&config, samples, N * BLOCKS);
+
+    static double power[N / 2];
+    for(auto b = 0u; b < BLOCKS; b++) {
+        static std::complex<double> x[N];
+        for(auto i = 0u; i < N; i++) {
+            // Hann window
+            x[i] = samples[b * N + i] * (0.5 - 0.5 * cos(2.0 * M_PI * i / N));
+        }
+        fft(x, N);
+        for(auto k = 0u; k < N / 2; k++) power[k] += std::norm(x[k]);
+    }
+
+    // Octaves of bins 8-15, 16-31... 512-1023
+    double octave_db[OCTAVES];
+    for(auto o = 0u; o < OCTAVES; o++) {
+        double sum = 0;
+        for(auto k = 8u << o; k < 16u << o; k++) sum += power[k];
+        octave_db[o] = 10.0 * log10(sum);
+    }
+    printf("pink: octaves from %.0fHz", 8.0 * RATE / N);
+    for(auto o = 0u; o < OCTAVES; o++) printf(" %+.1f", octave_db[o] - octave_db[0]);
+    printf("dB\n");
+
+    // A straight line through them, and how far any octave strays from it
+    double mean_x = (OCTAVES - 1) / 2.0, mean_y = 0;
+    for(auto o = 0u; o < OCTAVES; o++) mean_y += octave_db[o] / OCTAVES;
+    double sxy = 0, sxx = 0;
+    for(auto o = 0u; o < OCTAVES; o++) {
+        sxy += (o - mean_x) * (octave_db[o] - mean_y);
+        sxx += (o - mean_x) * (o - mean_x);
+    }
+    double slope = sxy / sxx, worst = 0;
+    for(auto o = 0u; o < OCTAVES; o++) {
+        worst = std::max(worst, fabs(octave_db[o] - (mean_y + slope * (o - mean_x))));
+    }
+    printf("pink: %+.2fdB per octave, at most %.2fdB off the line\n", slope, worst);
+    CHECK(fabs(slope) <= 0.5, "pink noise %+.2fdB per octave, expected flat octaves", slope);
+    CHECK(worst <= 1.5, "an octave %.2fdB off the slope", worst);
+}
+
+// Where a log sweep's phase should be at frame t, in cycles
+static double sweep_cycles(const uint16_t *sweep, double t) {
+    double frames = sweep[2] * (RATE / 1000.0);
+    double log_ratio = log((double)sweep[1] / sweep[0]);
+    return sweep[0] * frames / RATE / log_ratio * (exp(log_ratio * t / frames) - 1.0);
+}
+
+// The frequency from the zero crossings in samples[from, to), each placed to
+// a fraction of a frame, against what the sweep should have been between the
+// first and last of them
+static void measure_sweep(const uint16_t *sweep, const int16_t *samples, size_t from, size_t to, double *measured, double *expected) {
+    double first = -1, last = -1;
+    int count = 0;
+    for(auto i = from + 1; i < to; i++) {
+        if((samples[i - 1] < 0) != (samples[i] < 0)) {
+            double at = i - 1 + (double)samples[i - 1] / (samples[i - 1] - samples[i]);
+            if(first < 0) first = at;
+            last = at;
+            count++;
+        }
+    }
+    *measured = (count - 1) / 2.0 * RATE / (last - first);
+    *expected = (sweep_cycles(sweep, last) - sweep_cycles(sweep, first)) * RATE / (last - first);
+}
+
+static void test_sweep() {
+    // Ending at most 10kHz, so every half cycle has samples either side of zero
+    static const uint16_t sweeps[][3] = {{20, 10000, 2000}, {100, 1000, 500}, {5000, 50, 1000}};
+    for(auto sweep : sweeps) {
+        size_t frames = sweep[2] * (RATE / 1000);
+        static int16_t samples[RATE * 2];
+        siggen_config_t config = {SIGGEN_SWEEP, -6, sweep[0], sweep[1], sweep[2]};
+        generate(&config, samples, frames);
+        CHECK(!siggen_active(), "the sweep is still going after %ums", sweep[2]);
+
+        // 20 cycles at each end, the interpolated crossings are good to a
+        // small fraction of one
+        size_t start_frames = 20 * RATE / sweep[0];
+        size_t end_frames = 20 * RATE / sweep[1];
+        double start, expected_start, end, expected_end;
+        measure_sweep(sweep, samples, 0, start_frames, &start, &expected_start);
+        measure_sweep(sweep, samples, frames - end_frames, frames, &end, &expected_end);
+        printf("sweep %u-%uHz over %ums: starts %.1fHz (%.1f), ends %.1fHz (%.1f)\n", sweep[0], sweep[1], sweep[2],
+            start, expected_start, end, expected_end);
+        CHECK(fabs(start / expected_start - 1.0) <= 0.002, "sweep starts at %.1fHz, expected %.1fHz", start, expected_start);
+        CHECK(fabs(end / expected_end - 1.0) <= 0.002, "sweep ends at %.1fHz, expected %.1fHz", end, expected_end);
+    }
+}
+
+static void test_impulse() {
+    static const uint16_t freqs[] = {1, 10, 47, 1000};
+    static int16_t samples[RATE];
+    for(auto freq : freqs) {
+        siggen_config_t config = {SIGGEN_IMPULSE, 0, freq, 0, 0};
+        generate(&config, samples, RATE);
+        uint32_t period = RATE / freq, impulses = 0, misplaced = 0;
+        for(auto i = 0u; i < RATE; i++) {
+            bool expected = i % period == 0;
+            if(samples[i]) impulses++;
+            if((samples[i] != 0) != expected || (expected && samples[i] != 32767)) misplaced++;
+        }
+        printf("impulse at %uHz: %u in a second, %u misplaced\n", freq, impulses, misplaced);
+        CHECK(misplaced == 0, "%uHz impulses: %u samples out of place", freq, misplaced);
+        CHECK(impulses == (RATE + period - 1) / period, "%uHz: %u impulses in a second", freq, impulses);
+    }
+}
+
+int main() {
+    test_sine();
+    test_pink();
+    test_sweep();
+    test_impulse();
+    return test_result();
+}
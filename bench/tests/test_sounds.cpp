@@ -0,0 +1,94 @@
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <vector>
+
+#include "pico/stdlib.h"
+#include "test.h"
+#include "sounds.h"
+#include "sound_bank.h"
+
+// The UI sounds decoded from src/sound_bank.h by sounds_mix(), against the
+// clips generate-sound-bank.py synthesised them from, in double precision.
+// A clip replaced with a .wav will fail here, there's nothing to compare with.
+
+static const uint32_t RATE = 48000;
+static const size_t PACKET = 48;
+
+// The tick is worst, at 33dB, as its 12ms is mostly the decoder's step size
+// catching up from silence. The longer clips are around 40dB.
+static const double MIN_SNR_DB = 30.0;
+
+typedef struct {
+    double freq;
+    uint32_t ms;
+} note_t;
+
+typedef struct {
+    const char *name;
+    sound_id_t id;
+    double amplitude;
+    std::vector<note_t> notes;
+} clip_t;
+
+// As generate-sound-bank.py has them
+static const clip_t clips[] = {
+    {"tick", SOUND_TICK, 0.35, {{1500, 12}}},
+    {"mute", SOUND_MUTE, 0.5, {{880, 60}, {587, 90}}},
+    {"unmute", SOUND_UNMUTE, 0.5, {{587, 60}, {880, 90}}},
+    {"boot", SOUND_BOOT, 0.5, {{523, 90}, {659, 90}, {784, 90}, {1047, 250}}},
+};
+
+// tone() from generate-sound-bank.py: a fast attack and exponential decay per note
+static std::vector<double> synthesise(const clip_t &clip) {
+    std::vector<double> samples;
+    for(auto &note : clip.notes) {
+        uint32_t frames = RATE * note.ms / 1000;
+        for(auto n = 0u; n < frames; n++) {
+            double envelope = std::min(1.0, n / 48.0) * exp(-5.0 * n / frames);
+            samples.push_back(round(clip.amplitude * envelope * sin(2.0 * M_PI * note.freq * n / RATE) * 32767));
+        }
+    }
+    return samples;
+}
+
+int main() {
+    for(auto &clip : clips) {
+        std::vector<double> source = synthesise(clip);
+        CHECK(source.size() == sound_bank[clip.id].frames, "%s: %u frames in the bank, %zu synthesised", clip.name,
+            (unsigned)sound_bank[clip.id].frames, source.size());
+
+        // Mixed into silence at full gain, which is 255/256
+        sounds_play(clip.id, 255);
+        std::vector<int16_t> decoded;
+        while(sounds_playing()) {
+            int16_t packet[PACKET * 2] = {};
+            sounds_mix(packet, PACKET);
+            for(auto i = 0u; i < PACKET; i++) decoded.push_back(packet[i * 2]);
+        }
+
+        double signal = 0, noise = 0;
+        size_t frames = std::min(source.size(), decoded.size());
+        for(auto i = 0u; i < frames; i++) {
+            double expected = source[i] * 255.0 / 256.0;
+            signal += expected * expected;
+            noise += (decoded[i] - expected) * (decoded[i] - expected);
+        }
+        double snr = 10.0 * log10(signal / noise);
+        printf("%-6s %5zu frames, SNR %.1fdB\n", clip.name, frames, snr);
+        CHECK(snr >= MIN_SNR_DB, "%s: SNR %.1fdB, expected at least %.0fdB", clip.name, snr, MIN_SNR_DB);
+    }
+
+    // The voice stops where the clip ends, leaving the rest of the packet alone
+    sounds_play(SOUND_TICK, 255);
+    int16_t packet[PACKET * 2];
+    for(auto i = 0u; i < sound_bank[SOUND_TICK].frames / PACKET; i++) sounds_mix(packet, PACKET);
+    for(auto &sample : packet) sample = 1;
+    sounds_mix(packet, PACKET);
+    CHECK(!sounds_playing(), "still playing after the tick");
+    bool untouched = true;
+    for(auto sample : packet) untouched &= sample == 1;
+    CHECK(untouched, "mixed into the packet after the clip ended");
+
+    return test_result();
+}
@@ -0,0 +1,107 @@
+#include <stdint.h>
+#include <math.h>
+#include <complex>
+#include <algorithm>
+
+#include "test.h"
+#include "pico/stdlib.h"
+#include "spectrum.h"
+
+// The fixed point analyser against a double precision DFT of the same Hann
+// windowed block, on the same scale: the radix-4 FFT divides by 4 at each of
+// its 4 stages, so by N, and bins are 0.5dB steps of power, 20 * log10(|X|^2).
+
+static const uint N = SPECTRUM_FFT_SIZE;
+static const double RATE = 48000.0;
+
+// Bins within this much of the peak must match the reference, unless they're
+// down in the FFT's rounding, a few LSBs at its output
+static const double RANGE_DB = 60.0;
+static const double FLOOR_DB = 30.0;
+static const double TOLERANCE_DB = 1.0;
+
+static void reference(const int16_t *samples, double *half_db) {
+    for(auto k = 0u; k < SPECTRUM_BINS; k++) {
+        std::complex<double> sum = 0;
+        for(auto n = 0u; n < N; n++) {
+            double window = 0.5 - 0.5 * cos(2.0 * M_PI * n / N);
+            sum += samples[n] * window * std::polar(1.0, -2.0 * M_PI * k * n / N);
+        }
+        double power = std::norm(sum / (double)N);
+        half_db[k] = power > 0 ? 20.0 * log10(power) : 0;
+    }
+}
+
+static void check_tones(const char *name, const double *freqs, const double *amplitudes, uint count) {
+    int16_t samples[N];
+    for(auto n = 0u; n < N; n++) {
+        double sum = 0;
+        for(auto t = 0u; t < count; t++) {
+            sum += amplitudes[t] * sin(2.0 * M_PI * freqs[t] * n / RATE + t);
+        }
+        samples[n] = (int16_t)lrint(sum);
+    }
+
+    spectrum_frame_t frame;
+    spectrum_analyse(samples, &frame);
+    double expected[SPECTRUM_BINS];
+    reference(samples, expected);
+
+    double peak = *std::max_element(expected, expected + SPECTRUM_BINS);
+    double worst = 0;
+    uint checked = 0;
+    uint8_t checksum = 0;
+    for(auto k = 0u; k < SPECTRUM_BINS; k++) {
+        checksum += frame.bins[k];
+        // 0.5dB steps, truncated
+        double error = (frame.bins[k] - expected[k]) / 2.0;
+        if(expected[k] < peak - RANGE_DB * 2 || expected[k] < FLOOR_DB * 2) continue;
+        checked++;
+        worst = std::max(worst, fabs(error));
+        CHECK(fabs(error) <= TOLERANCE_DB, "%s bin %u: %u, expected %.1f", name, k, frame.bins[k], expected[k]);
+    }
+    printf("%s peak %.1fdB, %u bins checked, worst error %.2fdB\n", name, peak / 2, checked, worst);
+    CHECK(checksum == frame.checksum, "%s checksum %u, expected %u", name, frame.checksum, checksum);
+}
+
+static void check_floor() {
+    // Full scale at bin 16, everything more than 5 bins away is leakage and
+    // rounding, which should stay well down
+    int16_t samples[N];
+    for(auto n = 0u; n < N; n++) {
+        samples[n] = (int16_t)lrint(32767.0 * sin(2.0 * M_PI * 16 * n / N));
+    }
+    spectrum_frame_t frame;
+    spectrum_analyse(samples, &frame);
+
+    uint8_t floor = 0;
+    for(auto k = 0u; k < SPECTRUM_BINS; k++) {
+        if(k < 11 || k > 21) floor = std::max(floor, frame.bins[k]);
+    }
+    printf("full scale sine %.1fdB, highest bin away from it %.1fdB\n", frame.bins[16] / 2.0, floor / 2.0);
+    CHECK(frame.bins[16] >= 154 && frame.bins[16] <= 158, "full scale sine at %u, expected around 156", frame.bins[16]);
+    CHECK(frame.bins[16] - floor >= 2 * 65, "only %.1fdB between the sine and the floor", (frame.bins[16] - floor) / 2.0);
+}
+
+int main() {
+    spectrum_init();
+
+    const double centred[] = {16 * RATE / N};
+    const double amplitude[] = {30000};
+    check_tones("bin centred", centred, amplitude, 1);
+
+    const double between[] = {1000.0};
+    check_tones("1kHz", between, amplitude, 1);
+
+    const double quiet[] = {440.0};
+    const double quiet_amplitude[] = {300};
+    check_tones("440Hz -40dBFS", quiet, quiet_amplitude, 1);
+
+    const double pair[] = {100.0, 5000.0};
+    const double pair_amplitude[] = {16000, 1600};
+    check_tones("100Hz + 5kHz", pair, pair_amplitude, 2);
+
+    check_floor();
+
+    return test_result();
+}
@@ -0,0 +1,105 @@
+#include <stdint.h>
+#include <math.h>
+#include <algorithm>
+
+#include "pico/stdlib.h"
+#include "test.h"
+#include "vbass.h"
+#include "siggen.h"
+
+// Virtual bass at 150Hz and 0dB, the harmonic distortion it adds measured off
+// the output the way generate-vbass.py measures its model: half a second of a
+// tone in 1ms packets, analysed over the last quarter second. Levels are relative to
+// the input tone, and should match what the script prints and the README
+// quotes, with the 5th harmonic and everything else well down. The tones come
+// from siggen.cpp.
+
+static const double RATE = 48000.0;
+static const size_t PACKET = 48;
+static const size_t FRAMES = 24000;
+// The last quarter of a second, as the script measures it
+static const size_t WINDOW = FRAMES / 2;
+
+static const double TOLERANCE_DB = 0.3;
+
+typedef struct {
+    uint16_t freq;
+    int8_t level_db;
+    // Fundamental, H2, H3, H4 as printed by generate-vbass.py
+    double expected_db[4];
+    // Ceilings for H5 and everything that isn't H1-H5
+    double max_h5_db;
+    double max_other_db;
+} tone_t;
+
+static const tone_t tones[] = {
+    {40,   -6, {-23.0,  -7.2,  -9.4, -14.9}, -90, -70},
+    {60,   -6, {-16.0,  -5.9,  -8.7, -14.5}, -90, -70},
+    {100,  -6, { -7.8,  -5.3,  -8.5, -14.4}, -90, -70},
+    {140,  -6, { -3.7,  -6.8, -10.1, -16.1}, -90, -70},
+    {60,  -30, {-16.0,  -6.0,  -8.7, -14.5}, -75, -50},
+    // Above the crossover it passes through, all but untouched
+    {1000, -6, { +0.1, -77.3, -78.0, -85.7}, -90, -70},
+};
+
+static double level(const int16_t *samples, double freq) {
+    double re = 0, im = 0;
+    for(auto i = 0u; i < WINDOW; i++) {
+        double phase = 2.0 * M_PI * freq * i / RATE;
+        re += samples[i] * cos(phase);
+        im += samples[i] * sin(phase);
+    }
+    return 2.0 * hypot(re, im) / WINDOW;
+}
+
+static void check_tone(const tone_t *tone) {
+    vbass_config_t config = {false, 150, 0};
+    vbass_set_config(&config);
+    config.enabled = true;
+    vbass_set_config(&config);
+
+    static int16_t window[WINDOW];
+    double amplitude = 32767.0 * pow(10.0, tone->level_db / 20.0);
+    siggen_config_t signal = {SIGGEN_SINE, tone->level_db, tone->freq, 0, 0};
+    siggen_start(&signal, RATE);
+    bool channels_match = true;
+    for(auto start = 0u; start < FRAMES; start += PACKET) {
+        int16_t packet[PACKET * 2];
+        siggen_fill(packet, PACKET);
+        vbass_process(packet, PACKET);
+        for(auto i = 0u; i < PACKET; i++) {
+            if(start + i >= FRAMES - WINDOW) window[start + i - (FRAMES - WINDOW)] = packet[i * 2];
+            channels_match &= packet[i * 2] == packet[i * 2 + 1];
+        }
+    }
+    CHECK(channels_match, "%uHz: left and right differ", tone->freq);
+
+    double harmonics[5];
+    double sum_squares = 0, total_squares = 0;
+    for(auto n = 0u; n < 5; n++) {
+        harmonics[n] = level(window, tone->freq * (n + 1));
+        sum_squares += harmonics[n] * harmonics[n];
+    }
+    for(auto i = 0u; i < WINDOW; i++) total_squares += (double)window[i] * window[i];
+    double total = sqrt(2.0 * total_squares / WINDOW);
+    double other = db(sqrt(std::max(0.0, total * total - sum_squares)) / amplitude);
+    double h5 = db(harmonics[4] / amplitude);
+
+    printf("%5uHz %+3ddBFS: fundamental %+6.1f", tone->freq, tone->level_db, db(harmonics[0] / amplitude));
+    for(auto n = 1u; n < 5; n++) printf(" H%u %+6.1f", n + 1, db(harmonics[n] / amplitude));
+    printf(" other %+6.1fdB\n", other);
+
+    for(auto n = 0u; n < 4; n++) {
+        double measured = db(harmonics[n] / amplitude);
+        CHECK(fabs(measured - tone->expected_db[n]) <= TOLERANCE_DB, "%uHz %+ddBFS H%u %+.1fdB, expected %+.1fdB",
+            tone->freq, tone->level_db, n + 1, measured, tone->expected_db[n]);
+    }
+    CHECK(h5 <= tone->max_h5_db, "%uHz %+ddBFS H5 %+.1fdB, expected under %+.0fdB", tone->freq, tone->level_db, h5, tone->max_h5_db);
+    CHECK(other <= tone->max_other_db, "%uHz %+ddBFS everything else %+.1fdB, expected under %+.0fdB",
+        tone->freq, tone->level_db, other, tone->max_other_db);
+}
+
+int main() {
+    for(auto &tone : tones) check_tone(&tone);
+    return test_result();
+}
@@ -0,0 +1,69 @@
+import math
+import sys
+
+# Generates src/halfband_taps.h, the 2x interpolation filter used when
+# AUDIO_OVERSAMPLE_2X runs I2S at 96kHz. A Kaiser windowed halfband: every
+# other tap is zero and the rest are symmetric, so only the unique odd taps
+# are stored. Prints the passband ripple and stopband rejection of the
+# quantised taps as it goes, eg: python3 generate-halfband.py 16
+
+INPUT_RATE = 48000
+PASSBAND = 20000        # Hz, with the stopband mirrored about 24kHz from 28kHz
+ATTENUATION = 80        # dB, sets the Kaiser window
+COEFF_BITS = 14         # Q14, so a full scale sum of taps can't overflow 32 bits
+OUTPUT = "src/halfband_taps.h"
+
+TAPS = int(sys.argv[1]) if len(sys.argv) > 1 else 16   # Unique taps, M
+
+
+def bessel_i0(x):
+    total, term, k = 1.0, 1.0, 1
+    while term > 1e-12 * total:
+        term *= (x / (2 * k)) ** 2
+        total += term
+        k += 1
+    return total
+
+
+def design(m):
+    """Odd taps g[1..m] of a 4m-1 tap halfband, scaled by 2 for the interpolation gain."""
+    n = 4 * m - 1
+    centre = (n - 1) / 2
+    beta = 0.1102 * (ATTENUATION - 8.7)
+    taps = []
+    for j in range(1, m + 1):
+        offset = 2 * j - 1
+        sinc = math.sin(math.pi * offset / 2) / (math.pi * offset / 2)
+        window = bessel_i0(beta * math.sqrt(1 - (offset / (centre + 1)) ** 2)) / bessel_i0(beta)
+        taps.append(sinc * window)
+    return taps
+
+
+def response(coeffs, freq):
+    """Gain of the interpolator at freq (Hz, at the 96kHz output rate), relative to the passband."""
+    w = 2 * math.pi * freq / (2 * INPUT_RATE)
+    # Centre tap 1.0 (0.5 doubled) plus the symmetric odd taps
+    h = 1.0 + sum(2 * c * math.cos(w * (2 * j - 1)) for j, c in enumerate(coeffs, 1))
+    return abs(h) / 2
+
+
+taps = design(TAPS)
+quantised = [round(t * (1 << COEFF_BITS)) for t in taps]
+coeffs = [q / (1 << COEFF_BITS) for q in quantised]
+
+passband = [response(coeffs, f) for f in range(0, PASSBAND + 1, 50)]
+stopband = [response(coeffs, f) for f in range(2 * INPUT_RATE // 2 - PASSBAND, INPUT_RATE + 1, 50)]
+ripple = 20 * math.log10(max(passband) / min(passband))
+rejection = -20 * math.log10(max(stopband))
+print(f"{4 * TAPS - 1} taps, {TAPS} multiplies per output pair per channel")
+print(f"passband ripple {ripple:.4f}dB to {PASSBAND}Hz, stopband rejection {rejection:.1f}dB from {INPUT_RATE - PASSBAND}Hz")
+
+with open(OUTPUT, "w") as f:
+    f.write("// Generated by generate-halfband.py, do not edit\n")
+    f.write("#pragma once\n#include <stdint.h>\n\n")
+    f.write(f"// {4 * TAPS - 1} tap halfband, passband ripple {ripple:.4f}dB to {PASSBAND}Hz,\n")
+    f.write(f"// stopband rejection {rejection:.1f}dB from {INPUT_RATE - PASSBAND}Hz\n")
+    f.write(f"static const uint32_t HALFBAND_COEFF_BITS = {COEFF_BITS};\n")
+    f.write(f"static const int16_t halfband_taps[{TAPS}] = {{\n")
+    f.write("    " + ", ".join(str(q) for q in quantised) + "\n")
+    f.write("};\n")
@@ -0,0 +1,71 @@
+import math
+
+# Generates src/loudness_table.h, the shelf gains for loudness compensated
+# volume. As the volume comes down, a low shelf and a (smaller) high shelf are
+# raised to follow the equal loudness contours, so the cabinet keeps its bass
+# at low levels. There's an entry for each of the 256 gains volume_ramp[] in
+# src/main.cpp can hand the conversion kernel. Prints the response at a few
+# of them as it goes.
+
+SAMPLE_RATE = 48000
+OUTPUT = "src/loudness_table.h"
+
+BASS_HZ = 120           # Low shelf corner
+TREBLE_HZ = 8000        # High shelf corner
+BASS_DB_PER_DB = 0.4    # Boost per dB of attenuation
+TREBLE_DB_PER_DB = 0.1
+BASS_MAX_DB = 12
+TREBLE_MAX_DB = 4
+
+COEFF_BITS = 15         # One pole coefficients, Q15
+GAIN_BITS = 12          # Shelf gains above unity, Q12
+
+
+def one_pole(freq):
+    """k for lp += k * (x - lp), with its -3dB point at freq."""
+    return 1 - math.exp(-2 * math.pi * freq / SAMPLE_RATE)
+
+
+def response_db(k_bass, k_treble, bass, treble, freq):
+    """y = x + bass * lowpass(x) + treble * (x - lowpass(x)), at freq."""
+    z = complex(math.cos(2 * math.pi * freq / SAMPLE_RATE), math.sin(2 * math.pi * freq / SAMPLE_RATE))
+    low = k_bass / (1 - (1 - k_bass) / z)
+    high = 1 - k_treble / (1 - (1 - k_treble) / z)
+    return 20 * math.log10(abs(1 + bass * low + treble * high))
+
+
+k_bass = round(one_pole(BASS_HZ) * (1 << COEFF_BITS))
+k_treble = round(one_pole(TREBLE_HZ) * (1 << COEFF_BITS))
+
+steps = []
+for gain in range(256):
+    # Silent steps take the most compensation, it's never heard
+    attenuation = -20 * math.log10(gain / 255) if gain else math.inf
+    bass_db = min(BASS_MAX_DB, BASS_DB_PER_DB * max(0.0, attenuation))
+    treble_db = min(TREBLE_MAX_DB, TREBLE_DB_PER_DB * max(0.0, attenuation))
+    bass = round((10 ** (bass_db / 20) - 1) * (1 << GAIN_BITS))
+    treble = round((10 ** (treble_db / 20) - 1) * (1 << GAIN_BITS))
+    steps.append((bass, treble, attenuation, bass_db, treble_db))
+
+print(f"low shelf {BASS_HZ}Hz k={k_bass}, high shelf {TREBLE_HZ}Hz k={k_treble}")
+for gain in (1, 2, 4, 8, 16, 32, 64, 128, 192, 255):
+    bass, treble, attenuation, bass_db, treble_db = steps[gain]
+    kb, kt = k_bass / (1 << COEFF_BITS), k_treble / (1 << COEFF_BITS)
+    b, t = bass / (1 << GAIN_BITS), treble / (1 << GAIN_BITS)
+    curve = " ".join(f"{f}Hz {response_db(kb, kt, b, t, f):+.1f}" for f in (50, 200, 1000, 6000, 16000))
+    print(f"gain {gain:3} {-attenuation:+.1f}dB target bass {bass_db:+.1f} treble {treble_db:+.1f}: {curve}")
+
+with open(OUTPUT, "w") as f:
+    f.write("// Generated by generate-loudness.py, do not edit\n")
+    f.write("#pragma once\n#include <stdint.h>\n\n")
+    f.write(f"// One pole low passes at {BASS_HZ}Hz and {TREBLE_HZ}Hz, Q{COEFF_BITS}\n")
+    f.write(f"static const uint32_t LOUDNESS_COEFF_BITS = {COEFF_BITS};\n")
+    f.write(f"static const int32_t LOUDNESS_K_BASS = {k_bass};\n")
+    f.write(f"static const int32_t LOUDNESS_K_TREBLE = {k_treble};\n\n")
+    f.write(f"// Shelf gains above unity for each volume gain, Q{GAIN_BITS}, up to {BASS_MAX_DB}dB bass and {TREBLE_MAX_DB}dB treble\n")
+    f.write(f"static const uint32_t LOUDNESS_GAIN_BITS = {GAIN_BITS};\n")
+    f.write("struct loudness_step_t {\n    int16_t bass;\n    int16_t treble;\n};\n\n")
+    f.write(f"static const loudness_step_t loudness_table[{len(steps)}] = {{\n")
+    for i in range(0, len(steps), 8):
+        f.write("    " + " ".join(f"{{{b}, {t}}}," for b, t, *_ in steps[i:i + 8]) + "\n")
+    f.write("};\n")
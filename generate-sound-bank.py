@@ -0,0 +1,103 @@
+import math
+import sys
+import wave
+
+# Generates src/sound_bank.h, the UI feedback sounds as 48kHz mono IMA-ADPCM.
+# Clips are synthesised by default, pass name=file.wav (16-bit mono 48kHz)
+# to replace one, eg: python3 generate-sound-bank.py boot=chime.wav
+
+SAMPLE_RATE = 48000
+OUTPUT = "src/sound_bank.h"
+
+INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8]
+
+STEP_TABLE = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767
+]
+
+
+def tone(notes, amplitude=0.5):
+    """Notes are (frequency, milliseconds), each with a fast attack and exponential decay."""
+    samples = []
+    for freq, ms in notes:
+        frames = SAMPLE_RATE * ms // 1000
+        for n in range(frames):
+            t = n / SAMPLE_RATE
+            envelope = min(1.0, n / 48) * math.exp(-5.0 * n / frames)
+            samples.append(amplitude * envelope * math.sin(2 * math.pi * freq * t))
+    return [int(round(s * 32767)) for s in samples]
+
+
+CLIPS = {
+    "tick": tone([(1500, 12)], 0.35),
+    "mute": tone([(880, 60), (587, 90)]),
+    "unmute": tone([(587, 60), (880, 90)]),
+    "boot": tone([(523, 90), (659, 90), (784, 90), (1047, 250)]),
+}
+
+
+def read_wav(path):
+    with wave.open(path, "rb") as w:
+        if w.getnchannels() != 1 or w.getsampwidth() != 2 or w.getframerate() != SAMPLE_RATE:
+            raise SystemExit(f"{path}: must be 16-bit mono {SAMPLE_RATE}Hz")
+        data = w.readframes(w.getnframes())
+    return [int.from_bytes(data[i:i + 2], "little", signed=True) for i in range(0, len(data), 2)]
+
+
+def encode(samples):
+    """IMA-ADPCM, low nibble first, starting from predictor 0 index 0 like the decoder."""
+    predictor = 0
+    index = 0
+    nibbles = []
+    for sample in samples:
+        step = STEP_TABLE[index]
+        diff = sample - predictor
+        code = 8 if diff < 0 else 0
+        diff = abs(diff)
+        delta = step >> 3
+        if diff >= step:
+            code |= 4
+            diff -= step
+            delta += step
+        if diff >= step >> 1:
+            code |= 2
+            diff -= step >> 1
+            delta += step >> 1
+        if diff >= step >> 2:
+            code |= 1
+            delta += step >> 2
+        predictor += -delta if code & 8 else delta
+        predictor = max(-32768, min(32767, predictor))
+        index = max(0, min(88, index + INDEX_TABLE[code]))
+        nibbles.append(code)
+    if len(nibbles) & 1:
+        nibbles.append(0)
+    return bytes(nibbles[i] | (nibbles[i + 1] << 4) for i in range(0, len(nibbles), 2))
+
+
+for arg in sys.argv[1:]:
+    name, path = arg.split("=", 1)
+    if name not in CLIPS:
+        raise SystemExit(f"unknown clip {name}, expected one of {', '.join(CLIPS)}")
+    CLIPS[name] = read_wav(path)
+
+with open(OUTPUT, "w") as f:
+    f.write("// Generated by generate-sound-bank.py, do not edit\n")
+    f.write("#pragma once\n#include \"sounds.h\"\n\n")
+    for name, samples in CLIPS.items():
+        data = encode(samples)
+        f.write(f"// {len(samples)} frames, {len(samples) * 1000 // SAMPLE_RATE}ms\n")
+        f.write(f"static const uint8_t sound_{name}_adpcm[{len(data)}] = {{\n")
+        for i in range(0, len(data), 16):
+            f.write("    " + ", ".join(f"0x{b:02x}" for b in data[i:i + 16]) + ",\n")
+        f.write("};\n\n")
+    f.write("static const sound_clip_t sound_bank[SOUND_COUNT] = {\n")
+    for name, samples in CLIPS.items():
+        f.write(f"    {{sound_{name}_adpcm, {len(samples)}}},\n")
+    f.write("};\n")
@@ -0,0 +1,221 @@
+import math
+import sys
+
+# Generates src/vbass_table.h, the coefficients for the virtual bass stage,
+# then runs the same fixed point processing as src/vbass.cpp over test tones
+# and prints the harmonics it makes. The low band is split off the mono sum
+# with a 4th order Butterworth low pass, normalised by its envelope and put
+# through Chebyshev polynomials, so a sine at any level turns into just its
+# 2nd, 3rd and 4th harmonics. Those are high passed at half the crossover and
+# mixed back into each channel, which is high passed at the crossover (2nd
+# order Butterworth) to keep the drivers from trying to play the low band.
+# The filters are Chamberlin state variable filters, which hold their
+# precision at low frequencies with Q15 coefficients.
+#
+# Usage: generate-vbass.py [CUTOFF_HZ [GAIN_DB]], which only change the
+# analysis, the table always covers every setting.
+
+SAMPLE_RATE = 48000
+OUTPUT = "src/vbass_table.h"
+
+CUTOFF_MIN = 40         # Hz, crossover settings in 10Hz steps
+CUTOFF_MAX = 250
+CUTOFF_STEP = 10
+GAIN_MIN = -12          # dB, harmonic level settings in 1dB steps
+GAIN_MAX = 12
+
+WEIGHTS = (0.6, 0.4, 0.2)   # 2nd, 3rd and 4th harmonic, for a sine at 0dB gain
+HOLD_BLOCKS = 32        # Envelope holds its peak for this many calls (~ms), the longest period
+RELEASE_MS = 50         # then falls with this time constant
+
+# Damping of each state variable filter, 1/Q
+LOWPASS_DAMPING = (2 * math.cos(math.pi * 1 / 8), 2 * math.cos(math.pi * 3 / 8))
+HIGHPASS_DAMPING = math.sqrt(2)
+
+COEFF_BITS = 15
+GAIN_BITS = 12
+HEADROOM_BITS = 2       # Filters run on samples shifted up 14 bits, not 16, for the resonant section
+
+CUTOFF = int(sys.argv[1]) if len(sys.argv) > 1 else 150
+GAIN = int(sys.argv[2]) if len(sys.argv) > 2 else 0
+
+
+def one_pole(freq):
+    return 1 - math.exp(-2 * math.pi * freq / SAMPLE_RATE)
+
+
+def svf(freq):
+    return 2 * math.sin(math.pi * freq / SAMPLE_RATE)
+
+
+def q(value, bits=COEFF_BITS):
+    return round(value * (1 << bits))
+
+
+cutoffs = list(range(CUTOFF_MIN, CUTOFF_MAX + 1, CUTOFF_STEP))
+crossover_f = [q(svf(f)) for f in cutoffs]
+harmonic_k = [q(one_pole(f / 2)) for f in cutoffs]
+gains = [q(10 ** (db / 20), GAIN_BITS) for db in range(GAIN_MIN, GAIN_MAX + 1)]
+weights = [q(w) for w in WEIGHTS]
+# Halved, since 1/Q can be up to 2
+lowpass_damping = [q(d / 2) for d in LOWPASS_DAMPING]
+highpass_damping = q(HIGHPASS_DAMPING / 2)
+k_release = q(1 - math.exp(-1000 / (RELEASE_MS * SAMPLE_RATE)))
+
+
+# Bit exact with src/fixed.h and src/vbass.cpp
+
+def sat16(v):
+    return max(-32768, min(32767, v))
+
+
+def sat32(v):
+    return max(-(1 << 31), min((1 << 31) - 1, v))
+
+
+def shr_round(v, shift):
+    return (v >> shift) + ((v >> (shift - 1)) & 1)
+
+
+def mul_q31_q15(a, b):
+    return sat32((a * b + (1 << 14)) >> 15)
+
+
+def lowpass(lp, x, k):
+    return sat32(lp + mul_q31_q15(sat32(x - lp), k))
+
+
+def svf_step(state, x, f, half_damping):
+    """One sample through a state variable filter, returns the new [lp, bp] and the high pass output."""
+    lp, bp = state
+    lp = sat32(lp + mul_q31_q15(bp, f))
+    damping = mul_q31_q15(bp, half_damping)
+    hp = sat32(sat32(sat32(x - lp) - damping) - damping)
+    bp = sat32(bp + mul_q31_q15(hp, f))
+    return [lp, bp], hp
+
+
+def divide(a, b):
+    # C division truncates towards zero
+    quotient = abs(a) // abs(b)
+    return quotient if (a < 0) == (b < 0) else -quotient
+
+
+class VirtualBass:
+    def __init__(self, cutoff, gain_db):
+        index = (cutoff - CUTOFF_MIN) // CUTOFF_STEP
+        self.f = crossover_f[index]
+        self.kh = harmonic_k[index]
+        self.gain = gains[gain_db - GAIN_MIN]
+        self.lowpass = [[0, 0], [0, 0]]
+        self.highpass = [[0, 0], [0, 0]]
+        self.env = 0
+        self.harm_lp = 0
+        self.hold = [0] * HOLD_BLOCKS
+        self.hold_index = 0
+
+    def process(self, samples):
+        hold = max(self.hold)
+        peak = 0
+        out = []
+        for left, right in samples:
+            frame = [left, right]
+            shift = 16 - HEADROOM_BITS
+            high = [0, 0]
+            for c in range(2):
+                self.highpass[c], hp = svf_step(self.highpass[c], frame[c] << shift, self.f, highpass_damping)
+                high[c] = shr_round(hp, shift)
+            low = (left + right) << (shift - 1)
+            for section in range(2):
+                self.lowpass[section], _ = svf_step(self.lowpass[section], low, self.f, lowpass_damping[section])
+                low = self.lowpass[section][0]
+            b = sat16(shr_round(low, shift))
+            a = min(abs(b), 32767)
+            peak = max(peak, a)
+            if a << 16 >= self.env:
+                self.env = a << 16
+            else:
+                self.env = sat32(self.env + mul_q31_q15(sat32((max(hold, peak) << 16) - self.env), k_release))
+            e = shr_round(self.env, 16)
+
+            x = divide(b << 15, e) if e else 0
+            t1, t2 = x, ((x * x) >> 14) - 32768
+            t3 = ((x * t2) >> 14) - t1
+            t4 = ((x * t3) >> 14) - t2
+            h = weights[0] * t2 + weights[1] * t3 + weights[2] * t4
+            harm = sat16(shr_round(shr_round(h, 15) * e, 15))
+            self.harm_lp = lowpass(self.harm_lp, harm << 16, self.kh)
+            add = shr_round((harm - shr_round(self.harm_lp, 16)) * self.gain, GAIN_BITS)
+            out.append(tuple(sat16(high[c] + add) for c in range(2)))
+        self.hold[self.hold_index] = peak
+        self.hold_index = (self.hold_index + 1) % HOLD_BLOCKS
+        return out
+
+
+def level(signal, freq):
+    """Amplitude of freq in signal, which must hold a whole number of its cycles."""
+    w = 2 * math.pi * freq / SAMPLE_RATE
+    re = sum(s * math.cos(w * i) for i, s in enumerate(signal))
+    im = sum(s * math.sin(w * i) for i, s in enumerate(signal))
+    return 2 * math.hypot(re, im) / len(signal)
+
+
+def db(ratio):
+    return 20 * math.log10(ratio) if ratio > 0 else -math.inf
+
+
+def analyse(freq, level_db):
+    # Half a second in 1ms packets, measured over the last quarter, a whole number of
+    # cycles for multiples of 4Hz
+    amplitude = 32767 * 10 ** (level_db / 20)
+    tone = [round(amplitude * math.sin(2 * math.pi * freq * i / SAMPLE_RATE)) for i in range(SAMPLE_RATE // 2)]
+    vbass = VirtualBass(CUTOFF, GAIN)
+    out = []
+    for start in range(0, len(tone), 48):
+        out += vbass.process([(s, s) for s in tone[start:start + 48]])
+    window = [left for left, _ in out[-SAMPLE_RATE // 4:]]
+
+    harmonics = [level(window, freq * n) for n in range(1, 6)]
+    total = math.sqrt(2 * sum(s * s for s in window) / len(window))
+    other = math.sqrt(max(0.0, total ** 2 - sum(h ** 2 for h in harmonics)))
+    added = math.sqrt(sum(h ** 2 for h in harmonics[1:]))
+    line = f"{freq:4}Hz {level_db:+3}dBFS: fundamental {db(harmonics[0] / amplitude):+6.1f}"
+    line += "".join(f" H{n} {db(h / amplitude):+6.1f}" for n, h in enumerate(harmonics[1:], 2))
+    line += f" harmonics {db(added / amplitude):+5.1f} other {db(other / amplitude):+6.1f}dB"
+    print(line)
+
+
+print(f"{len(cutoffs)} crossovers {CUTOFF_MIN}-{CUTOFF_MAX}Hz, weights {' '.join(str(w) for w in weights)}, "
+      f"release k={k_release}, hold {HOLD_BLOCKS} blocks")
+print(f"at {CUTOFF}Hz {GAIN:+}dB, relative to the input tone:")
+for freq, level_db in ((40, -6), (60, -6), (80, -6), (100, -6), (120, -6), (140, -6), (200, -6),
+                       (60, -30), (60, -60), (1000, -6)):
+    analyse(freq, level_db)
+
+with open(OUTPUT, "w") as f:
+    f.write("// Generated by generate-vbass.py, do not edit\n")
+    f.write("#pragma once\n#include <stdint.h>\n\n")
+    f.write(f"// State variable filter coefficients, Q{COEFF_BITS}, for crossovers from {CUTOFF_MIN}Hz to {CUTOFF_MAX}Hz\n")
+    f.write(f"// in {CUTOFF_STEP}Hz steps, and one pole coefficients for the harmonic high pass at half of each\n")
+    f.write(f"static const uint32_t VBASS_CUTOFF_MIN = {CUTOFF_MIN};\n")
+    f.write(f"static const uint32_t VBASS_CUTOFF_MAX = {CUTOFF_MAX};\n")
+    f.write(f"static const uint32_t VBASS_CUTOFF_STEP = {CUTOFF_STEP};\n")
+    f.write(f"static const int16_t vbass_crossover_f[{len(cutoffs)}] = {{\n")
+    f.write("    " + ", ".join(str(k) for k in crossover_f) + "\n};\n")
+    f.write(f"static const int16_t vbass_harmonic_k[{len(cutoffs)}] = {{\n")
+    f.write("    " + ", ".join(str(k) for k in harmonic_k) + "\n};\n\n")
+    f.write(f"// Half the damping of the low pass sections and the high pass, Q{COEFF_BITS}\n")
+    f.write(f"static const int32_t vbass_lowpass_damping[2] = {{{', '.join(str(d) for d in lowpass_damping)}}};\n")
+    f.write(f"static const int32_t VBASS_HIGHPASS_DAMPING = {highpass_damping};\n")
+    f.write(f"static const uint32_t VBASS_HEADROOM_BITS = {HEADROOM_BITS};\n\n")
+    f.write(f"// Envelope peak hold in calls, then a {RELEASE_MS}ms release, Q{COEFF_BITS}\n")
+    f.write(f"static const uint32_t VBASS_HOLD_BLOCKS = {HOLD_BLOCKS};\n")
+    f.write(f"static const int32_t VBASS_K_RELEASE = {k_release};\n\n")
+    f.write(f"// 2nd, 3rd and 4th harmonic weights, Q{COEFF_BITS}\n")
+    f.write(f"static const int32_t vbass_weights[3] = {{{', '.join(str(w) for w in weights)}}};\n\n")
+    f.write(f"// Harmonic level from {GAIN_MIN}dB to {GAIN_MAX}dB, Q{GAIN_BITS}\n")
+    f.write(f"static const int32_t VBASS_GAIN_MIN = {GAIN_MIN};\n")
+    f.write(f"static const int32_t VBASS_GAIN_MAX = {GAIN_MAX};\n")
+    f.write(f"static const uint32_t VBASS_GAIN_BITS = {GAIN_BITS};\n")
+    f.write(f"static const int16_t vbass_gains[{len(gains)}] = {{\n")
+    f.write("    " + ", ".join(str(g) for g in gains) + "\n};\n")
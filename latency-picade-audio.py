@@ -0,0 +1,63 @@
+import glob
+import re
+import sys
+
+import numpy
+import serial
+import sounddevice
+
+# Usage: latency-picade-audio.py CAPTURE_DEVICE [RUNS]
+# Checks the latency the board reports against a loopback measurement.
+# Cable the board's output into the line input of another sound card, then
+# play clicks through the board while recording that input. Recording and
+# playback share one PortAudio stream so they start together; PortAudio's own
+# estimate of the host side latency is subtracted from each measurement.
+# List devices with: python3 -m sounddevice
+
+SAMPLE_RATE = 48000
+CLICK_INTERVAL = SAMPLE_RATE // 2
+
+
+def reported_latency_us():
+    picade = glob.glob("/dev/serial/by-id/usb-Pimoroni_Picade_USB_Audio_*")[0]
+    device = serial.Serial(picade, timeout=1)
+    device.write(b"multiverse:_lat")
+    line = device.readline().decode()
+    device.close()
+    return int(re.search(r"reported (\d+)", line).group(1)), line.strip()
+
+
+def measure(output, capture):
+    # A few clicks, half a second apart, after half a second of settling
+    clicks = numpy.zeros((CLICK_INTERVAL * 6, 2), dtype=numpy.float32)
+    for n in range(1, 5):
+        clicks[n * CLICK_INTERVAL:n * CLICK_INTERVAL + 4] = 0.5
+    recorded = sounddevice.playrec(clicks, SAMPLE_RATE, channels=1, device=(capture, output), blocking=True)
+    host_in = sounddevice.query_devices(capture)["default_low_input_latency"]
+    host_out = sounddevice.query_devices(output)["default_low_output_latency"]
+
+    delays = []
+    for n in range(1, 5):
+        start = n * CLICK_INTERVAL
+        window = numpy.abs(recorded[start:start + CLICK_INTERVAL // 2, 0])
+        if window.max() < 0.01:
+            continue
+        # First sample past half the peak, robust against ringing on the way in
+        delays.append(numpy.argmax(window > window.max() / 2))
+    if not delays:
+        raise SystemExit("no clicks captured, check the loopback cable and capture device")
+    measured_us = numpy.median(delays) * 1e6 / SAMPLE_RATE
+    return measured_us, (host_in + host_out) * 1e6
+
+
+capture = sys.argv[1]
+runs = int(sys.argv[2]) if len(sys.argv) > 2 else 5
+output = [d["name"] for d in sounddevice.query_devices() if "Picade" in d["name"] and d["max_output_channels"]][0]
+
+for run in range(runs):
+    measured_us, host_us = measure(output, capture)
+    reported_us, status = reported_latency_us()
+    device_us = measured_us - host_us
+    print(f"measured {measured_us:.0f}us host {host_us:.0f}us device {device_us:.0f}us "
+          f"reported {reported_us}us error {device_us - reported_us:+.0f}us")
+    print(f"  {status}")
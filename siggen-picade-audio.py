@@ -0,0 +1,31 @@
+import glob
+import struct
+import sys
+
+import serial
+
+# Usage: siggen-picade-audio.py sine|pink|sweep|impulse|off [args...]
+#   sine FREQ LEVEL_DB DURATION_MS
+#   pink LEVEL_DB DURATION_MS
+#   sweep START_FREQ END_FREQ LEVEL_DB DURATION_MS
+#   impulse RATE_HZ LEVEL_DB DURATION_MS
+# A duration of 0 plays until stopped with "off".
+
+TYPES = {"off": 0, "sine": 1, "pink": 2, "sweep": 3, "impulse": 4}
+
+kind = sys.argv[1]
+args = [int(a) for a in sys.argv[2:]]
+
+freq, freq_end, level, duration = 0, 0, 0, 0
+if kind in ("sine", "impulse"):
+    freq, level, duration = args
+elif kind == "pink":
+    level, duration = args
+elif kind == "sweep":
+    freq, freq_end, level, duration = args
+
+picade = glob.glob("/dev/serial/by-id/usb-Pimoroni_Picade_USB_Audio_*")[0]
+
+device = serial.Serial(picade)
+device.write(b"multiverse:_gen" + struct.pack("<BbHHH", TYPES[kind], level, freq, freq_end, duration))
+device.close()
@@ -0,0 +1,312 @@
+import glob
+import random
+import sys
+
+import serial
+
+# Usage: simulate-picade-audio.py PROFILE [TRACE] [SEED]
+# Runs the firmware's main loop in virtual time, with each task's cost taken
+# from the board's own profile, and reports the worst gaps between tasks,
+# lost USB packets and I2S underruns.
+#
+# PROFILE is the output of the `_tsk` command saved to a file, or "board" to
+# fetch it from a connected board. Profile while doing whatever should be
+# covered, so every task's slowest case shows up in its histogram.
+#
+# TRACE is CSV of "time_us,event[,frames]", eg: exported from a USB capture,
+# with events audio (a speaker packet), control (a control request), cdc (a
+# serial command), knob, settings (a settings write) and update. Without one,
+# 48 frame packets arrive every millisecond for ten seconds, with a control
+# request, serial command and knob turn all landing together every 97ms so
+# they sweep across the loop.
+#
+# Tasks cost the median of their histogram while idle, and their maximum when
+# they have an event to handle. Pass SEED to draw costs from the histograms
+# instead, repeatably. Runs of idle passes are skipped over in one step.
+
+CLOCK_MHZ = 250
+SAMPLE_RATE = 48000
+
+# Must match the order of the main loop in src/main.cpp
+LOOP = ["health", "tud", "notify", "audio", "serial", "spectrum", "led", "settings", "latency", "update"]
+
+# Which task handles each event first, and where it goes after that
+ROUTE = {
+    "audio": ["tud", "audio"],
+    "control": ["tud"],
+    "cdc": ["tud", "serial"],
+    "knob": ["audio"],
+    "settings": ["settings"],
+    "update": ["update"],
+}
+
+# pico_audio_i2s consumer pool, AUDIO_I2S_BUFFERS and AUDIO_I2S_BUFFER_FRAMES in CMakeLists.txt
+I2S_BUFFERS = 2
+I2S_BUFFER_FRAMES = 256
+I2S_BUFFER_US = I2S_BUFFER_FRAMES * 1e6 / SAMPLE_RATE
+
+
+def read_profile(source):
+    if source == "board":
+        picade = glob.glob("/dev/serial/by-id/usb-Pimoroni_Picade_USB_Audio_*")[0]
+        device = serial.Serial(picade, timeout=1)
+        device.write(b"multiverse:_tsk")
+        lines = [line.decode() for line in device.readlines()]
+        device.close()
+    else:
+        lines = open(source).readlines()
+
+    tasks = {}
+    measured = ""
+    for line in lines:
+        words = line.split()
+        if not words:
+            continue
+        if words[0] == "loops":
+            measured = line.strip()
+        elif words[0] in LOOP:
+            histogram = {}
+            for bucket in words[words.index("hist") + 1:]:
+                b, count = bucket.split(":")
+                histogram[int(b)] = int(count)
+            tasks[words[0]] = (int(words[words.index("max") + 1]), histogram)
+    missing = [name for name in LOOP if name not in tasks or not tasks[name][1]]
+    if missing:
+        raise SystemExit(f"no profile for {', '.join(missing)}")
+    return tasks, measured
+
+
+def read_trace(path):
+    events = []
+    for line in open(path):
+        fields = [field.strip() for field in line.split(",")]
+        if not fields[0] or fields[0].startswith("#"):
+            continue
+        if fields[1] not in ROUTE:
+            raise SystemExit(f"unknown event {fields[1]}, expected one of {', '.join(ROUTE)}")
+        frames = int(fields[2]) if len(fields) > 2 and fields[2] else SAMPLE_RATE // 1000
+        events.append((float(fields[0]), fields[1], frames))
+    return sorted(events)
+
+
+def synthetic_trace():
+    events = [(ms * 1000.0, "audio", SAMPLE_RATE // 1000) for ms in range(10000)]
+    for ms in range(50, 10000, 97):
+        events += [(ms * 1000.0 + 0.5, kind, 0) for kind in ("control", "cdc", "knob")]
+    return sorted(events)
+
+
+class CostModel:
+    def __init__(self, tasks, seed):
+        self.tasks = tasks
+        self.random = random.Random(seed) if seed is not None else None
+        self.splits = {name: self.split(name) for name in tasks}
+
+    def bucket_us(self, bucket, limit):
+        # Middle of the bucket, or a uniform draw from it
+        low, high = 1 << bucket, max(1 << bucket, min((2 << bucket) - 1, limit))
+        cycles = (low + high) / 2 if self.random is None else self.random.uniform(low, high)
+        return cycles / CLOCK_MHZ
+
+    def split(self, name):
+        # Buckets up to and including the median, and from the median up
+        histogram = self.tasks[name][1]
+        buckets = sorted(histogram)
+        calls = sum(histogram.values())
+        seen = 0
+        for i, bucket in enumerate(buckets):
+            seen += histogram[bucket]
+            if seen * 2 >= calls:
+                return buckets[:i + 1], buckets[i:]
+
+    def draw(self, name, buckets):
+        max_cycles, histogram = self.tasks[name]
+        bucket = self.random.choices(buckets, [histogram[b] for b in buckets])[0]
+        return self.bucket_us(bucket, max_cycles)
+
+    def idle(self, name):
+        lower = self.splits[name][0]
+        if self.random is not None:
+            return self.draw(name, lower)
+        return self.bucket_us(lower[-1], self.tasks[name][0])
+
+    def busy(self, name):
+        if self.random is not None:
+            return self.draw(name, self.splits[name][1])
+        return self.tasks[name][0] / CLOCK_MHZ
+
+
+class Simulation:
+    def __init__(self, model, events):
+        self.model = model
+        self.events = events
+        self.next_event = 0
+        self.now = 0.0
+        self.queues = {name: [] for name in LOOP}
+
+        # USB: one packet can wait in the endpoint for tud_task(), then spk_buf for audio_task()
+        self.endpoint = None
+        self.spk_buf = None
+        self.packets = 0
+        self.lost = 0
+        self.overwritten = 0
+
+        # I2S: one buffer plays while the other fills, a full one waits its turn
+        self.free = I2S_BUFFERS
+        self.filling = None
+        self.queued = []
+        self.playing_real = False
+        self.dma_end = I2S_BUFFER_US
+        self.streaming = False
+        self.underruns = 0
+        self.margins = []
+
+        self.blocked = 0
+        self.worst_block_us = 0.0
+        self.last_run = {}
+        self.worst_gap = {}
+        self.worst_loop = (0.0, 0.0)
+        self.since_tud = []
+        self.worst_tud_pass = []
+
+    def arrive(self, time, kind, frames):
+        if kind == "audio":
+            self.packets += 1
+            # Not collected before the next one, the endpoint wasn't re-armed in time
+            if self.endpoint is not None:
+                self.lost += 1
+            self.endpoint = frames
+        else:
+            self.queues[ROUTE[kind][0]].append((kind, frames))
+
+    def dma_complete(self):
+        if self.playing_real:
+            self.free += 1
+        if self.queued:
+            self.margins.append((self.dma_end - self.queued.pop(0), self.dma_end))
+            self.playing_real = True
+            self.streaming = True
+        else:
+            # pico_audio_i2s plays a buffer of silence
+            if self.streaming:
+                self.underruns += 1
+            self.playing_real = False
+        self.dma_end += I2S_BUFFER_US
+
+    def advance(self, to):
+        while True:
+            next_arrival = self.events[self.next_event][0] if self.next_event < len(self.events) else None
+            if next_arrival is not None and next_arrival <= to and next_arrival <= self.dma_end:
+                self.arrive(*self.events[self.next_event])
+                self.next_event += 1
+            elif self.dma_end <= to:
+                self.dma_complete()
+            else:
+                break
+        self.now = to
+
+    def give(self, frames):
+        # The blocking give in audio_i2s_connect()'s consumer pool
+        start = self.now
+        while frames:
+            if self.filling is None:
+                if not self.free:
+                    self.advance(self.dma_end)
+                    continue
+                self.free -= 1
+                self.filling = 0
+            take = min(frames, I2S_BUFFER_FRAMES - self.filling)
+            self.filling += take
+            frames -= take
+            if self.filling == I2S_BUFFER_FRAMES:
+                self.queued.append(self.now)
+                self.filling = None
+        if self.now > start:
+            self.blocked += 1
+            self.worst_block_us = max(self.worst_block_us, self.now - start)
+
+    def run_task(self, name):
+        start = self.now
+        gap = start - self.last_run.get(name, start)
+        if gap > self.worst_gap.get(name, (0.0,))[0]:
+            self.worst_gap[name] = (gap, start)
+            if name == "tud":
+                self.worst_tud_pass = list(self.since_tud)
+        self.last_run[name] = start
+        if name == "tud":
+            self.since_tud = []
+
+        work = self.queues[name]
+        self.queues[name] = []
+        if name == "tud" and self.endpoint is not None:
+            work.append(("audio", self.endpoint))
+            self.endpoint = None
+
+        idle = self.model.idle(name)
+        cost = idle + sum(max(0.0, self.model.busy(name) - idle) for _ in work)
+        self.advance(self.now + cost)
+
+        for kind, frames in work:
+            route = ROUTE[kind]
+            following = route[route.index(name) + 1:] if name in route else []
+            if kind == "audio" and following:
+                if self.spk_buf is not None:
+                    self.overwritten += 1
+                self.spk_buf = frames
+            elif following:
+                self.queues[following[0]].append((kind, frames))
+        if name == "audio" and self.spk_buf is not None:
+            self.give(self.spk_buf)
+            self.spk_buf = None
+
+        self.since_tud.append((name, self.now - start))
+
+    def skip_idle(self):
+        # Passes with nothing to do are all alike, jump to just before the next event
+        if self.endpoint is not None or self.spk_buf is not None or any(self.queues.values()):
+            return
+        if self.next_event >= len(self.events):
+            return
+        passes = int((self.events[self.next_event][0] - self.now) / self.idle_pass_us) - 1
+        if passes > 0:
+            skip = passes * self.idle_pass_us
+            for name in self.last_run:
+                self.last_run[name] += skip
+            self.advance(self.now + skip)
+
+    def run(self, until):
+        self.idle_pass_us = sum(self.model.idle(name) for name in LOOP)
+        while self.now < until:
+            self.skip_idle()
+            start = self.now
+            for name in LOOP:
+                self.run_task(name)
+            if self.now - start > self.worst_loop[0]:
+                self.worst_loop = (self.now - start, start)
+
+
+tasks, measured = read_profile(sys.argv[1])
+events = read_trace(sys.argv[2]) if len(sys.argv) > 2 and sys.argv[2] != "-" else synthetic_trace()
+seed = int(sys.argv[3]) if len(sys.argv) > 3 else None
+
+simulation = Simulation(CostModel(tasks, seed), events)
+simulation.run(events[-1][0] + 1000)
+
+if measured:
+    print(f"measured: {measured}")
+print(f"simulated {simulation.now / 1000:.1f}ms, {simulation.packets} packets")
+print(f"longest loop {simulation.worst_loop[0]:.1f}us at {simulation.worst_loop[1] / 1000:.3f}ms")
+for name in ("tud", "audio", "serial"):
+    gap, at = simulation.worst_gap.get(name, (0.0, 0.0))
+    print(f"longest gap between {name} tasks {gap:.1f}us at {at / 1000:.3f}ms")
+print("  worst tud gap spent in: " + ", ".join(f"{name} {us:.1f}us" for name, us in simulation.worst_tud_pass if us >= 1))
+print(f"packets lost {simulation.lost}, overwritten before audio_task {simulation.overwritten}")
+print(f"give blocked {simulation.blocked} times, longest {simulation.worst_block_us:.1f}us")
+if simulation.margins:
+    margin, at = min(simulation.margins)
+    print(f"i2s underruns {simulation.underruns}, worst margin {margin:.1f}us at {at / 1000:.3f}ms")
+else:
+    print("i2s never started, no audio in the trace")
+misses = simulation.lost + simulation.overwritten + simulation.underruns
+print("deadline misses", misses)
+sys.exit(1 if misses else 0)
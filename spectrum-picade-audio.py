@@ -0,0 +1,52 @@
+import glob
+import serial
+import matplotlib.pyplot as plt
+
+FFT_SIZE = 256
+BINS = FFT_SIZE // 2
+SAMPLE_RATE = 48000
+
+picade = glob.glob("/dev/serial/by-id/usb-Pimoroni_Picade_USB_Audio_*")[0]
+
+device = serial.Serial(picade)
+
+device.write(b"multiverse:_sp1")
+
+
+def read_frame():
+    # Replies to commands share the stream, so resync on the 'SP' header and
+    # only take frames whose length and checksum match
+    while True:
+        if device.read(1) != b"S":
+            continue
+        if device.read(1) != b"P":
+            continue
+        header = device.read(2)
+        if len(header) != 2 or header[1] != BINS:
+            continue
+        bins = device.read(BINS)
+        checksum = device.read(1)
+        if len(checksum) == 1 and sum(bins) % 256 == checksum[0]:
+            return bins
+
+
+freqs = [i * SAMPLE_RATE / FFT_SIZE for i in range(BINS)]
+
+plt.ion()
+figure, axes = plt.subplots()
+line, = axes.plot(freqs, [0] * BINS)
+axes.set_xscale("log")
+axes.set_xlim(SAMPLE_RATE / FFT_SIZE, SAMPLE_RATE / 2)
+axes.set_ylim(-100, 0)
+axes.set_xlabel("Frequency (Hz)")
+axes.set_ylabel("dB (full scale sine = 0)")
+
+try:
+    while plt.fignum_exists(figure.number):
+        bins = read_frame()
+        # Bins are 0.5dB steps, a full scale sine lands around 156
+        line.set_ydata([(b - 156) / 2 for b in bins])
+        figure.canvas.draw_idle()
+        figure.canvas.flush_events()
+finally:
+    device.write(b"multiverse:_sp0")
@@ -0,0 +1,16 @@
+#include "audio_arena.h"
+
+static_assert(AUDIO_RAM_TOTAL <= AUDIO_RAM_BUDGET, "Audio buffers are over AUDIO_RAM_BUDGET");
+static_assert(!AUDIO_OVERSAMPLE_2X || OVERSAMPLE_MAX_FRAMES >= AUDIO_PACKET_FRAMES, "The oversampler must take a whole packet");
+
+audio_arena_t audio_arena;
+
+void audio_arena_get_stats(audio_arena_stats_t *stats) {
+    stats->packets = sizeof(audio_arena) - sizeof(audio_arena.producer);
+    stats->producer = sizeof(audio_arena.producer);
+    stats->i2s = AUDIO_RAM_I2S;
+    stats->silence = AUDIO_RAM_SILENCE;
+    stats->usb = AUDIO_RAM_USB;
+    stats->total = AUDIO_RAM_TOTAL;
+    stats->budget = AUDIO_RAM_BUDGET;
+}
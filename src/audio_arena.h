@@ -0,0 +1,80 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include "tusb.h"
+#include "pico/audio_i2s.h"
+#include "oversample.h"
+#include "i2s_ring.h"
+
+// The buffers between the USB endpoint and the I2S pins, all sized at
+// compile time from the USB format, I2S buffering and oversampling. Those we
+// own live in `audio_arena`, the rest are counted against the same budget so
+// a build that outgrows it doesn't compile.
+
+// I2S buffers and their length, the depth of the output queue and so most of the latency
+#ifndef AUDIO_I2S_BUFFERS
+#define AUDIO_I2S_BUFFERS 2
+#endif
+#ifndef AUDIO_I2S_BUFFER_FRAMES
+#define AUDIO_I2S_BUFFER_FRAMES 256
+#endif
+
+#ifndef AUDIO_RAM_BUDGET
+#define AUDIO_RAM_BUDGET 8192
+#endif
+
+#ifndef PICO_AUDIO_I2S_SILENCE_BUFFER_SAMPLE_LENGTH
+#define PICO_AUDIO_I2S_SILENCE_BUFFER_SAMPLE_LENGTH 256u
+#endif
+
+static const size_t AUDIO_FRAME_BYTES = sizeof(int16_t) * 2;
+
+// One speaker packet, the most the host can send in a millisecond
+static const size_t AUDIO_PACKET_BYTES = CFG_TUD_AUDIO_FUNC_1_EP_OUT_SZ_MAX;
+static const size_t AUDIO_PACKET_FRAMES = CFG_TUD_AUDIO_FUNC_1_MAX_SAMPLE_RATE / 1000 + 1;
+
+// Producer buffers only ever hold one packet, after oversampling
+static const size_t AUDIO_PRODUCER_BUFFERS = 3;
+static const size_t AUDIO_PRODUCER_FRAMES = AUDIO_PACKET_FRAMES * (AUDIO_OVERSAMPLE_2X ? 2 : 1);
+
+typedef struct {
+    int32_t spk_buf[AUDIO_PACKET_BYTES / sizeof(int32_t)];
+#if AUDIO_SYSTEM_MIX
+    int16_t sys_buf[CFG_TUD_AUDIO_FUNC_2_EP_OUT_SZ_MAX / sizeof(int16_t)];
+#endif
+    int16_t producer[AUDIO_PRODUCER_BUFFERS][AUDIO_PRODUCER_FRAMES * 2];
+} audio_arena_t;
+
+extern audio_arena_t audio_arena;
+
+// Allocated elsewhere, but sized by the configuration above. The ring engine
+// needs no pico_audio_i2s buffers, and plays silence from the ring itself.
+#if AUDIO_I2S_RING
+static const size_t AUDIO_RAM_I2S = AUDIO_I2S_RING_FRAMES * AUDIO_FRAME_BYTES;
+static const size_t AUDIO_RAM_SILENCE = 0;
+#else
+static const size_t AUDIO_RAM_I2S = AUDIO_I2S_BUFFERS * AUDIO_I2S_BUFFER_FRAMES * AUDIO_FRAME_BYTES;
+static const size_t AUDIO_RAM_SILENCE = PICO_AUDIO_I2S_SILENCE_BUFFER_SAMPLE_LENGTH * AUDIO_FRAME_BYTES;
+#endif
+static const size_t AUDIO_RAM_USB = CFG_TUD_AUDIO_FUNC_1_EP_OUT_SW_BUF_SZ
+#if AUDIO_LOOPBACK
+        + CFG_TUD_AUDIO_FUNC_1_EP_IN_SW_BUF_SZ
+#endif
+#if AUDIO_SYSTEM_MIX
+        + CFG_TUD_AUDIO_FUNC_2_EP_OUT_SW_BUF_SZ
+#endif
+        ;
+
+static const size_t AUDIO_RAM_TOTAL = sizeof(audio_arena_t) + AUDIO_RAM_I2S + AUDIO_RAM_SILENCE + AUDIO_RAM_USB;
+
+typedef struct {
+    uint32_t packets;       // Packets waiting for audio_task() and the mixer
+    uint32_t producer;      // Converted packets on their way to I2S
+    uint32_t i2s;           // pico_audio_i2s buffers on the heap, or the ring
+    uint32_t silence;       // Played by pico_audio_i2s when there's nothing else
+    uint32_t usb;           // TinyUSB endpoint FIFOs
+    uint32_t total;
+    uint32_t budget;
+} audio_arena_stats_t;
+
+void audio_arena_get_stats(audio_arena_stats_t *stats);
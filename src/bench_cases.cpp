@@ -0,0 +1,127 @@
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "bench_cases.h"
+#include "i2s_audio.h"
+#include "oversample.h"
+#include "loudness.h"
+#include "vbass.h"
+#include "dsp.h"
+#include "sounds.h"
+
+static const uint8_t VOLUME = 200;
+
+// Full scale noise for the stages on their own. In place stages start from a
+// fresh copy each run, with room to oversample.
+static int16_t noise[BENCH_CASE_FRAMES * 2];
+static int16_t block[BENCH_CASE_FRAMES * 2 * 2];
+
+// Packets for I2S are the same noise at -60dBFS, only a faint hiss on the board
+static int16_t give_s16[BENCH_CASE_FRAMES * 2];
+static int32_t give_s24[BENCH_CASE_FRAMES * 2];
+static float give_f32[BENCH_CASE_FRAMES * 2];
+
+// 1kHz Butterworth low pass
+static const dsp_biquad_t biquad = {64, 128, 64, -29743, 13615};
+static dsp_biquad_state_t biquad_state;
+
+static vbass_config_t saved_vbass;
+static bool saved_loudness;
+
+void bench_cases_begin() {
+    uint32_t seed = 1;
+    for(auto i = 0u; i < BENCH_CASE_FRAMES * 2; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        noise[i] = (int16_t)(seed >> 16);
+        give_s16[i] = noise[i] >> 10;
+        give_s24[i] = ((int32_t)noise[i] << 16) >> 10;
+        give_f32[i] = (float)noise[i] / (32768.0f * 1024.0f);
+    }
+
+    // Every stage of the give path on, as it is at its most expensive
+    vbass_get_config(&saved_vbass);
+    saved_loudness = loudness_enabled();
+    vbass_config_t vbass = {true, 150, 0};
+    vbass_set_config(&vbass);
+    loudness_set_enabled(true);
+}
+
+void bench_cases_end() {
+    vbass_set_config(&saved_vbass);
+    loudness_set_enabled(saved_loudness);
+    // Don't leave the rest of the boot chime to play out
+    sounds_stop();
+}
+
+static void setup_none() {}
+static void setup_s16() { i2s_audio_bench_kernel_init(16); }
+static void setup_s24() { i2s_audio_bench_kernel_init(24); }
+static void setup_f32() { i2s_audio_bench_kernel_init(32); }
+
+static void run_convert_s16() { i2s_audio_run_kernel(16, true); }
+static void run_convert_s16_mix() { i2s_audio_run_kernel(16, true, true); }
+static void run_convert_s24() { i2s_audio_run_kernel(24, true); }
+static void run_convert_f32() { i2s_audio_run_kernel(32, true); }
+
+static void run_vbass() {
+    memcpy(block, noise, sizeof(noise));
+    vbass_process(block, BENCH_CASE_FRAMES);
+}
+
+static void run_loudness() {
+    memcpy(block, noise, sizeof(noise));
+    loudness_process(block, BENCH_CASE_FRAMES, VOLUME);
+}
+
+static void run_oversample() {
+    memcpy(block, noise, sizeof(noise));
+    oversample_2x(block, BENCH_CASE_FRAMES);
+}
+
+static void run_dsp_convert() { dsp_convert_s16(block, noise, BENCH_CASE_FRAMES, VOLUME); }
+static void run_dsp_convert_mix() { dsp_convert_s16(block, noise, BENCH_CASE_FRAMES, VOLUME, give_s16); }
+
+static void run_dsp_gain() {
+    memcpy(block, noise, sizeof(noise));
+    dsp_gain(block, BENCH_CASE_FRAMES * 2, 3 << (DSP_GAIN_BITS - 1));
+}
+
+static void run_dsp_biquad() {
+    memcpy(block, noise, sizeof(noise));
+    dsp_biquad(block, BENCH_CASE_FRAMES, &biquad, &biquad_state);
+}
+
+// The boot chime is the longest clip, started again whenever it runs out
+static void setup_sounds() { sounds_play(SOUND_BOOT, 255); }
+
+static void run_sounds_mix() {
+    if(!sounds_playing()) sounds_play(SOUND_BOOT, 255);
+    memset(block, 0, sizeof(block));
+    sounds_mix(block, BENCH_CASE_FRAMES);
+}
+
+static void run_give_s16() { i2s_audio_give_buffer(give_s16, sizeof(give_s16), 16, VOLUME); }
+static void run_give_s24() { i2s_audio_give_buffer(give_s24, sizeof(give_s24), 24, VOLUME); }
+static void run_give_f32() { i2s_audio_give_buffer(give_f32, sizeof(give_f32), 32, VOLUME); }
+
+// Names are the keys in stored baselines, don't rename them
+const bench_case_t bench_cases[] = {
+    {"convert_s16", setup_s16, run_convert_s16, false},
+    {"convert_s16_mix", setup_s16, run_convert_s16_mix, false},
+    {"convert_s24", setup_s24, run_convert_s24, false},
+    {"convert_f32", setup_f32, run_convert_f32, false},
+    {"vbass", setup_none, run_vbass, false},
+    {"loudness", setup_none, run_loudness, false},
+    {"oversample_2x", setup_none, run_oversample, false},
+    {"dsp_convert_s16", setup_none, run_dsp_convert, false},
+    {"dsp_convert_s16_mix", setup_none, run_dsp_convert_mix, false},
+    {"dsp_gain", setup_none, run_dsp_gain, false},
+    {"dsp_biquad", setup_none, run_dsp_biquad, false},
+    {"give_s16", setup_none, run_give_s16, true},
+    {"give_s24", setup_none, run_give_s24, true},
+    {"give_f32", setup_none, run_give_f32, true},
+    // Last, so the give cases don't mix in the rest of the chime
+    {"sounds_mix", setup_sounds, run_sounds_mix, false},
+};
+
+const size_t BENCH_CASE_COUNT = count_of(bench_cases);
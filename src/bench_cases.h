@@ -0,0 +1,23 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// The audio kernels on their own and the whole of i2s_audio_give_buffer(),
+// one 1ms packet per run. Shared by the host benchmark in bench/, which times
+// them in nanoseconds, and `_bnj`, which times them in cycles on the board.
+
+static const size_t BENCH_CASE_FRAMES = 48;
+
+typedef struct {
+    const char *name;
+    void (*setup)();    // Untimed, before the case's runs
+    void (*run)();
+    bool gives;         // Hands its packet to I2S
+} bench_case_t;
+
+extern const bench_case_t bench_cases[];
+extern const size_t BENCH_CASE_COUNT;
+
+// Fills the inputs and turns every stage on, end puts the settings back
+void bench_cases_begin();
+void bench_cases_end();
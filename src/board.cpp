@@ -2,6 +2,7 @@
 #include "rgbled.hpp"
 #include "button.hpp"
 #include "board_config.h"
+#include "board.h"
 
 #include "pico/bootrom.h"
 #include "hardware/structs/rosc.h"
@@ -9,6 +10,7 @@
 #include "hardware/watchdog.h"
 #include "hardware/sync.h"
 #include "hardware/vreg.h"
+#include "hardware/irq.h"
 
 using namespace encoder;
 using namespace pimoroni;
@@ -20,13 +22,63 @@ Button button(BUTTON, pimoroni::ACTIVE_LOW, 0);
 bool pressed = false;
 absolute_time_t pressed_time;
 
+// Input events are pushed from IRQs on core0 and drained by the main loop
+static const uint32_t INPUT_QUEUE_SIZE = 16;
+static input_event_t input_queue[INPUT_QUEUE_SIZE];
+static volatile uint32_t input_head = 0;
+static volatile uint32_t input_tail = 0;
+static uint32_t input_dropped = 0;
 
-void system_init() {
+// Ignore further edges this long after an accepted one
+static const uint32_t BUTTON_DEBOUNCE_US = 5000;
+
+static int32_t encoder_last_count = 0;
+static bool button_down = false;
+static uint32_t button_edge_us = 0;
+
+static void push_input_event(input_event_type_t type, int32_t steps) {
+    uint32_t head = input_head;
+    if(head - input_tail == INPUT_QUEUE_SIZE) {
+        input_dropped++;
+        return;
+    }
+    input_queue[head % INPUT_QUEUE_SIZE] = {time_us_32(), type, steps};
+    __compiler_memory_barrier();
+    input_head = head + 1;
+}
+
+// Runs after the Encoder driver's own handler has drained the PIO FIFO
+static void __isr encoder_irq_handler() {
+    int32_t count = volume_control.count();
+    if(count != encoder_last_count) {
+        push_input_event(INPUT_ENCODER, count - encoder_last_count);
+        encoder_last_count = count;
+    }
+}
+
+// React to the first edge immediately, then ride out the bounce
+static void button_update(bool down) {
+    uint32_t now = time_us_32();
+    if(down == button_down || now - button_edge_us < BUTTON_DEBOUNCE_US) return;
+    button_down = down;
+    button_edge_us = now;
+    push_input_event(down ? INPUT_BUTTON_DOWN : INPUT_BUTTON_UP, 0);
+}
+
+static void __isr button_irq_handler() {
+    const uint32_t edges = GPIO_IRQ_EDGE_FALL | GPIO_IRQ_EDGE_RISE;
+    if(gpio_get_irq_event_mask(BUTTON) & edges) {
+        gpio_acknowledge_irq(BUTTON, edges);
+        button_update(!gpio_get(BUTTON)); // Active low
+    }
+}
+
+
+// Returns straight away, the caller must wait VREG_SETTLE_MS before system_clock_init()
+void system_power_init() {
     // Apply a modest overvolt, default is 1.10v.
     // this is required for a stable 250MHz on some RP2040s
     vreg_set_voltage(VREG_VOLTAGE_1_20);
-    sleep_ms(10);
-    set_sys_clock_khz(250000, true);
 
     // DCDC PSM control
     // 0: PFM mode (best efficiency)
@@ -34,16 +86,44 @@ void system_init() {
     gpio_init(PIN_DCDC_PSM_CTRL);
     gpio_set_dir(PIN_DCDC_PSM_CTRL, GPIO_OUT);
     gpio_put(PIN_DCDC_PSM_CTRL, 1); // PWM mode for less Audio noise
+}
 
+void system_clock_init() {
+    set_sys_clock_khz(250000, true);
+}
+
+void system_input_init() {
     volume_control.init();
+    encoder_last_count = volume_control.count();
+    button_down = button.raw();
+    irq_add_shared_handler(PIO1_IRQ_0, encoder_irq_handler, PICO_SHARED_IRQ_HANDLER_LOWEST_ORDER_PRIORITY);
+
+    gpio_add_raw_irq_handler(BUTTON, button_irq_handler);
+    gpio_set_irq_enabled(BUTTON, GPIO_IRQ_EDGE_FALL | GPIO_IRQ_EDGE_RISE, true);
+    irq_set_enabled(IO_IRQ_BANK0, true);
+}
+
+bool get_input_event(input_event_t *event) {
+    // A bounce can end inside the debounce window with no edge left to follow,
+    // so pick up where the button settled once the window has passed.
+    uint32_t irq_status = save_and_disable_interrupts();
+    button_update(!gpio_get(BUTTON));
+    restore_interrupts(irq_status);
+
+    uint32_t tail = input_tail;
+    if(tail == input_head) return false;
+    *event = input_queue[tail % INPUT_QUEUE_SIZE];
+    __compiler_memory_barrier();
+    input_tail = tail + 1;
+    return true;
 }
 
-int32_t get_volume_delta() {
-    return volume_control.delta();
+bool get_mute_button_down() {
+    return button.raw();
 }
 
-bool get_mute_button_pressed() {
-    return button.read();
+uint32_t get_input_dropped() {
+    return input_dropped;
 }
 
 void handle_mute_button_held() {
@@ -1,7 +1,33 @@
+#pragma once
 #include <stdint.h>
 
-void system_init();
-int32_t get_volume_delta();
+typedef enum {
+    INPUT_ENCODER,
+    INPUT_BUTTON_DOWN,
+    INPUT_BUTTON_UP,
+} input_event_type_t;
+
+typedef struct {
+    uint32_t time_us;       // time_us_32() in the IRQ that saw it
+    input_event_type_t type;
+    int32_t steps;          // Encoder detents, signed
+} input_event_t;
+
+typedef struct {
+    bool pending;
+    uint32_t event_us;
+    uint32_t last_us;       // Input IRQ to gain applied to a buffer
+    uint32_t max_us;
+    uint32_t output_us;     // Audio queued in the DMA ahead of that buffer
+} input_latency_t;
+
+const uint32_t VREG_SETTLE_MS = 10;
+
+void system_power_init();
+void system_clock_init();
+void system_input_init();
 void system_led(uint8_t r, uint8_t g, uint8_t b);
-bool get_mute_button_pressed();
-void handle_mute_button_held();
\ No newline at end of file
+bool get_input_event(input_event_t *event);
+uint32_t get_input_dropped();
+bool get_mute_button_down();
+void handle_mute_button_held();
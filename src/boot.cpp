@@ -0,0 +1,21 @@
+#include "pico/stdlib.h"
+#include "boot.h"
+
+static uint32_t phase_us[BOOT_PHASE_COUNT];
+
+static const char *phase_names[BOOT_PHASE_COUNT] = {
+    "main", "usb_init", "clocks", "board", "audio", "ready", "mounted"
+};
+
+void boot_mark(boot_phase_t phase) {
+    // The timer starts from zero at reset, so this is time since power on
+    if(!phase_us[phase]) phase_us[phase] = MAX(1u, time_us_32());
+}
+
+uint32_t boot_time_us(boot_phase_t phase) {
+    return phase_us[phase];
+}
+
+const char *boot_phase_name(boot_phase_t phase) {
+    return phase_names[phase];
+}
@@ -0,0 +1,20 @@
+#pragma once
+#include <stdint.h>
+
+// Power-on milestones, in the order they're reached
+enum boot_phase_t {
+    BOOT_MAIN,          // Entered main(), after boot2 and the SDK runtime init
+    BOOT_USB_INIT,      // tud_init() done, host can see us
+    BOOT_CLOCKS,        // Overvolt settled and clk_sys raised
+    BOOT_BOARD,         // LED, encoder, button and settings ready
+    BOOT_AUDIO,         // Amp enabled and I2S running
+    BOOT_READY,         // Entered the main loop
+    BOOT_MOUNTED,       // Host finished enumeration
+    BOOT_PHASE_COUNT
+};
+
+// Record the first time a phase is reached
+void boot_mark(boot_phase_t phase);
+// Microseconds since reset, or 0 if not reached yet
+uint32_t boot_time_us(boot_phase_t phase);
+const char *boot_phase_name(boot_phase_t phase);
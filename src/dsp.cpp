@@ -0,0 +1,116 @@
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "dsp.h"
+#include "fixed.h"
+
+// Whole words through memcpy, so unaligned buffers still work. On the M33
+// it's a single LDR or STR.
+static inline dsp_pair_t load_pair(const int16_t *p) {
+    dsp_pair_t pair;
+    memcpy(&pair, p, sizeof(pair));
+    return pair;
+}
+
+static inline void store_pair(int16_t *p, dsp_pair_t pair) {
+    memcpy(p, &pair, sizeof(pair));
+}
+
+const char *dsp_target_name() {
+#if DSP_TARGET == DSP_SIMD
+#if defined(__ARM_FEATURE_DSP)
+    return "simd";
+#else
+    return "simd emulated";
+#endif
+#else
+    return "scalar";
+#endif
+}
+
+void __not_in_flash_func(dsp_convert_s16)(int16_t *out, const int16_t *in, size_t frames, uint8_t volume, const int16_t *mix) {
+#if DSP_TARGET == DSP_SIMD
+    const dsp_pair_t v = volume;
+    for(auto i = 0u; i < frames * 2; i += 2) {
+        dsp_pair_t frame = load_pair(&in[i]);
+        dsp_pair_t scaled = dsp_pack(dsp_smultb(frame, v) >> 8, dsp_smulbb(frame, v) >> 8);
+        if(mix) {
+            dsp_pair_t sound = load_pair(&mix[i]);
+            scaled = dsp_qadd16(scaled, dsp_pack(dsp_smultb(sound, v) >> 8, dsp_smulbb(sound, v) >> 8));
+        }
+        store_pair(&out[i], scaled);
+    }
+#else
+    for(auto i = 0u; i < frames * 2; i += 2) {
+        int32_t left = (in[i + 0] * volume) >> 8;
+        int32_t right = (in[i + 1] * volume) >> 8;
+        if(mix) {
+            left = dsp_ssat16(left + ((mix[i + 0] * volume) >> 8));
+            right = dsp_ssat16(right + ((mix[i + 1] * volume) >> 8));
+        }
+        out[i + 0] = right;
+        out[i + 1] = left;
+    }
+#endif
+}
+
+void __not_in_flash_func(dsp_gain)(int16_t *samples, size_t count, int16_t gain) {
+    size_t i = 0;
+#if DSP_TARGET == DSP_SIMD
+    const dsp_pair_t g = (uint16_t)gain;
+    for(; i + 1 < count; i += 2) {
+        dsp_pair_t pair = load_pair(&samples[i]);
+        int32_t lo = dsp_ssat16(fixed_shr_round(dsp_smulbb(pair, g), DSP_GAIN_BITS));
+        int32_t hi = dsp_ssat16(fixed_shr_round(dsp_smultb(pair, g), DSP_GAIN_BITS));
+        store_pair(&samples[i], dsp_pack(lo, hi));
+    }
+#endif
+    for(; i < count; i++) {
+        samples[i] = dsp_ssat16(fixed_shr_round(samples[i] * gain, DSP_GAIN_BITS));
+    }
+}
+
+void __not_in_flash_func(dsp_biquad)(int16_t *samples, size_t frames, const dsp_biquad_t *c, dsp_biquad_state_t *state) {
+    // Rounds the output to nearest, halves up
+    const int32_t round = 1 << (DSP_BIQUAD_BITS - 1);
+#if DSP_TARGET == DSP_SIMD
+    const dsp_pair_t b12 = dsp_pack(c->b1, c->b2);
+    const dsp_pair_t a12 = dsp_pack(c->a1, c->a2);
+    const dsp_pair_t b0 = (uint16_t)c->b0;
+    for(auto ch = 0u; ch < 2; ch++) {
+        dsp_pair_t x12 = dsp_pack(state->x1[ch], state->x2[ch]);
+        dsp_pair_t y12 = dsp_pack(state->y1[ch], state->y2[ch]);
+        for(auto i = ch; i < frames * 2; i += 2) {
+            dsp_pair_t x0 = (uint16_t)samples[i];
+            int32_t acc = dsp_smlad(b12, x12, dsp_smulbb(x0, b0) + round);
+            acc = (int32_t)((uint32_t)acc - (uint32_t)dsp_smuad(a12, y12));
+            int32_t y0 = dsp_ssat16(acc >> DSP_BIQUAD_BITS);
+            samples[i] = y0;
+            // Shift the history along, the new sample into the bottom half
+            x12 = dsp_pack(x0, dsp_lo(x12));
+            y12 = dsp_pack(y0, dsp_lo(y12));
+        }
+        state->x1[ch] = dsp_lo(x12);
+        state->x2[ch] = dsp_hi(x12);
+        state->y1[ch] = dsp_lo(y12);
+        state->y2[ch] = dsp_hi(y12);
+    }
+#else
+    for(auto ch = 0u; ch < 2; ch++) {
+        int32_t x1 = state->x1[ch], x2 = state->x2[ch];
+        int32_t y1 = state->y1[ch], y2 = state->y2[ch];
+        for(auto i = ch; i < frames * 2; i += 2) {
+            int32_t x0 = samples[i];
+            // Summed as the M33 does, wrapping rather than saturating
+            uint32_t acc = (uint32_t)(c->b0 * x0) + round + (uint32_t)(c->b1 * x1) + (uint32_t)(c->b2 * x2)
+                         - (uint32_t)(c->a1 * y1) - (uint32_t)(c->a2 * y2);
+            int32_t y0 = dsp_ssat16((int32_t)acc >> DSP_BIQUAD_BITS);
+            samples[i] = y0;
+            x2 = x1; x1 = x0;
+            y2 = y1; y1 = y0;
+        }
+        state->x1[ch] = x1; state->x2[ch] = x2;
+        state->y1[ch] = y1; state->y2[ch] = y2;
+    }
+#endif
+}
@@ -0,0 +1,134 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// DSP intrinsics and the kernels built on them in dsp.cpp.
+//
+// Each kernel has two versions, both bit-exact with each other:
+//
+// DSP_SCALAR  One sample at a time in plain C, for the RP2040's Cortex-M0+,
+//             which has no DSP instructions, and for hosts.
+// DSP_SIMD    A pair of 16-bit samples per 32-bit word, built on the
+//             Cortex-M33 DSP extension (SMLAD, SMULxy, SSAT) of the RP2350.
+//
+// DSP_TARGET is picked from the compiler's target. Where there's no DSP
+// extension the intrinsics below are emulated in C with the same results,
+// wrapping and saturation as the instructions, so building for a host with
+// DSP_TARGET=DSP_SIMD runs the M33 kernels on a PC to compare against scalar.
+//
+// Pairs hold the sample at the lower address in the bottom half, as they are
+// loaded from memory on a little-endian core.
+
+#define DSP_SCALAR 0
+#define DSP_SIMD 1
+
+#ifndef DSP_TARGET
+#if defined(__ARM_FEATURE_DSP)
+#define DSP_TARGET DSP_SIMD
+#else
+#define DSP_TARGET DSP_SCALAR
+#endif
+#endif
+
+#if defined(__ARM_FEATURE_DSP)
+#include <arm_acle.h>
+#endif
+
+typedef uint32_t dsp_pair_t;
+
+static inline int32_t dsp_lo(dsp_pair_t pair) {
+    return (int16_t)(pair & 0xffff);
+}
+
+static inline int32_t dsp_hi(dsp_pair_t pair) {
+    return (int16_t)(pair >> 16);
+}
+
+// PKHBT, the compiler spots this
+static inline dsp_pair_t dsp_pack(int32_t lo, int32_t hi) {
+    return ((uint32_t)lo & 0xffff) | ((uint32_t)hi << 16);
+}
+
+// SSAT #16
+static inline int16_t dsp_ssat16(int32_t value) {
+#if defined(__ARM_FEATURE_DSP)
+    return __ssat(value, 16);
+#else
+    return value > INT16_MAX ? INT16_MAX : value < INT16_MIN ? INT16_MIN : (int16_t)value;
+#endif
+}
+
+// SMULBB, bottom half by bottom half
+static inline int32_t dsp_smulbb(dsp_pair_t a, dsp_pair_t b) {
+#if defined(__ARM_FEATURE_DSP)
+    return __smulbb(a, b);
+#else
+    return dsp_lo(a) * dsp_lo(b);
+#endif
+}
+
+// SMULTB, top half of a by bottom half of b
+static inline int32_t dsp_smultb(dsp_pair_t a, dsp_pair_t b) {
+#if defined(__ARM_FEATURE_DSP)
+    return __smultb(a, b);
+#else
+    return dsp_hi(a) * dsp_lo(b);
+#endif
+}
+
+// SMLAD, both halves multiplied and added to acc. Wraps on overflow, and
+// only sets the Q flag, which nothing here reads.
+static inline int32_t dsp_smlad(dsp_pair_t a, dsp_pair_t b, int32_t acc) {
+#if defined(__ARM_FEATURE_DSP)
+    return __smlad(a, b, acc);
+#else
+    return (int32_t)((uint32_t)acc + (uint32_t)(dsp_lo(a) * dsp_lo(b)) + (uint32_t)(dsp_hi(a) * dsp_hi(b)));
+#endif
+}
+
+// SMUAD, both halves multiplied and summed. Only -32768 * -32768 twice wraps.
+static inline int32_t dsp_smuad(dsp_pair_t a, dsp_pair_t b) {
+#if defined(__ARM_FEATURE_DSP)
+    return __smuad(a, b);
+#else
+    return (int32_t)((uint32_t)(dsp_lo(a) * dsp_lo(b)) + (uint32_t)(dsp_hi(a) * dsp_hi(b)));
+#endif
+}
+
+// QADD16, each half added and saturated
+static inline dsp_pair_t dsp_qadd16(dsp_pair_t a, dsp_pair_t b) {
+#if defined(__ARM_FEATURE_SIMD32)
+    return __qadd16(a, b);
+#else
+    return dsp_pack(dsp_ssat16(dsp_lo(a) + dsp_lo(b)), dsp_ssat16(dsp_hi(a) + dsp_hi(b)));
+#endif
+}
+
+// Gains for dsp_gain(), 4096 is unity
+static const int DSP_GAIN_BITS = 12;
+
+// Biquad coefficients, Q14 so up to +/-2. a1 and a2 are the denominator as
+// written, 1 + a1 z^-1 + a2 z^-2. The accumulator isn't saturated, so the sum
+// of all five magnitudes must stay below 4.
+static const int DSP_BIQUAD_BITS = 14;
+
+typedef struct {
+    int16_t b0, b1, b2, a1, a2;
+} dsp_biquad_t;
+
+// Direct form 1 history for each channel of a stereo pair
+typedef struct {
+    int16_t x1[2], x2[2];
+    int16_t y1[2], y2[2];
+} dsp_biquad_state_t;
+
+// USB frames to I2S, left and right swapped and scaled by volume / 256. With
+// mix, a block of system sounds is scaled the same way and summed in,
+// saturating. i2s_audio.cpp converts 16-bit packets with it on DSP_SIMD
+// targets, and its own loop, to the same result, on the M0+.
+void dsp_convert_s16(int16_t *out, const int16_t *in, size_t frames, uint8_t volume, const int16_t *mix=nullptr);
+// In place, rounded and saturated
+void dsp_gain(int16_t *samples, size_t count, int16_t gain);
+// In place on stereo frames, each channel with its own history
+void dsp_biquad(int16_t *samples, size_t frames, const dsp_biquad_t *coefficients, dsp_biquad_state_t *state);
+const char *dsp_target_name();
@@ -0,0 +1,185 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// Saturating Q15 and Q31 fixed point for the audio path.
+//
+// Header only and constexpr throughout, so the same code runs on the RP2040
+// and in host builds, and coefficients can be worked out at compile time.
+// Multiplies round to nearest and everything saturates at the format limits
+// instead of wrapping.
+//
+// Cortex-M0+ has a single cycle 32x32->32 multiply but no long multiply, so a
+// 64-bit product is a libgcc call. There, Q31 products are built from 16x16
+// partial products instead, which give bit-identical results.
+
+#ifndef FIXED_NO_LONG_MULTIPLY
+#if defined(__ARM_ARCH_6M__)
+#define FIXED_NO_LONG_MULTIPLY 1
+#else
+#define FIXED_NO_LONG_MULTIPLY 0
+#endif
+#endif
+
+template<typename raw_type, int frac_bits>
+struct fixed_t {
+    typedef raw_type raw_t;
+    static constexpr int FRAC_BITS = frac_bits;
+    static constexpr raw_t MAX = (raw_t)(((uint64_t)1 << frac_bits) - 1);
+    static constexpr raw_t MIN = (raw_t)(-MAX - 1);
+
+    raw_t raw;
+
+    static constexpr fixed_t from_raw(raw_t value) {
+        return fixed_t{value};
+    }
+
+    // Rounded to nearest and clamped to [-1, 1). Meant for constants, at
+    // runtime on the RP2040 this is soft float.
+    static constexpr fixed_t from_float(double value) {
+        double scaled = value * (double)((uint64_t)1 << frac_bits);
+        if(scaled >= (double)MAX) return fixed_t{MAX};
+        if(scaled <= (double)MIN) return fixed_t{MIN};
+        return fixed_t{(raw_t)(scaled < 0 ? scaled - 0.5 : scaled + 0.5)};
+    }
+
+    constexpr double to_float() const {
+        return (double)raw / (double)((uint64_t)1 << frac_bits);
+    }
+
+    constexpr bool operator==(const fixed_t &other) const { return raw == other.raw; }
+    constexpr bool operator!=(const fixed_t &other) const { return raw != other.raw; }
+};
+
+typedef fixed_t<int16_t, 15> q15_t;
+typedef fixed_t<int32_t, 31> q31_t;
+
+constexpr int16_t fixed_sat16(int32_t value) {
+    return value > INT16_MAX ? INT16_MAX : value < INT16_MIN ? INT16_MIN : (int16_t)value;
+}
+
+constexpr int32_t fixed_sat32(int64_t value) {
+    return value > INT32_MAX ? INT32_MAX : value < INT32_MIN ? INT32_MIN : (int32_t)value;
+}
+
+// Arithmetic shift right, rounding halves up. Never overflows, unlike adding
+// half an LSB first.
+constexpr int32_t fixed_shr_round(int32_t value, int shift) {
+    return shift == 0 ? value : (value >> shift) + ((value >> (shift - 1)) & 1);
+}
+
+constexpr int32_t fixed_add_sat32(int32_t a, int32_t b) {
+    int32_t sum = 0;
+    if(__builtin_add_overflow(a, b, &sum)) return a < 0 ? INT32_MIN : INT32_MAX;
+    return sum;
+}
+
+constexpr int32_t fixed_sub_sat32(int32_t a, int32_t b) {
+    int32_t difference = 0;
+    if(__builtin_sub_overflow(a, b, &difference)) return a < 0 ? INT32_MIN : INT32_MAX;
+    return difference;
+}
+
+constexpr q15_t fixed_add(q15_t a, q15_t b) {
+    return q15_t::from_raw(fixed_sat16((int32_t)a.raw + b.raw));
+}
+
+constexpr q15_t fixed_sub(q15_t a, q15_t b) {
+    return q15_t::from_raw(fixed_sat16((int32_t)a.raw - b.raw));
+}
+
+constexpr q31_t fixed_add(q31_t a, q31_t b) {
+    return q31_t::from_raw(fixed_add_sat32(a.raw, b.raw));
+}
+
+constexpr q31_t fixed_sub(q31_t a, q31_t b) {
+    return q31_t::from_raw(fixed_sub_sat32(a.raw, b.raw));
+}
+
+// Only -1 * -1 can saturate
+constexpr q15_t fixed_mul(q15_t a, q15_t b) {
+    return q15_t::from_raw(fixed_sat16(fixed_shr_round((int32_t)a.raw * b.raw, 15)));
+}
+
+constexpr q31_t fixed_mul(q31_t a, q31_t b) {
+#if FIXED_NO_LONG_MULTIPLY
+    // a * b = hi * 2^32 + (mid_a + mid_b) * 2^16 + lo, summed in 32-bit pieces
+    int32_t a_hi = a.raw >> 16, b_hi = b.raw >> 16;
+    uint32_t a_lo = (uint32_t)a.raw & 0xffff, b_lo = (uint32_t)b.raw & 0xffff;
+    uint32_t lo = a_lo * b_lo;
+    int32_t mid_a = a_hi * (int32_t)b_lo;
+    int32_t mid_b = (int32_t)a_lo * b_hi;
+    int32_t hi = a_hi * b_hi;
+
+    int32_t carry = (int32_t)(lo >> 16) + (mid_a & 0xffff) + (mid_b & 0xffff);
+    int32_t upper = hi + (mid_a >> 16) + (mid_b >> 16) + (carry >> 16);
+    uint32_t lower = ((uint32_t)carry << 16) | (lo & 0xffff);
+
+    // (product + 2^30) >> 31, only -1 * -1 overflows
+    if(upper >= (1 << 30)) return q31_t::from_raw(INT32_MAX);
+    return q31_t::from_raw(upper * 2 + (int32_t)(lower >> 31) + (int32_t)((lower >> 30) & 1));
+#else
+    int64_t product = (int64_t)a.raw * b.raw;
+    return q31_t::from_raw(fixed_sat32((product + ((int64_t)1 << 30)) >> 31));
+#endif
+}
+
+// Q31 signal by a Q15 gain or coefficient, the usual case
+constexpr q31_t fixed_mul(q31_t a, q15_t b) {
+#if FIXED_NO_LONG_MULTIPLY
+    // a * b = hi * 2^16 + lo, and hi * 2^16 is a whole number of output LSBs
+    int32_t hi = (a.raw >> 16) * b.raw;
+    int32_t lo = (int32_t)((uint32_t)a.raw & 0xffff) * b.raw;
+    // hi + rounded lo can't overflow, so only the last add saturates
+    return q31_t::from_raw(fixed_add_sat32(hi, hi + fixed_shr_round(lo, 15)));
+#else
+    int64_t product = (int64_t)a.raw * b.raw;
+    return q31_t::from_raw(fixed_sat32((product + (1 << 14)) >> 15));
+#endif
+}
+
+constexpr q31_t fixed_mul(q15_t a, q31_t b) {
+    return fixed_mul(b, a);
+}
+
+constexpr q31_t fixed_to_q31(q15_t value) {
+    return q31_t::from_raw((int32_t)value.raw << 16);
+}
+
+constexpr q15_t fixed_to_q15(q31_t value) {
+    return q15_t::from_raw(fixed_sat16(fixed_shr_round(value.raw, 16)));
+}
+
+// Block helpers on sample buffers, int16_t samples are Q15 and int32_t Q31
+
+constexpr void fixed_block_scale(int16_t *samples, size_t count, q15_t gain) {
+    for(size_t i = 0; i < count; i++) {
+        samples[i] = fixed_mul(q15_t::from_raw(samples[i]), gain).raw;
+    }
+}
+
+constexpr void fixed_block_scale(int32_t *samples, size_t count, q15_t gain) {
+    for(size_t i = 0; i < count; i++) {
+        samples[i] = fixed_mul(q31_t::from_raw(samples[i]), gain).raw;
+    }
+}
+
+// dst += src * gain
+constexpr void fixed_block_mix(int16_t *dst, const int16_t *src, size_t count, q15_t gain) {
+    for(size_t i = 0; i < count; i++) {
+        int32_t scaled = fixed_shr_round((int32_t)src[i] * gain.raw, 15);
+        dst[i] = fixed_sat16(dst[i] + scaled);
+    }
+}
+
+constexpr void fixed_block_mix(int32_t *dst, const int32_t *src, size_t count, q15_t gain) {
+    for(size_t i = 0; i < count; i++) {
+        dst[i] = fixed_add(q31_t::from_raw(dst[i]), fixed_mul(q31_t::from_raw(src[i]), gain)).raw;
+    }
+}
+
+static_assert(q15_t::from_float(0.5).raw == 16384);
+static_assert(q15_t::from_float(1.0).raw == INT16_MAX);
+static_assert(fixed_mul(q15_t::from_raw(INT16_MIN), q15_t::from_raw(INT16_MIN)).raw == INT16_MAX);
+static_assert(fixed_mul(q31_t::from_raw(INT32_MIN), q31_t::from_raw(INT32_MIN)).raw == INT32_MAX);
+static_assert(fixed_mul(q31_t::from_float(-0.25), q15_t::from_float(0.5)) == q31_t::from_float(-0.125));
@@ -0,0 +1,80 @@
+#include "pico/stdlib.h"
+#include "fixed.h"
+#include "fixed_bench.h"
+#include "profile.h"
+
+static const size_t BENCH_SAMPLES = 256;
+
+static int16_t a16[BENCH_SAMPLES], b16[BENCH_SAMPLES];
+static int32_t a32[BENCH_SAMPLES], b32[BENCH_SAMPLES];
+
+static const char *names[FIXED_BENCH_OP_COUNT] = {
+    "q15 add", "q15 mul", "q31 add", "q31 mul", "q31 mul int64", "q31*q15 mul", "shr round",
+    "block scale s16", "block scale s32", "block mix s16", "block mix s32",
+};
+
+// Each loop is kept out of line so the timing covers exactly one operation per sample
+template<typename fixed, fixed (*op)(fixed, fixed)>
+static void __attribute__((noinline)) bench_binary(typename fixed::raw_t *out, const typename fixed::raw_t *in) {
+    for(auto i = 0u; i < BENCH_SAMPLES; i++) {
+        out[i] = op(fixed::from_raw(out[i]), fixed::from_raw(in[i])).raw;
+    }
+}
+
+static void __attribute__((noinline)) bench_mul_int64(int32_t *out, const int32_t *in) {
+    for(auto i = 0u; i < BENCH_SAMPLES; i++) {
+        int64_t product = (int64_t)out[i] * in[i];
+        out[i] = fixed_sat32((product + ((int64_t)1 << 30)) >> 31);
+    }
+}
+
+static void __attribute__((noinline)) bench_mul_q15(int32_t *out, const int16_t *in) {
+    for(auto i = 0u; i < BENCH_SAMPLES; i++) {
+        out[i] = fixed_mul(q31_t::from_raw(out[i]), q15_t::from_raw(in[i])).raw;
+    }
+}
+
+static void __attribute__((noinline)) bench_shr_round(int32_t *out) {
+    for(auto i = 0u; i < BENCH_SAMPLES; i++) {
+        out[i] = fixed_shr_round(out[i], 7);
+    }
+}
+
+static void __attribute__((noinline)) bench_block(fixed_bench_op_t op) {
+    const q15_t gain = q15_t::from_float(0.7);
+    switch(op) {
+        case FIXED_BENCH_BLOCK_SCALE16: fixed_block_scale(a16, BENCH_SAMPLES, gain); break;
+        case FIXED_BENCH_BLOCK_SCALE32: fixed_block_scale(a32, BENCH_SAMPLES, gain); break;
+        case FIXED_BENCH_BLOCK_MIX16: fixed_block_mix(a16, b16, BENCH_SAMPLES, gain); break;
+        case FIXED_BENCH_BLOCK_MIX32: fixed_block_mix(a32, b32, BENCH_SAMPLES, gain); break;
+        default: break;
+    }
+}
+
+const char *fixed_bench_name(fixed_bench_op_t op) {
+    return names[op];
+}
+
+uint32_t fixed_bench(fixed_bench_op_t op) {
+    uint32_t seed = 0x1234567;
+    for(auto i = 0u; i < BENCH_SAMPLES; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        a32[i] = (int32_t)seed;
+        b32[i] = (int32_t)(seed * 1664525u + 1013904223u);
+        a16[i] = (int16_t)(a32[i] >> 16);
+        b16[i] = (int16_t)(b32[i] >> 16);
+    }
+
+    uint32_t start = profile_start();
+    switch(op) {
+        case FIXED_BENCH_Q15_ADD: bench_binary<q15_t, fixed_add>(a16, b16); break;
+        case FIXED_BENCH_Q15_MUL: bench_binary<q15_t, fixed_mul>(a16, b16); break;
+        case FIXED_BENCH_Q31_ADD: bench_binary<q31_t, fixed_add>(a32, b32); break;
+        case FIXED_BENCH_Q31_MUL: bench_binary<q31_t, fixed_mul>(a32, b32); break;
+        case FIXED_BENCH_Q31_MUL_INT64: bench_mul_int64(a32, b32); break;
+        case FIXED_BENCH_Q31_MUL_Q15: bench_mul_q15(a32, b16); break;
+        case FIXED_BENCH_SHR_ROUND: bench_shr_round(a32); break;
+        default: bench_block(op); break;
+    }
+    return profile_cycles(start) * 100 / BENCH_SAMPLES;
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include <stdint.h>
+
+enum fixed_bench_op_t {
+    FIXED_BENCH_Q15_ADD,
+    FIXED_BENCH_Q15_MUL,
+    FIXED_BENCH_Q31_ADD,
+    FIXED_BENCH_Q31_MUL,
+    FIXED_BENCH_Q31_MUL_INT64,  // The same product through a 64-bit multiply, for comparison
+    FIXED_BENCH_Q31_MUL_Q15,
+    FIXED_BENCH_SHR_ROUND,
+    FIXED_BENCH_BLOCK_SCALE16,
+    FIXED_BENCH_BLOCK_SCALE32,
+    FIXED_BENCH_BLOCK_MIX16,
+    FIXED_BENCH_BLOCK_MIX32,
+    FIXED_BENCH_OP_COUNT
+};
+
+const char *fixed_bench_name(fixed_bench_op_t op);
+// Cycles per 100 operations, or per 100 samples for the block helpers
+uint32_t fixed_bench(fixed_bench_op_t op);
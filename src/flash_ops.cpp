@@ -0,0 +1,66 @@
+#include "pico/stdlib.h"
+#include "pico/flash.h"
+#include "hardware/flash.h"
+#include "flash_ops.h"
+#include "i2s_audio.h"
+
+// With interrupts off the I2S DMA can only finish the buffer it's on, so only
+// program a page during playback with more than the worst case left in it.
+// W25Q page programs take 0.4ms typically and 3ms at most, and
+// flash_safe_execute adds locking out core1 and leaving and re-entering XIP.
+// 96kHz I2S buffers are never that long, so those writes wait for idle.
+static const uint32_t PAGE_PROGRAM_MAX_US = 3000;
+static const uint32_t SAFE_EXECUTE_OVERHEAD_US = 200;
+static const uint32_t PLAYBACK_MIN_HEADROOM_US = PAGE_PROGRAM_MAX_US + SAFE_EXECUTE_OVERHEAD_US;
+
+static flash_ops_stats_t stats = {.worst_margin_us = INT32_MAX};
+
+typedef struct {
+    uint32_t offset;
+    const uint8_t *data;
+} flash_op_t;
+
+static void __not_in_flash_func(do_erase)(void *param) {
+    flash_range_erase(((flash_op_t *)param)->offset, FLASH_SECTOR_SIZE);
+}
+
+static void __not_in_flash_func(do_program)(void *param) {
+    flash_op_t *op = (flash_op_t *)param;
+    flash_range_program(op->offset, op->data, FLASH_PAGE_SIZE);
+}
+
+// flash_safe_execute locks out core1 and disables interrupts for the duration,
+// only the I2S DMA keeps running. Time the whole thing as the stall.
+static void flash_op(void (*func)(void *), uint32_t offset, const uint8_t *data, bool playing) {
+    flash_op_t op = {offset, data};
+
+    uint32_t headroom_us = i2s_audio_dma_remaining_us();
+    uint32_t start_us = time_us_32();
+    int result = flash_safe_execute(func, &op, 10);
+    uint32_t stall_us = time_us_32() - start_us;
+
+    hard_assert(result == PICO_OK);
+
+    stats.writes++;
+    stats.worst_stall_us = MAX(stats.worst_stall_us, stall_us);
+    if(playing) {
+        stats.playback_writes++;
+        stats.worst_margin_us = MIN(stats.worst_margin_us, (int32_t)(headroom_us - stall_us));
+    }
+}
+
+bool flash_ops_can_program(bool playing) {
+    return !playing || i2s_audio_dma_remaining_us() >= PLAYBACK_MIN_HEADROOM_US;
+}
+
+void flash_ops_erase(uint32_t offset, bool playing) {
+    flash_op(do_erase, offset, nullptr, playing);
+}
+
+void flash_ops_program(uint32_t offset, const uint8_t *data, bool playing) {
+    flash_op(do_program, offset, data, playing);
+}
+
+void flash_ops_get_stats(flash_ops_stats_t *stats_out) {
+    *stats_out = stats;
+}
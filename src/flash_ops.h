@@ -0,0 +1,19 @@
+#pragma once
+#include <stdint.h>
+
+// Flash erase and program for the settings store and firmware updates.
+// Offsets are from the start of flash, one sector or one page at a time.
+
+typedef struct {
+    uint32_t writes;            // Flash operations (page programs or erases)
+    uint32_t playback_writes;   // Done while audio was playing
+    uint32_t worst_stall_us;    // Longest time spent with interrupts off
+    int32_t worst_margin_us;    // Smallest (audio left in the DMA - stall) during playback
+} flash_ops_stats_t;
+
+// During playback a page program is only safe with more audio left in the I2S
+// DMA than the worst case program time
+bool flash_ops_can_program(bool playing);
+void flash_ops_erase(uint32_t offset, bool playing);
+void flash_ops_program(uint32_t offset, const uint8_t *data, bool playing);
+void flash_ops_get_stats(flash_ops_stats_t *stats);
@@ -0,0 +1,10 @@
+// Generated by generate-halfband.py, do not edit
+#pragma once
+#include <stdint.h>
+
+// 63 tap halfband, passband ripple 0.0019dB to 20000Hz,
+// stopband rejection 78.8dB from 28000Hz
+static const uint32_t HALFBAND_COEFF_BITS = 14;
+static const int16_t halfband_taps[16] = {
+    10393, -3366, 1906, -1248, 862, -607, 427, -297, 201, -132, 84, -50, 28, -14, 6, -2
+};
@@ -0,0 +1,165 @@
+#include "pico/stdlib.h"
+#include "hardware/timer.h"
+#include "hardware/watchdog.h"
+#include "hardware/sync.h"
+#include "bsp/board_api.h"
+#include "health.h"
+#include "i2s_audio.h"
+
+static const uint32_t CHECK_INTERVAL_US = 1000;
+
+// A frame goes out every 21us, so this is a long way past any normal gap
+static const uint32_t STALL_US = 3000;
+
+// Time for a recovery attempt to take effect before trying the next
+static const uint32_t RETRY_US = 3000;
+
+// DMA kick, PIO restart, PIO restart again, then give up
+static const uint32_t MAX_ATTEMPTS = 3;
+
+// A check this late means interrupts were off (eg: a flash write), which
+// also held up the DMA IRQ, so that gap doesn't count as a stall
+static const uint32_t CHECK_LATE_US = 2500;
+
+// Longer than any blocking the main loop does on purpose
+static const uint32_t WATCHDOG_MS = 2000;
+
+// Scratch 0 and 1 belong to the updater, 4-7 to the bootrom
+static const uint32_t WATCHDOG_SCRATCH = 2;
+static const uint32_t STALL_MAGIC = 0x484c5448;
+
+static repeating_timer_t timer;
+
+static uint32_t last_check_us = 0;
+static uint32_t last_progress_us = 0;
+static uint32_t last_position = 0;
+static bool recovering = false;
+static uint32_t detected_us = 0;
+static uint32_t last_attempt_us = 0;
+static uint32_t attempts = 0;
+static volatile bool gave_up = false;
+static volatile bool loop_paused = false;
+
+static uint32_t buffers = 0;
+static uint32_t rate_start_ms = 0;
+static uint32_t rate_buffers = 0;
+static uint32_t rate_frames = 0;
+
+static health_stats_t stats = {};
+
+static health_event_t *current_event() {
+    return &stats.log[(stats.log_count - 1) % HEALTH_LOG_SIZE];
+}
+
+static bool check(repeating_timer_t *rt) {
+    (void)rt;
+    // Standing in for the main loop, the DMA is still watched
+    if(loop_paused && !gave_up) watchdog_update();
+
+    uint32_t now = time_us_32();
+    uint32_t position = i2s_audio_dma_position();
+
+    bool late = now - last_check_us > CHECK_LATE_US;
+    last_check_us = now;
+
+    if(position != last_position) {
+        // The count runs down, so going up means the next buffer started
+        if(position > last_position) buffers++;
+        last_position = position;
+        last_progress_us = now;
+        if(gave_up) {
+            gave_up = false;
+            watchdog_hw->scratch[WATCHDOG_SCRATCH] = 0;
+        }
+        if(recovering) {
+            recovering = false;
+            health_event_t *event = current_event();
+            event->recover_us = now - detected_us;
+            stats.recovered++;
+            stats.worst_recover_us = MAX(stats.worst_recover_us, event->recover_us);
+        }
+        return true;
+    }
+
+    if(late) {
+        last_progress_us = now;
+        return true;
+    }
+
+    if(gave_up || now - last_progress_us < STALL_US) return true;
+
+    if(!recovering) {
+        recovering = true;
+        detected_us = now;
+        attempts = 0;
+        stats.stalls++;
+        stats.log_count++;
+        *current_event() = {
+            .time_ms = board_millis(),
+            .detect_us = now - last_progress_us,
+            .recover_us = 0,
+            .attempts = 0,
+        };
+    } else if(now - last_attempt_us < RETRY_US) {
+        return true;
+    }
+
+    if(attempts == MAX_ATTEMPTS) {
+        // Leave a note for after the reset, then stop feeding the watchdog
+        watchdog_hw->scratch[WATCHDOG_SCRATCH] = STALL_MAGIC;
+        gave_up = true;
+        return true;
+    }
+
+    i2s_audio_recover(attempts > 0);
+    attempts++;
+    current_event()->attempts = attempts;
+    last_attempt_us = now;
+    return true;
+}
+
+void health_init() {
+    if(watchdog_enable_caused_reboot()) {
+        stats.last_reset = watchdog_hw->scratch[WATCHDOG_SCRATCH] == STALL_MAGIC ? HEALTH_RESET_STALL : HEALTH_RESET_HANG;
+    }
+    watchdog_hw->scratch[WATCHDOG_SCRATCH] = 0;
+
+    last_check_us = last_progress_us = time_us_32();
+    last_position = i2s_audio_dma_position();
+    rate_start_ms = board_millis();
+
+    add_repeating_timer_us(-(int64_t)CHECK_INTERVAL_US, check, nullptr, &timer);
+    watchdog_enable(WATCHDOG_MS, true);
+}
+
+void health_task() {
+    if(!gave_up) watchdog_update();
+
+    uint32_t elapsed_ms = board_millis() - rate_start_ms;
+    if(elapsed_ms >= 1000) {
+        stats.buffers_per_sec = (buffers - rate_buffers) * 1000 / elapsed_ms;
+        stats.frames_per_sec = (i2s_audio_given_frames() - rate_frames) * 1000 / elapsed_ms;
+        rate_buffers = buffers;
+        rate_frames = i2s_audio_given_frames();
+        rate_start_ms = board_millis();
+    }
+}
+
+void health_pause_loop_watchdog(bool paused) {
+    if(!gave_up) watchdog_update();
+    loop_paused = paused;
+}
+
+void health_get_stats(health_stats_t *stats_out) {
+    uint32_t save = save_and_disable_interrupts();
+    *stats_out = stats;
+    restore_interrupts(save);
+
+    // Unroll the log so the oldest is first
+    uint32_t count = MIN(stats_out->log_count, HEALTH_LOG_SIZE);
+    uint32_t first = stats_out->log_count - count;
+    for(auto i = 0u; i < count; i++) {
+        stats_out->log[i] = stats.log[(first + i) % HEALTH_LOG_SIZE];
+    }
+    stats_out->dropped_buffers = i2s_audio_dropped_buffers();
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <stdint.h>
+
+// Audio pipeline health monitor. A 1ms timer interrupt watches the I2S DMA,
+// which never stops while the board is running (gaps are filled with
+// silence). If it stops moving, the DMA is kicked, then the PIO restarted as
+// well, and if neither works the watchdog is left to reset the board.
+// The timer keeps running even when the main loop is stuck waiting on the
+// wedged output, so recovery doesn't depend on it.
+
+// Recent stalls kept for the log
+static const uint32_t HEALTH_LOG_SIZE = 8;
+
+enum health_reset_t {
+    HEALTH_RESET_NONE,
+    HEALTH_RESET_STALL,     // Recovery failed and the watchdog was left to fire
+    HEALTH_RESET_HANG,      // The main loop stopped feeding the watchdog
+};
+
+typedef struct {
+    uint32_t time_ms;       // When the stall was detected
+    uint32_t detect_us;     // Last DMA progress to detection
+    uint32_t recover_us;    // Detection to DMA progress again, 0 if it never did
+    uint32_t attempts;      // 1 = DMA kick, 2+ = PIO restarted too
+} health_event_t;
+
+typedef struct {
+    uint32_t stalls;
+    uint32_t recovered;
+    uint32_t worst_recover_us;
+    uint32_t buffers_per_sec;   // I2S buffer turnover
+    uint32_t frames_per_sec;    // Frames given to I2S, from USB and the mixer
+    uint32_t dropped_buffers;   // Given with no free buffer to take them
+    health_reset_t last_reset;
+    uint32_t log_count;
+    health_event_t log[HEALTH_LOG_SIZE];  // Oldest first
+} health_stats_t;
+
+void health_init();
+// Feeds the watchdog, unless recovery has given up
+void health_task();
+// Feed the watchdog from the timer while the main loop blocks on purpose for
+// longer than it allows (eg: benchmarks). A stalled DMA still resets.
+void health_pause_loop_watchdog(bool paused);
+void health_get_stats(health_stats_t *stats);
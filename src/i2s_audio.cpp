@@ -4,11 +4,102 @@
 #include "board_config.h"
 #include "pico/stdlib.h"
 #include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/pio.h"
+#include "hardware/interp.h"
 #include "board.h"
 #include "tusb.h"
+#include "i2s_audio.h"
+#include "profile.h"
+#include "spectrum.h"
+#include "mixer.h"
+#include "sounds.h"
+#include "oversample.h"
+#include "audio_arena.h"
+#include "loudness.h"
+#include "vbass.h"
+#include "dsp.h"
+#include "i2s_ring.h"
+#include "fixed.h"
 #include <math.h>
+#include <string.h>
+#include <algorithm>
 
 static struct audio_buffer_pool *producer_pool;
+static uint dma_channel;
+
+// audio_i2s_connect_extra() copies what we give into AUDIO_I2S_BUFFERS buffers
+// of this many frames, and only queues each one for the DMA once it's full
+static const uint32_t I2S_CONSUMER_FRAMES = AUDIO_I2S_BUFFER_FRAMES;
+// Joined PIO TX FIFO, one word per stereo frame
+static const uint32_t I2S_FIFO_FRAMES = 8;
+// USB streams at 48kHz, I2S runs at twice that with AUDIO_OVERSAMPLE_2X
+static const uint32_t USB_SAMPLE_RATE = 48000;
+static const uint32_t OVERSAMPLE = AUDIO_OVERSAMPLE_2X ? 2 : 1;
+// Filters between USB and I2S that delay the signal
+static const uint32_t I2S_LOOKAHEAD_FRAMES = AUDIO_OVERSAMPLE_2X ? oversample_delay_frames() : 0;
+
+static uint32_t given_frames = 0;
+static uint32_t dropped_buffers = 0;
+
+// Stream start and stop, see i2s_audio_stream_open() and i2s_audio_stream_close()
+static const uint32_t FADE_FRAMES = AUDIO_FADE_FRAMES;
+// The first packet lands about a millisecond after SET_INTERFACE, then allow
+// a packet of jitter. In output frames.
+static const uint32_t PREROLL_LEAD_FRAMES = 2 * (USB_SAMPLE_RATE / 1000) * OVERSAMPLE;
+static uint32_t fade_in_position = FADE_FRAMES;
+static int16_t last_frame[2];
+static bool open_pending = false;
+static uint32_t open_us = 0;
+static i2s_audio_stream_stats_t stream_stats = {};
+
+// What it costs to get audio out, to compare the output engines
+static struct {
+    uint32_t start_us;
+    uint32_t irqs;
+    uint64_t irq_cycles;
+    uint32_t irq_max_cycles;
+    uint64_t give_cycles;
+    uint32_t given_frames;
+    uint32_t min_queued;
+    uint32_t last_give_us;
+} engine = {};
+
+#if !AUDIO_I2S_RING
+static uint32_t irq_start;
+
+static io_rw_32 *dma_irq_force() {
+    return PICO_AUDIO_I2S_DMA_IRQ ? &dma_hw->intf1 : &dma_hw->intf0;
+}
+
+// Runs before the pico_audio_i2s handler, which re-arms the DMA with the next
+// buffer and frees the last, to time it
+static void __isr dma_irq_enter() {
+    irq_start = profile_start();
+}
+
+// Runs after the pico_audio_i2s handler, so a completion forced by
+// i2s_audio_recover() is seen exactly once
+static void __isr dma_irq_force_clear() {
+    hw_clear_bits(dma_irq_force(), 1u << dma_channel);
+
+    uint32_t cycles = profile_cycles(irq_start);
+    engine.irqs++;
+    engine.irq_cycles += cycles;
+    engine.irq_max_cycles = std::max(engine.irq_max_cycles, cycles);
+}
+#endif
+
+static bool loopback_enabled = false;
+
+static void interp_kernel_init();
+
+// initialize for 48k we allow changing later
+static audio_format_t audio_format_i2s = {
+        .sample_freq = USB_SAMPLE_RATE * OVERSAMPLE,
+        .format = AUDIO_BUFFER_FORMAT_PCM_S16,
+        .channel_count = 2,
+};
 
 void i2s_audio_init() {
     gpio_init(PICO_AUDIO_I2S_AMP_ENABLE);
@@ -16,41 +107,49 @@ void i2s_audio_init() {
     gpio_set_dir(PICO_AUDIO_I2S_AMP_ENABLE, GPIO_OUT);
     gpio_put(PICO_AUDIO_I2S_AMP_ENABLE, 1); // SD_MODE also selects audio channel, must be HIGH to enable amp, LOW to shutdown
 
-    // initialize for 48k we allow changing later
-    static audio_format_t audio_format_48k = {
-            .sample_freq = 48000,
-            .format = AUDIO_BUFFER_FORMAT_PCM_S16,
-            .channel_count = 2,
-    };
-
     static audio_buffer_format_t producer_format = {
-            .format = &audio_format_48k,
+            .format = &audio_format_i2s,
             .sample_stride = sizeof(int16_t) * 2
     };
 
+    // Set up on this core whichever kernel is in use, the benchmark runs both
+    interp_kernel_init();
+
+    // An empty pool, filled with buffers from the arena
+    producer_pool = audio_new_producer_pool(&producer_format, 0, 0);
+    for(auto i = 0u; i < AUDIO_PRODUCER_BUFFERS; i++) {
+        mem_buffer_t *memory = pico_buffer_wrap((uint8_t *)audio_arena.producer[i], sizeof(audio_arena.producer[i]));
+        queue_free_audio_buffer(producer_pool, audio_new_wrapping_buffer(&producer_format, memory));
+    }
+
+#if AUDIO_I2S_RING
+    // Producer buffers are only somewhere to convert into on the way to the ring
+    i2s_ring_init(audio_format_i2s.sample_freq);
+#else
     // We need to make sure to claim an unused channel,
     // but then audio_i2s_setup tries to claim it again...
     // So claim & unclaim it, effectively checking it's unused.
-    uint dma_channel = dma_claim_unused_channel(true);
+    dma_channel = dma_claim_unused_channel(true);
     dma_channel_unclaim(dma_channel);
 
-    producer_pool = audio_new_producer_pool(&producer_format, 3, CFG_TUD_AUDIO_FUNC_1_EP_OUT_SW_BUF_SZ / sizeof(int16_t)); // todo correct size
-
     audio_i2s_config_t config = {
             .data_pin = PICO_AUDIO_I2S_DATA_PIN,
             .clock_pin_base = PICO_AUDIO_I2S_CLOCK_PIN_BASE,
-            .dma_channel = dma_channel,
+            .dma_channel = (uint8_t)dma_channel,
             .pio_sm = 0,
     };
 
     const audio_format_t *output_format;
-    output_format = audio_i2s_setup(&audio_format_48k, &config);
+    output_format = audio_i2s_setup(&audio_format_i2s, &config);
     if (!output_format) {
         panic("PicoAudio: Unable to open audio device.\n");
     }
 
+    irq_add_shared_handler(DMA_IRQ_0 + PICO_AUDIO_I2S_DMA_IRQ, dma_irq_enter, PICO_SHARED_IRQ_HANDLER_HIGHEST_ORDER_PRIORITY);
+    irq_add_shared_handler(DMA_IRQ_0 + PICO_AUDIO_I2S_DMA_IRQ, dma_irq_force_clear, PICO_SHARED_IRQ_HANDLER_LOWEST_ORDER_PRIORITY);
+
     bool __unused ok;
-    ok = audio_i2s_connect(producer_pool);
+    ok = audio_i2s_connect_extra(producer_pool, false, AUDIO_I2S_BUFFERS, AUDIO_I2S_BUFFER_FRAMES, NULL);
     assert(ok);
     {
         audio_buffer_t *buffer = take_audio_buffer(producer_pool, true);
@@ -60,13 +159,22 @@ void i2s_audio_init() {
             samples[i*2+1] = 0;
         }
         buffer->sample_count = buffer->max_sample_count;
+        given_frames += buffer->sample_count;
         give_audio_buffer(producer_pool, buffer);
     }
+#endif
+    engine.start_us = time_us_32();
+    engine.min_queued = UINT32_MAX;
+    stream_stats.min_open_us = UINT32_MAX;
 }
 
 static void core1_worker() {
     gpio_put(LED_R, 0);
+#if AUDIO_I2S_RING
+    i2s_ring_start();
+#else
     audio_i2s_set_enabled(true);
+#endif
     gpio_put(LED_R, 1);
 }
 
@@ -75,41 +183,777 @@ void i2s_audio_start() {
     //multicore_launch_core1(core1_worker);
 }
 
+// Raw bits of a little-endian IEEE-754 float sample
+struct float32_bits_t {
+    uint32_t bits;
+};
+
+// Per-block levels, kept in registers by the conversion loop and merged into
+// the running meter once per buffer.
+struct block_levels_t {
+    uint32_t peak[2];
+    uint64_t sum_squares[2];
+    uint32_t clips[2];
+    int32_t active;
+};
+
+static struct {
+    uint32_t peak[2];
+    uint64_t sum_squares[2];
+    uint32_t clips[2];
+    uint32_t frames;
+    uint32_t silent_frames;
+    uint32_t vu_peak;
+} meter;
+
+// Unpacking and saturation for the kernels, picked with AUDIO_INTERP_KERNEL.
+// Both give identical results.
+//
+// soft_kernel shifts to unpack and saturates with dsp_ssat16(), compares on
+// the M0+ and one SSAT on the M33.
+//
+// interp_kernel has the interpolators do both. interp0's lanes shift, mask and
+// sign extend a frame into two 16-bit samples: a 16-bit frame is a single word
+// load, lane 1 taking the top half through CROSS_INPUT, and 24-bit samples are
+// the top half of each word. interp1 lane 0 in clamp mode saturates in a store
+// and a load, with no compares or branches.
+struct soft_kernel {
+    static inline void begin(const int16_t *) {}
+    static inline void begin(const int32_t *) {}
+    static inline void begin(const float32_bits_t *) {}
+
+    static inline void unpack(const int16_t *in, int32_t *left, int32_t *right) {
+        *left = in[0];
+        *right = in[1];
+    }
+
+    // 24bit samples arrive left justified in 32bit slots
+    static inline void unpack(const int32_t *in, int32_t *left, int32_t *right) {
+        *left = in[0] >> 16;
+        *right = in[1] >> 16;
+    }
+
+    static inline int16_t clamp(int32_t value) {
+        return dsp_ssat16(value);
+    }
+};
+
+static interp_config interp_unpack_s16[2];
+static interp_config interp_unpack_s24;
+
+static void interp_kernel_init() {
+    interp_config config = interp_default_config();
+    interp_config_set_clamp(&config, true);
+    interp_config_set_signed(&config, true);
+    interp_set_config(interp1, 0, &config);
+    interp1->base[0] = INT16_MIN;
+    interp1->base[1] = INT16_MAX;
+
+    config = interp_default_config();
+    interp_config_set_mask(&config, 0, 15);
+    interp_config_set_signed(&config, true);
+    interp_unpack_s16[0] = config;
+    interp_config_set_shift(&config, 16);
+    interp_unpack_s24 = config;
+    interp_config_set_cross_input(&config, true);
+    interp_unpack_s16[1] = config;
+    interp0->base[0] = 0;
+    interp0->base[1] = 0;
+}
+
+struct interp_kernel {
+    static inline void begin(const int16_t *) {
+        interp_set_config(interp0, 0, &interp_unpack_s16[0]);
+        interp_set_config(interp0, 1, &interp_unpack_s16[1]);
+    }
+
+    static inline void begin(const int32_t *) {
+        interp_set_config(interp0, 0, &interp_unpack_s24);
+        interp_set_config(interp0, 1, &interp_unpack_s24);
+    }
+
+    static inline void begin(const float32_bits_t *) {}
+
+    // The frame must be word aligned, see convert_buffer()
+    static inline void unpack(const int16_t *in, int32_t *left, int32_t *right) {
+        uint32_t frame;
+        memcpy(&frame, __builtin_assume_aligned(in, 4), sizeof(frame));
+        interp0->accum[0] = frame;
+        *left = (int32_t)interp0->peek[0];
+        *right = (int32_t)interp0->peek[1];
+    }
+
+    static inline void unpack(const int32_t *in, int32_t *left, int32_t *right) {
+        interp0->accum[0] = in[0];
+        interp0->accum[1] = in[1];
+        *left = (int32_t)interp0->peek[0];
+        *right = (int32_t)interp0->peek[1];
+    }
+
+    static inline int16_t clamp(int32_t value) {
+        interp1->accum[0] = value;
+        return interp1->peek[0];
+    }
+};
+
+#if AUDIO_INTERP_KERNEL
+typedef interp_kernel audio_kernel;
+#else
+typedef soft_kernel audio_kernel;
+#endif
+
+// Per-format sample handling: a frame scaled to 16-bit with the volume
+// applied, and the clip and silence tests used by the meter.
+
+template<typename kernel_t, typename sample_t>
+static inline void frame_scale(const sample_t *in, uint8_t volume, int32_t *left, int32_t *right) {
+    kernel_t::unpack(in, left, right);
+    *left = (*left * volume) >> 8;
+    *right = (*right * volume) >> 8;
+}
+
+static inline bool sample_clips(int16_t in) {
+    return in == INT16_MAX || in == INT16_MIN;
+}
+
+static inline int32_t sample_bits(int16_t in) {
+    return in;
+}
+
+static inline bool sample_clips(int32_t in) {
+    return sample_clips((int16_t)(in >> 16));
+}
+
+static inline int32_t sample_bits(int32_t in) {
+    return in;
+}
+
+// IEEE-754 single precision, converted without touching the (soft) FPU.
+// |x| = m * 2^(e - 150) with the implicit leading one in m, so the 16-bit
+// output scaled by volume / 256 is (m * volume) >> (143 - e). m is 24 bits and
+// volume 8, so the product always fits in 32 bits.
+template<typename kernel_t>
+static inline int32_t sample_scale(float32_bits_t in, uint8_t volume) {
+    uint32_t exponent = (in.bits >> 23) & 0xff;
+    int32_t shift = 143 - (int32_t)exponent;
+
+    uint32_t magnitude;
+    if(shift >= 32) {
+        // Below 1 LSB, including zero and denormals
+        return 0;
+    } else if(exponent == 0xff && (in.bits & 0x7fffff)) {
+        // NaN
+        return 0;
+    } else if(shift <= 0) {
+        // Huge, or infinite
+        magnitude = volume ? 0x8000 : 0;
+    } else {
+        uint32_t mantissa = (in.bits & 0x7fffff) | 0x800000;
+        magnitude = (mantissa * volume) >> shift;
+    }
+
+    // At most 2^31 - 1, shift is at least 1
+    return kernel_t::clamp(in.bits & 0x80000000 ? -(int32_t)magnitude : (int32_t)magnitude);
+}
+
+template<typename kernel_t>
+static inline void frame_scale(const float32_bits_t *in, uint8_t volume, int32_t *left, int32_t *right) {
+    *left = sample_scale<kernel_t>(in[0], volume);
+    *right = sample_scale<kernel_t>(in[1], volume);
+}
+
+// Anything at or beyond +/-1.0, including infinities and NaN
+static inline bool sample_clips(float32_bits_t in) {
+    return ((in.bits >> 23) & 0xff) >= 127;
+}
+
+static inline int32_t sample_bits(float32_bits_t in) {
+    return in.bits & 0x7fffffff;
+}
+
+// Adds an output frame, and the input frame and system sound at i it came
+// from, to the block's levels
+template<typename sample_t, bool mixing>
+static inline void meter_frame(block_levels_t *levels, int16_t out_left, int16_t out_right, const sample_t *in, const int16_t *mix, uint i) {
+    uint32_t abs_left = out_left < 0 ? -out_left : out_left;
+    uint32_t abs_right = out_right < 0 ? -out_right : out_right;
+    if(abs_left > levels->peak[0]) levels->peak[0] = abs_left;
+    if(abs_right > levels->peak[1]) levels->peak[1] = abs_right;
+
+    levels->sum_squares[0] += abs_left * abs_left;
+    levels->sum_squares[1] += abs_right * abs_right;
+
+    if(sample_clips(in[i+0])) levels->clips[0]++;
+    if(sample_clips(in[i+1])) levels->clips[1]++;
+
+    levels->active |= sample_bits(in[i+0]) | sample_bits(in[i+1]) | (mixing ? mix[i+0] | mix[i+1] : 0);
+}
+
+// Convert interleaved USB samples to the swapped, volume scaled I2S output.
+// With metering enabled the same loop accumulates peak, RMS, clipping and
+// silence so the buffer is never walked twice. With mixing enabled a block of
+// system sounds is summed in at the master volume and the result saturated.
+template<typename sample_t, bool metering, bool mixing=false, typename kernel_t=audio_kernel>
+static inline void convert(int16_t *out, const sample_t *in, size_t samples, uint8_t volume, block_levels_t *levels, const int16_t *mix=nullptr) {
+    kernel_t::begin(in);
+    for (uint i = 0u; i < samples * 2; i+=2) {
+        int32_t left, right;
+        frame_scale<kernel_t>(&in[i], volume, &left, &right);
+
+        if(mixing) {
+            left += (mix[i+0] * volume) >> 8;
+            right += (mix[i+1] * volume) >> 8;
+        }
+
+        int16_t out_left = mixing ? kernel_t::clamp(left) : left;
+        int16_t out_right = mixing ? kernel_t::clamp(right) : right;
+
+        out[i+0] = out_right;
+        out[i+1] = out_left;
+
+        if(metering) meter_frame<sample_t, mixing>(levels, out_left, out_right, in, mix, i);
+    }
+}
+
+// The metering on its own, for a block already converted by dsp_convert_s16()
+template<typename sample_t, bool mixing>
+static void meter_block(const int16_t *out, const sample_t *in, size_t samples, block_levels_t *levels, const int16_t *mix) {
+    for (uint i = 0u; i < samples * 2; i+=2) {
+        meter_frame<sample_t, mixing>(levels, out[i+1], out[i+0], in, mix, i);
+    }
+}
+
+static void meter_update(const block_levels_t *levels, size_t samples) {
+    for(auto c = 0u; c < 2; c++) {
+        if(levels->peak[c] > meter.peak[c]) meter.peak[c] = levels->peak[c];
+        if(levels->peak[c] > meter.vu_peak) meter.vu_peak = levels->peak[c];
+        meter.sum_squares[c] += levels->sum_squares[c];
+        meter.clips[c] += levels->clips[c];
+    }
+    meter.frames += samples;
+    meter.silent_frames = levels->active ? 0 : meter.silent_frames + samples;
+}
+
+// Room for the 48kHz frames that fit in a buffer once they're oversampled
+static size_t max_input_frames(const struct audio_buffer *audio_buffer) {
+    size_t frames = audio_buffer->max_sample_count / OVERSAMPLE;
+#if AUDIO_OVERSAMPLE_2X
+    if(frames > OVERSAMPLE_MAX_FRAMES) frames = OVERSAMPLE_MAX_FRAMES;
+#endif
+    return frames;
+}
+
+// Anything that runs at 48kHz has to be done by now
+static void oversample_buffer(struct audio_buffer *audio_buffer) {
+#if AUDIO_OVERSAMPLE_2X
+    oversample_2x((int16_t *)audio_buffer->buffer->bytes, audio_buffer->sample_count);
+    audio_buffer->sample_count *= 2;
+#else
+    (void)audio_buffer;
+#endif
+}
+
+template<typename sample_t, typename kernel_t>
+static void convert_metered(int16_t *out, const sample_t *in, size_t samples, uint8_t volume, block_levels_t *levels, const int16_t *mix) {
+#if DSP_TARGET == DSP_SIMD
+    // On the M33 16-bit frames go through the SIMD kernel, a pair of samples
+    // at a time, and are metered after. The M0+ keeps the loop above, which
+    // meters as it converts and can unpack with the interpolator.
+    if(sizeof(sample_t) == 2) {
+        const int16_t *in16 = (const int16_t *)in;
+        dsp_convert_s16(out, in16, samples, volume, mix);
+        if(mix) {
+            meter_block<int16_t, true>(out, in16, samples, levels, mix);
+        } else {
+            meter_block<int16_t, false>(out, in16, samples, levels, mix);
+        }
+        return;
+    }
+#endif
+    if(mix) {
+        convert<sample_t, true, true, kernel_t>(out, in, samples, volume, levels, mix);
+    } else {
+        convert<sample_t, true, false, kernel_t>(out, in, samples, volume, levels);
+    }
+}
+
+template<typename sample_t>
+static size_t convert_buffer(struct audio_buffer *audio_buffer, void *src, size_t len, uint8_t volume) {
+    int16_t *out = (int16_t *) audio_buffer->buffer->bytes;
+    const sample_t *in = (const sample_t *) src;
+
+    size_t in_samples = len / sizeof(sample_t) / 2;
+    size_t samples = max_input_frames(audio_buffer);
+    if(in_samples < samples) samples = in_samples;
+
+    block_levels_t levels = {};
+    const int16_t *mix = mixer_system_take(samples);
+    // The interpolator takes a 16-bit frame as one word load, which has to be aligned
+    if(AUDIO_INTERP_KERNEL && sizeof(sample_t) == 2 && ((uintptr_t)in & 3)) {
+        convert_metered<sample_t, soft_kernel>(out, in, samples, volume, &levels, mix);
+    } else {
+        convert_metered<sample_t, audio_kernel>(out, in, samples, volume, &levels, mix);
+    }
+    meter_update(&levels, samples);
+
+    return samples;
+}
+
+// Hands a converted buffer over to I2S
+static void give(struct audio_buffer *audio_buffer) {
+    // Only while playing continuously, a stream always starts with the queue empty
+    uint32_t now = time_us_32();
+    if(now - engine.last_give_us < 2000) {
+        engine.min_queued = std::min(engine.min_queued, i2s_audio_queued_frames());
+    }
+    engine.last_give_us = now;
+
+    given_frames += audio_buffer->sample_count;
+    engine.given_frames += audio_buffer->sample_count;
+    uint32_t start = profile_start();
+#if AUDIO_I2S_RING
+    i2s_ring_write((const int16_t *)audio_buffer->buffer->bytes, audio_buffer->sample_count);
+    queue_free_audio_buffer(producer_pool, audio_buffer);
+#else
+    give_audio_buffer(producer_pool, audio_buffer);
+#endif
+    engine.give_cycles += profile_cycles(start);
+}
+
+// Ramps the first FADE_FRAMES after i2s_audio_stream_open() up from silence
+static void fade_in(int16_t *samples, size_t frames) {
+    for(auto i = 0u; i < frames && fade_in_position < FADE_FRAMES; i++, fade_in_position++) {
+        int32_t gain = (fade_in_position << 15) / FADE_FRAMES;
+        samples[i * 2 + 0] = fixed_shr_round(samples[i * 2 + 0] * gain, 15);
+        samples[i * 2 + 1] = fixed_shr_round(samples[i * 2 + 1] * gain, 15);
+    }
+}
+
+// SET_INTERFACE to the first sample of the stream at the pins, estimated
+// from the queue ahead of it as it's given
+static void stream_opened() {
+    uint32_t queued_us = (uint32_t)((uint64_t)i2s_audio_queued_frames() * 1000000u / audio_format_i2s.sample_freq);
+    stream_stats.last_open_us = time_us_32() - open_us + queued_us;
+    stream_stats.max_open_us = std::max(stream_stats.max_open_us, stream_stats.last_open_us);
+    stream_stats.min_open_us = std::min(stream_stats.min_open_us, stream_stats.last_open_us);
+    open_pending = false;
+}
+
 void i2s_audio_give_buffer(void *src, size_t len, uint8_t bit_depth, uint8_t volume) {
+    if(open_pending) stream_opened();
+
     struct audio_buffer *audio_buffer = take_audio_buffer(producer_pool, false);
 
     if(audio_buffer) {
-        int16_t *out = (int16_t *) audio_buffer->buffer->bytes;
-
         if(bit_depth == 16) {
-            int16_t *in = (int16_t *) src;
+            audio_buffer->sample_count = convert_buffer<int16_t>(audio_buffer, src, len, volume);
+        } else if (bit_depth == 24) {
+            audio_buffer->sample_count = convert_buffer<int32_t>(audio_buffer, src, len, volume);
+        } else if (bit_depth == 32) {
+            audio_buffer->sample_count = convert_buffer<float32_bits_t>(audio_buffer, src, len, volume);
+        }
 
-            size_t in_samples = len / sizeof(int16_t) / 2;
-            size_t samples = audio_buffer->max_sample_count;
-            if(in_samples < samples) samples = in_samples;
+        if(vbass_enabled()) {
+            vbass_process((int16_t *)audio_buffer->buffer->bytes, audio_buffer->sample_count);
+        }
+        if(loudness_enabled()) {
+            loudness_process((int16_t *)audio_buffer->buffer->bytes, audio_buffer->sample_count, volume);
+        }
 
-            for (uint i = 0u; i < samples * 2; i+=2) {
-                out[i+0] = ((uint32_t)in[i+1] * volume) / 256;
-                out[i+1] = ((uint32_t)in[i+0] * volume) / 256;
-            }
+        fade_in((int16_t *)audio_buffer->buffer->bytes, audio_buffer->sample_count);
 
-            audio_buffer->sample_count = samples;
+        // UI sounds go in after the volume so they're heard even when muted
+        sounds_mix((int16_t *)audio_buffer->buffer->bytes, audio_buffer->sample_count);
 
-        } else if (bit_depth == 24) {
-            int32_t *in = (int32_t *) src;
+        if(audio_buffer->sample_count) {
+            memcpy(last_frame, (int16_t *)audio_buffer->buffer->bytes + (audio_buffer->sample_count - 1) * 2, sizeof(last_frame));
+        }
 
-            size_t in_samples = len / sizeof(int32_t) / 2;
-            size_t samples = audio_buffer->max_sample_count;
-            if(in_samples < samples) samples = in_samples;
+        spectrum_push((const int16_t *)audio_buffer->buffer->bytes, audio_buffer->sample_count);
 
-            for (uint i = 0u; i < samples * 2; i+=2) {
-                out[i+0] = ((in[i+1] / 65536) * volume) / 256;
-                out[i+1] = ((in[i+0] / 65536) * volume) / 256;
-            }
+#if AUDIO_LOOPBACK
+        // Queue a copy of exactly what I2S is about to play for the IN endpoint.
+        // Playback never waits on this, if the host isn't reading it's dropped.
+        if(loopback_enabled) {
+            tud_audio_write(audio_buffer->buffer->bytes, audio_buffer->sample_count * audio_buffer->format->sample_stride);
+        }
+#endif
+
+        oversample_buffer(audio_buffer);
+
+        give(audio_buffer);
+    } else {
+        dropped_buffers++;
+    }
+}
+
+// Hand a block straight to I2S, bypassing conversion, mixing and metering.
+// `starved` is set if I2S had nothing else queued, ie: it nearly ran dry.
+bool i2s_audio_give_direct(i2s_audio_fill_t fill, size_t frames, bool *starved) {
+    struct audio_buffer *audio_buffer = take_audio_buffer(producer_pool, false);
+    if(!audio_buffer) return false;
+
+    size_t max_frames = max_input_frames(audio_buffer);
+    if(frames > max_frames) frames = max_frames;
+    fill((int16_t *)audio_buffer->buffer->bytes, frames);
+    audio_buffer->sample_count = frames;
+    oversample_buffer(audio_buffer);
+
+#if AUDIO_I2S_RING
+    i2s_ring_service();
+    *starved = i2s_ring_queued() == 0;
+#else
+    *starved = producer_pool->prepared_list == nullptr;
+#endif
+    give(audio_buffer);
+    return true;
+}
+
+// Play system sounds on their own while the main stream is idle
+void i2s_audio_give_mix(size_t samples, uint8_t volume) {
+    static const int16_t silence[96 * 2] = {};
+    if(samples > count_of(silence) / 2) samples = count_of(silence) / 2;
+    i2s_audio_give_buffer((void *)silence, samples * sizeof(int16_t) * 2, 16, volume);
+}
+
+// Gives `frames` output frames, ramping from `from` down to silence over the
+// first `ramp` of them. Passes through the oversampler like everything else.
+static void give_ramp(const int16_t from[2], uint32_t ramp, uint32_t frames) {
+    uint32_t position = 0;
+    while(frames - position >= OVERSAMPLE) {
+        struct audio_buffer *audio_buffer = take_audio_buffer(producer_pool, false);
+        if(!audio_buffer) {
+            dropped_buffers++;
+            return;
+        }
 
-            audio_buffer->sample_count = samples;
+        int16_t *samples = (int16_t *)audio_buffer->buffer->bytes;
+        size_t count = std::min<size_t>(max_input_frames(audio_buffer), (frames - position) / OVERSAMPLE);
+        for(auto i = 0u; i < count; i++) {
+            uint32_t k = position / OVERSAMPLE + i;
+            int32_t gain = k < ramp ? ((ramp - 1 - k) << 15) / ramp : 0;
+            samples[i * 2 + 0] = fixed_shr_round(from[0] * gain, 15);
+            samples[i * 2 + 1] = fixed_shr_round(from[1] * gain, 15);
         }
+        audio_buffer->sample_count = count;
+        oversample_buffer(audio_buffer);
 
-        give_audio_buffer(producer_pool, audio_buffer);
+        position += audio_buffer->sample_count;
+        give(audio_buffer);
     }
-}
\ No newline at end of file
+}
+
+// Frames to the end of the I2S buffer being filled, which only plays once full.
+// The ring plays whatever it's given.
+static uint32_t consumer_space() {
+    if(AUDIO_I2S_RING) return 0;
+    return (I2S_CONSUMER_FRAMES - given_frames % I2S_CONSUMER_FRAMES) % I2S_CONSUMER_FRAMES;
+}
+
+// Pre-rolls silence so the stream's first I2S buffer fills PREROLL_LEAD_FRAMES
+// before the DMA needs it, at whichever buffer boundary comes first. Any
+// earlier and the queue would have no margin, any later and it waits a whole
+// extra buffer. Either way the first sample then plays one buffer plus the
+// lead after SET_INTERFACE, the same as the steady state latency. The ring
+// needs none, the first write starts a lead ahead of the DMA.
+void i2s_audio_stream_open(uint32_t set_interface_us) {
+    uint32_t remaining = i2s_audio_dma_position();
+    uint32_t target = (I2S_CONSUMER_FRAMES + PREROLL_LEAD_FRAMES - remaining % I2S_CONSUMER_FRAMES) % I2S_CONSUMER_FRAMES;
+    uint32_t fill = given_frames % I2S_CONSUMER_FRAMES;
+    uint32_t preroll = (target + I2S_CONSUMER_FRAMES - fill) % I2S_CONSUMER_FRAMES;
+    preroll -= preroll % OVERSAMPLE;
+    if(AUDIO_I2S_RING) preroll = 0;
+
+    static const int16_t silence[2] = {};
+    give_ramp(silence, 0, preroll);
+
+    fade_in_position = 0;
+    open_us = set_interface_us;
+    open_pending = true;
+    stream_stats.opens++;
+    stream_stats.preroll_frames = preroll;
+}
+
+// Nothing follows the last packet, so rather than stopping dead wherever the
+// waveform was, ramp down from the last frame played. Then fill out the I2S
+// buffer with silence so it plays now, instead of waiting for the next sound.
+void i2s_audio_stream_close() {
+    give_ramp(last_frame, FADE_FRAMES, FADE_FRAMES * OVERSAMPLE);
+    give_ramp(last_frame, 0, consumer_space());
+
+    memset(last_frame, 0, sizeof(last_frame));
+    open_pending = false;
+    stream_stats.closes++;
+}
+
+void i2s_audio_get_stream_stats(i2s_audio_stream_stats_t *stats) {
+    *stats = stream_stats;
+}
+
+// Audio left in the buffer the DMA is currently playing, one 32bit transfer per
+// frame. For the ring, everything ahead of the DMA.
+uint32_t i2s_audio_dma_remaining_us() {
+#if AUDIO_I2S_RING
+    return i2s_ring_queued() * 1000000u / audio_format_i2s.sample_freq;
+#else
+    if(!dma_channel_is_busy(dma_channel)) return 0;
+    return dma_channel_hw_addr(dma_channel)->transfer_count * 1000000u / audio_format_i2s.sample_freq;
+#endif
+}
+
+// Frames given but not yet out of the I2S pins: the part filled consumer
+// buffer, what's left of the one the DMA is playing and the PIO FIFO.
+// While streaming the first two add up to about one consumer buffer.
+uint32_t i2s_audio_queued_frames() {
+#if AUDIO_I2S_RING
+    return i2s_ring_queued() + I2S_FIFO_FRAMES + I2S_LOOKAHEAD_FRAMES;
+#else
+    uint32_t frames = given_frames % I2S_CONSUMER_FRAMES + I2S_FIFO_FRAMES + I2S_LOOKAHEAD_FRAMES;
+    if(dma_channel_is_busy(dma_channel)) frames += dma_channel_hw_addr(dma_channel)->transfer_count;
+    return frames;
+#endif
+}
+
+// Frames left in the current DMA transfer, 0 once it has stopped
+uint32_t i2s_audio_dma_position() {
+#if AUDIO_I2S_RING
+    return i2s_ring_position();
+#else
+    if(!dma_channel_is_busy(dma_channel)) return 0;
+    return dma_channel_hw_addr(dma_channel)->transfer_count;
+#endif
+}
+
+uint32_t i2s_audio_given_frames() {
+    return given_frames;
+}
+
+uint32_t i2s_audio_dropped_buffers() {
+    return dropped_buffers;
+}
+
+#if AUDIO_I2S_RING
+void i2s_audio_recover(bool restart_pio) {
+    i2s_ring_restart(restart_pio);
+}
+
+void i2s_audio_inject_stall() {
+    i2s_ring_stop();
+}
+#else
+// Aborting can raise a completion of its own, keep it masked until the channel is idle
+static void dma_abort() {
+    dma_irqn_set_channel_enabled(PICO_AUDIO_I2S_DMA_IRQ, dma_channel, false);
+    dma_channel_abort(dma_channel);
+    dma_irqn_acknowledge_channel(PICO_AUDIO_I2S_DMA_IRQ, dma_channel);
+    dma_irqn_set_channel_enabled(PICO_AUDIO_I2S_DMA_IRQ, dma_channel, true);
+}
+
+// Get a stalled output going again without touching USB. The DMA completion
+// IRQ is forced so pico_audio_i2s releases the buffer it was playing and
+// starts the next one, just as if the transfer had finished. Restarting the
+// PIO as well covers a state machine that's stopped taking data.
+void i2s_audio_recover(bool restart_pio) {
+    uint32_t save = save_and_disable_interrupts();
+
+    dma_abort();
+
+    if(restart_pio) {
+        PIO pio = pio_get_instance(PICO_AUDIO_I2S_PIO);
+        pio_sm_set_enabled(pio, 0, false);
+        pio_sm_clear_fifos(pio, 0);
+        pio_sm_restart(pio, 0);
+        // The audio_i2s program's entry point is its last instruction, the start of a frame
+        uint entry = (pio->sm[0].execctrl & PIO_SM0_EXECCTRL_WRAP_TOP_BITS) >> PIO_SM0_EXECCTRL_WRAP_TOP_LSB;
+        pio_sm_exec(pio, 0, pio_encode_jmp(entry));
+        pio_sm_set_enabled(pio, 0, true);
+    }
+
+    hw_set_bits(dma_irq_force(), 1u << dma_channel);
+    restore_interrupts(save);
+}
+
+// Stop the DMA dead, to test the recovery
+void i2s_audio_inject_stall() {
+    uint32_t save = save_and_disable_interrupts();
+    dma_abort();
+    restore_interrupts(save);
+}
+#endif
+
+uint32_t i2s_audio_nominal_frames() {
+#if AUDIO_I2S_RING
+    return AUDIO_I2S_RING_LEAD_FRAMES + I2S_FIFO_FRAMES + I2S_LOOKAHEAD_FRAMES;
+#else
+    return (AUDIO_I2S_BUFFERS - 1) * I2S_CONSUMER_FRAMES + I2S_FIFO_FRAMES + I2S_LOOKAHEAD_FRAMES;
+#endif
+}
+
+void i2s_audio_task() {
+#if AUDIO_I2S_RING
+    i2s_ring_service();
+#endif
+}
+
+void i2s_audio_get_engine_stats(i2s_audio_engine_stats_t *stats, bool reset) {
+    uint32_t save = save_and_disable_interrupts();
+    uint32_t now = time_us_32();
+    *stats = {
+        .ring = AUDIO_I2S_RING != 0,
+        .elapsed_us = now - engine.start_us,
+        .irqs = engine.irqs,
+        .irq_cycles = engine.irq_cycles,
+        .irq_max_cycles = engine.irq_max_cycles,
+        .give_cycles = engine.give_cycles,
+        .given_frames = engine.given_frames,
+        .min_queued = engine.min_queued,
+        .nominal = i2s_audio_nominal_frames(),
+        .underruns = 0,
+        .overruns = 0,
+        .laps = 0,
+    };
+    if(reset) {
+        engine = {};
+        engine.start_us = now;
+        engine.min_queued = UINT32_MAX;
+    }
+    restore_interrupts(save);
+
+#if AUDIO_I2S_RING
+    i2s_ring_stats_t ring;
+    i2s_ring_get_stats(&ring, reset);
+    stats->underruns = ring.underruns;
+    stats->overruns = ring.overruns;
+    stats->laps = ring.laps;
+#endif
+}
+
+uint32_t i2s_audio_sample_rate() {
+    return audio_format_i2s.sample_freq;
+}
+
+void i2s_audio_set_loopback(bool enabled) {
+    loopback_enabled = enabled;
+}
+
+static uint16_t isqrt(uint32_t value) {
+    uint32_t result = 0;
+    uint32_t bit = 1u << 30;
+    while(bit > value) bit >>= 2;
+    while(bit) {
+        if(value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return result;
+}
+
+void i2s_audio_get_levels(i2s_audio_levels_t *levels, bool reset) {
+    for(auto c = 0u; c < 2; c++) {
+        levels->peak[c] = meter.peak[c];
+        levels->rms[c] = meter.frames ? isqrt(meter.sum_squares[c] / meter.frames) : 0;
+        levels->clips[c] = meter.clips[c];
+    }
+    levels->frames = meter.frames;
+    levels->silent_ms = meter.silent_frames / (USB_SAMPLE_RATE / 1000);
+
+    if(reset) {
+        uint32_t silent_frames = meter.silent_frames;
+        uint32_t vu_peak = meter.vu_peak;
+        meter = {};
+        meter.silent_frames = silent_frames;
+        meter.vu_peak = vu_peak;
+    }
+}
+
+uint16_t i2s_audio_take_vu_peak() {
+    uint16_t peak = meter.vu_peak;
+    meter.vu_peak = 0;
+    return peak;
+}
+
+template<typename sample_t, typename kernel_t>
+static void bench_convert(int16_t *out, const void *in, size_t samples, bool metering, bool mixing, const int16_t *mix) {
+    block_levels_t levels = {};
+    if(mixing) {
+        convert<sample_t, true, true, kernel_t>(out, (const sample_t *)in, samples, 200, &levels, mix);
+    } else if(metering) {
+        convert<sample_t, true, false, kernel_t>(out, (const sample_t *)in, samples, 200, &levels);
+    } else {
+        convert<sample_t, false, false, kernel_t>(out, (const sample_t *)in, samples, 200, &levels);
+    }
+}
+
+template<typename sample_t>
+static void bench_convert(int16_t *out, const void *in, size_t samples, bool metering, bool mixing, const int16_t *mix, bool interp) {
+    if(interp) {
+        bench_convert<sample_t, interp_kernel>(out, in, samples, metering, mixing, mix);
+    } else {
+        bench_convert<sample_t, soft_kernel>(out, in, samples, metering, mixing, mix);
+    }
+}
+
+// The obvious float conversion, for comparison with the integer-only kernel
+static void __attribute__((noinline)) bench_convert_soft_float(int16_t *out, const float *in, size_t samples) {
+    const float gain = 32768.0f * 200 / 256;
+    for (uint i = 0u; i < samples * 2; i+=2) {
+        float left = in[i+0] * gain;
+        float right = in[i+1] * gain;
+        out[i+0] = right >= INT16_MAX ? INT16_MAX : right <= INT16_MIN ? INT16_MIN : (int16_t)right;
+        out[i+1] = left >= INT16_MAX ? INT16_MAX : left <= INT16_MIN ? INT16_MIN : (int16_t)left;
+    }
+}
+
+static const size_t BENCH_KERNEL_SAMPLES = 48;
+static int32_t bench_in[BENCH_KERNEL_SAMPLES * 2];
+static int16_t bench_out[BENCH_KERNEL_SAMPLES * 2];
+static int16_t bench_mix[BENCH_KERNEL_SAMPLES * 2];
+
+void i2s_audio_bench_kernel_init(uint8_t bit_depth) {
+    for(auto i = 0u; i < BENCH_KERNEL_SAMPLES * 2; i++) {
+        if(bit_depth == 32 || bit_depth == 0) {
+            // Floats spread over +/-1.0, with a few out of range
+            ((float *)bench_in)[i] = (float)(int32_t)(i * 0x01234567u) / (float)INT32_MAX * 1.1f;
+        } else {
+            bench_in[i] = (int32_t)(i * 0x01234567u);
+        }
+    }
+}
+
+void i2s_audio_run_kernel(uint8_t bit_depth, bool metering, bool mixing, bool interp) {
+    switch(bit_depth) {
+        case 0:
+            bench_convert_soft_float(bench_out, (const float *)bench_in, BENCH_KERNEL_SAMPLES);
+            break;
+        case 16:
+            bench_convert<int16_t>(bench_out, bench_in, BENCH_KERNEL_SAMPLES, metering, mixing, bench_mix, interp);
+            break;
+        case 24:
+            bench_convert<int32_t>(bench_out, bench_in, BENCH_KERNEL_SAMPLES, metering, mixing, bench_mix, interp);
+            break;
+        case 32:
+            bench_convert<float32_bits_t>(bench_out, bench_in, BENCH_KERNEL_SAMPLES, metering, mixing, bench_mix, interp);
+            break;
+    }
+}
+
+// Time one 1ms packet through the plain, metering or metering + mixing kernel,
+// saturating in software or with the interpolator.
+// A bit_depth of 0 times the soft-float reference for 32bit float input.
+// Returns the best of several runs in system clock cycles.
+uint32_t i2s_audio_bench_kernel(uint8_t bit_depth, bool metering, bool mixing, bool interp) {
+    i2s_audio_bench_kernel_init(bit_depth);
+
+    uint32_t best = UINT32_MAX;
+    for(auto run = 0u; run < 8; run++) {
+        uint32_t start = profile_start();
+        i2s_audio_run_kernel(bit_depth, metering, mixing, interp);
+        uint32_t cycles = profile_cycles(start);
+        if(cycles < best) best = cycles;
+    }
+    return best;
+}
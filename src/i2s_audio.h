@@ -1,3 +1,90 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// Unpack and saturate in the conversion kernels with the interpolators rather
+// than shifts and compares
+#ifndef AUDIO_INTERP_KERNEL
+#define AUDIO_INTERP_KERNEL 0
+#endif
+
+// Length of the fades as a stream starts and stops, in 48kHz frames
+#ifndef AUDIO_FADE_FRAMES
+#define AUDIO_FADE_FRAMES 96
+#endif
+
+// Signal levels accumulated by the conversion kernel since the last reset.
+// Channel 0 is USB left, channel 1 is USB right.
+typedef struct {
+    uint16_t peak[2];      // Output peak, 0 - 32768
+    uint16_t rms[2];       // Output RMS, 0 - 32768
+    uint32_t clips[2];     // Input samples at digital full scale
+    uint32_t frames;       // Frames measured
+    uint32_t silent_ms;    // Duration of continuous digital silence on the input
+} i2s_audio_levels_t;
+
 void i2s_audio_init();
 void i2s_audio_start();
-void i2s_audio_give_buffer(void *src, size_t len, uint8_t bit_depth, uint8_t volume);
\ No newline at end of file
+void i2s_audio_give_buffer(void *src, size_t len, uint8_t bit_depth, uint8_t volume);
+
+void i2s_audio_give_mix(size_t samples, uint8_t volume);
+
+typedef void (*i2s_audio_fill_t)(int16_t *out, size_t frames);
+bool i2s_audio_give_direct(i2s_audio_fill_t fill, size_t frames, bool *starved);
+void i2s_audio_set_loopback(bool enabled);
+uint32_t i2s_audio_dma_remaining_us();
+// Playback latency from i2s_audio_give_buffer() to the I2S pins
+uint32_t i2s_audio_queued_frames();
+uint32_t i2s_audio_nominal_frames();
+uint32_t i2s_audio_sample_rate();
+
+// Progress and recovery for the health monitor
+uint32_t i2s_audio_dma_position();
+uint32_t i2s_audio_given_frames();
+uint32_t i2s_audio_dropped_buffers();
+void i2s_audio_recover(bool restart_pio);
+void i2s_audio_inject_stall();
+
+// Speaker stream transitions, from the main loop after SET_INTERFACE
+typedef struct {
+    uint32_t opens;
+    uint32_t closes;
+    uint32_t preroll_frames;    // Silence ahead of the last stream opened
+    uint32_t last_open_us;      // SET_INTERFACE to the first sample at the pins
+    uint32_t min_open_us;
+    uint32_t max_open_us;
+} i2s_audio_stream_stats_t;
+
+// Pre-rolls silence and fades in whatever is given next
+void i2s_audio_stream_open(uint32_t set_interface_us);
+// Fades out from the last frame given and flushes it to the pins
+void i2s_audio_stream_close();
+void i2s_audio_get_stream_stats(i2s_audio_stream_stats_t *stats);
+
+// What getting audio out costs, since the last reset
+typedef struct {
+    bool ring;                  // Output from i2s_ring.cpp rather than pico_audio_i2s
+    uint32_t elapsed_us;
+    uint32_t irqs;              // Audio DMA interrupts
+    uint64_t irq_cycles;        // In the pico_audio_i2s handler
+    uint32_t irq_max_cycles;
+    uint64_t give_cycles;       // Handing converted buffers over
+    uint32_t given_frames;
+    uint32_t min_queued;        // Fewest frames queued before a give, while streaming
+    uint32_t nominal;           // i2s_audio_nominal_frames()
+    uint32_t underruns;         // Ring only
+    uint32_t overruns;
+    uint32_t laps;
+} i2s_audio_engine_stats_t;
+
+// Services the output engine, from the main loop
+void i2s_audio_task();
+void i2s_audio_get_engine_stats(i2s_audio_engine_stats_t *stats, bool reset);
+
+void i2s_audio_get_levels(i2s_audio_levels_t *levels, bool reset);
+uint16_t i2s_audio_take_vu_peak();
+uint32_t i2s_audio_bench_kernel(uint8_t bit_depth, bool metering, bool mixing=false, bool interp=false);
+// The same packet through the kernel untimed, for bench_cases.cpp. Set up the
+// input for bit_depth first.
+void i2s_audio_bench_kernel_init(uint8_t bit_depth);
+void i2s_audio_run_kernel(uint8_t bit_depth, bool metering, bool mixing=false, bool interp=false);
@@ -0,0 +1,202 @@
+#include <string.h>
+#include <algorithm>
+
+#include "pico/stdlib.h"
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/pio.h"
+#include "hardware/sync.h"
+#include "audio_i2s.pio.h"
+#include "i2s_ring.h"
+
+static const uint32_t RING_FRAMES = AUDIO_I2S_RING_FRAMES;
+static const uint32_t LEAD_FRAMES = AUDIO_I2S_RING_LEAD_FRAMES;
+static const uint SM = 0;
+
+static_assert(LEAD_FRAMES < RING_FRAMES / 2, "The lead must leave room in the ring to write ahead");
+
+// One stereo frame per word, as the audio_i2s program takes them
+static uint32_t ring[RING_FRAMES];
+// Read by the control channel, which writes it to the data channel's read address
+static uint32_t *ring_start = ring;
+
+static PIO pio;
+static uint data_channel;
+static uint control_channel;
+static dma_channel_config data_config;
+
+static uint32_t write_index = 0;    // Where the next frame goes
+static uint32_t read_index = 0;     // Where the DMA was at the last service
+static uint32_t queued = 0;         // Frames between the two
+// Set by i2s_ring_restart(), from the health monitor's interrupt. Service and
+// write run with interrupts off, so it's only ever seen between them.
+static volatile bool restarted = false;
+
+// A gap between services this long, a lead short of a whole ring, may have
+// let the DMA go round and play the ring again
+static uint32_t lap_us;
+static uint32_t service_us = 0;
+
+static i2s_ring_stats_t stats;
+
+void i2s_ring_init(uint32_t sample_freq) {
+    pio = pio_get_instance(PICO_AUDIO_I2S_PIO);
+    pio_sm_claim(pio, SM);
+    uint offset = pio_add_program(pio, &audio_i2s_program);
+    audio_i2s_program_init(pio, SM, offset, PICO_AUDIO_I2S_DATA_PIN, PICO_AUDIO_I2S_CLOCK_PIN_BASE);
+
+    lap_us = (uint32_t)((uint64_t)(RING_FRAMES - LEAD_FRAMES) * 1000000u / sample_freq);
+
+    // As pico_audio_i2s sets it, 8.8 fixed point, without overflowing
+    uint32_t divider = clock_get_hz(clk_sys) * 4 / sample_freq;
+    pio_sm_set_clkdiv_int_frac(pio, SM, divider >> 8u, divider & 0xffu);
+
+    data_channel = dma_claim_unused_channel(true);
+    control_channel = dma_claim_unused_channel(true);
+
+    data_config = dma_channel_get_default_config(data_channel);
+    channel_config_set_transfer_data_size(&data_config, DMA_SIZE_32);
+    channel_config_set_read_increment(&data_config, true);
+    channel_config_set_write_increment(&data_config, false);
+    channel_config_set_dreq(&data_config, pio_get_dreq(pio, SM, true));
+    channel_config_set_chain_to(&data_config, control_channel);
+    dma_channel_configure(data_channel, &data_config, &pio->txf[SM], ring, RING_FRAMES, false);
+
+    dma_channel_config control_config = dma_channel_get_default_config(control_channel);
+    channel_config_set_transfer_data_size(&control_config, DMA_SIZE_32);
+    channel_config_set_read_increment(&control_config, false);
+    channel_config_set_write_increment(&control_config, false);
+    dma_channel_configure(control_channel, &control_config, &dma_hw->ch[data_channel].al3_read_addr_trig, &ring_start, 1, false);
+}
+
+void i2s_ring_start() {
+    pio_sm_set_enabled(pio, SM, true);
+    dma_channel_start(control_channel);
+}
+
+// Between passes the data channel has finished and reads as 0 left, the start of the ring
+uint32_t i2s_ring_position() {
+    if(!dma_channel_is_busy(data_channel)) return 0;
+    return dma_channel_hw_addr(data_channel)->transfer_count;
+}
+
+static uint32_t read_position() {
+    return (RING_FRAMES - i2s_ring_position()) % RING_FRAMES;
+}
+
+static void clear(uint32_t from, uint32_t frames) {
+    uint32_t first = std::min(frames, RING_FRAMES - from);
+    memset(&ring[from], 0, first * sizeof(ring[0]));
+    memset(&ring[0], 0, (frames - first) * sizeof(ring[0]));
+}
+
+static void __not_in_flash_func(service)() {
+    if(restarted) {
+        restarted = false;
+        read_index = 0;
+        queued = 0;
+    }
+
+    uint32_t now_us = time_us_32();
+    bool lapped = now_us - service_us >= lap_us;
+    service_us = now_us;
+
+    uint32_t now = read_position();
+    if(lapped && queued) {
+        // The position only says where the DMA is in its pass, not how many
+        // passes it made while the main loop was away (a flash erase, or
+        // _bnc). If it went round it's been replaying what was written, so
+        // silence the lot and let the writer start again a lead ahead.
+        memset(ring, 0, sizeof(ring));
+        read_index = now;
+        queued = 0;
+        stats.underruns++;
+        stats.laps++;
+        return;
+    }
+
+    uint32_t played = (now + RING_FRAMES - read_index) % RING_FRAMES;
+    clear(read_index, played);
+    read_index = now;
+
+    if(played >= queued) {
+        // Caught up with the last frame written, and plays cleared frames,
+        // ie: silence, until the writer starts again a lead ahead
+        if(queued) stats.underruns++;
+        queued = 0;
+    } else {
+        queued -= played;
+    }
+}
+
+void __not_in_flash_func(i2s_ring_service)() {
+    uint32_t save = save_and_disable_interrupts();
+    service();
+    restore_interrupts(save);
+}
+
+size_t __not_in_flash_func(i2s_ring_write)(const int16_t *samples, size_t frames) {
+    uint32_t save = save_and_disable_interrupts();
+    service();
+
+    if(!queued) {
+        // Starting, or after an underrun, the lead ahead of the DMA is already silent
+        write_index = (read_index + LEAD_FRAMES) % RING_FRAMES;
+        queued = LEAD_FRAMES;
+    }
+
+    // Leave a frame so a full ring doesn't look empty
+    size_t space = RING_FRAMES - 1 - queued;
+    if(frames > space) {
+        stats.overruns += frames - space;
+        frames = space;
+    }
+
+    uint32_t first = std::min<uint32_t>(frames, RING_FRAMES - write_index);
+    memcpy(&ring[write_index], samples, first * sizeof(ring[0]));
+    memcpy(&ring[0], samples + first * 2, (frames - first) * sizeof(ring[0]));
+    write_index = (write_index + frames) % RING_FRAMES;
+    queued += frames;
+    restore_interrupts(save);
+    return frames;
+}
+
+uint32_t i2s_ring_queued() {
+    return queued;
+}
+
+// Aborting a channel can still fire its chain, so unchain it first
+void i2s_ring_stop() {
+    dma_channel_config config = data_config;
+    channel_config_set_chain_to(&config, data_channel);
+    dma_channel_set_config(data_channel, &config, false);
+    dma_channel_abort(control_channel);
+    dma_channel_abort(data_channel);
+}
+
+void i2s_ring_restart(bool restart_pio) {
+    uint32_t save = save_and_disable_interrupts();
+    i2s_ring_stop();
+
+    if(restart_pio) {
+        pio_sm_set_enabled(pio, SM, false);
+        pio_sm_clear_fifos(pio, SM);
+        pio_sm_restart(pio, SM);
+        // The audio_i2s program's entry point is its last instruction, the start of a frame
+        uint entry = (pio->sm[SM].execctrl & PIO_SM0_EXECCTRL_WRAP_TOP_BITS) >> PIO_SM0_EXECCTRL_WRAP_TOP_LSB;
+        pio_sm_exec(pio, SM, pio_encode_jmp(entry));
+        pio_sm_set_enabled(pio, SM, true);
+    }
+
+    // From the top of a silent ring, the writer starts again a lead ahead
+    memset(ring, 0, sizeof(ring));
+    restarted = true;
+    dma_channel_set_config(data_channel, &data_config, false);
+    dma_channel_start(control_channel);
+    restore_interrupts(save);
+}
+
+void i2s_ring_get_stats(i2s_ring_stats_t *stats_out, bool reset) {
+    *stats_out = stats;
+    if(reset) stats = {};
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include "oversample.h"
+
+// I2S output from a fixed ring in RAM, instead of pico_audio_i2s handing over
+// each buffer. One DMA channel plays the ring into the PIO and chains to a
+// second, which writes the ring's address back into the first and so starts
+// it over, with no CPU and no interrupt. Audio is written a lead ahead of
+// where the DMA is reading, worked out from its transfer count, and whatever
+// it has played is cleared behind it, so a late writer is heard as silence.
+// Picked with AUDIO_I2S_RING, see "I2S output" in README.md.
+
+#ifndef AUDIO_I2S_RING
+#define AUDIO_I2S_RING 0
+#endif
+
+// In I2S frames, 10.7ms, the same RAM as the two 256 frame pico_audio_i2s
+// buffers without oversampling. i2s_ring_service() should be called more
+// often than this. After a longer gap the DMA may have played the ring again,
+// so it's cleared and counted as a lap.
+#ifndef AUDIO_I2S_RING_FRAMES
+#define AUDIO_I2S_RING_FRAMES (AUDIO_OVERSAMPLE_2X ? 1024 : 512)
+#endif
+
+// How far ahead of the DMA a stream starts, and so the output latency. Three
+// packets, covering the main loop's worst gaps between audio tasks.
+#ifndef AUDIO_I2S_RING_LEAD_FRAMES
+#define AUDIO_I2S_RING_LEAD_FRAMES (AUDIO_OVERSAMPLE_2X ? 288 : 144)
+#endif
+
+typedef struct {
+    uint32_t underruns;     // The DMA caught up with the writer
+    uint32_t overruns;      // Frames dropped with the ring full
+    uint32_t laps;          // Underruns where the DMA may have replayed the ring
+} i2s_ring_stats_t;
+
+// Claims PIO state machine 0 and two DMA channels, playing silence once started
+void i2s_ring_init(uint32_t sample_freq);
+void i2s_ring_start();
+
+// Frames from a stereo 16-bit buffer, returns the number taken
+size_t i2s_ring_write(const int16_t *samples, size_t frames);
+// Clears what the DMA has played, from the main loop. Both this and
+// i2s_ring_write() run with interrupts off, so i2s_ring_restart() can't land
+// part way through.
+void i2s_ring_service();
+// Frames written but not yet read by the DMA
+uint32_t i2s_ring_queued();
+// Frames left in the DMA's pass over the ring
+uint32_t i2s_ring_position();
+
+// Gets a stalled ring going again from the start, optionally restarting the PIO
+void i2s_ring_restart(bool restart_pio);
+void i2s_ring_stop();
+
+void i2s_ring_get_stats(i2s_ring_stats_t *stats, bool reset);
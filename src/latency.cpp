@@ -0,0 +1,67 @@
+#include "pico/stdlib.h"
+#include "bsp/board_api.h"
+#include "latency.h"
+#include "i2s_audio.h"
+#include "mixer.h"
+
+// Average over roughly the last 32 samples (ms), in 1/256 us
+static const uint32_t AVERAGE_SHIFT = 5;
+
+static uint32_t average_us_q8 = 0;
+static uint32_t last_sample_ms = 0;
+static latency_stats_t stats = {};
+
+static uint32_t frames_to_us(uint32_t frames) {
+    return (uint32_t)((uint64_t)frames * 1000000u / i2s_audio_sample_rate());
+}
+
+void latency_init() {
+    // Until something plays, report what steady streaming should settle at
+    stats.reported_us = frames_to_us(i2s_audio_nominal_frames());
+    average_us_q8 = stats.reported_us << 8;
+    stats.min_us = UINT32_MAX;
+}
+
+bool latency_task(bool playing) {
+    // Idle, the queue is just the silence the DMA fills gaps with
+    if(!playing) return false;
+
+    uint32_t now = board_millis();
+    if(now == last_sample_ms) return false;
+    last_sample_ms = now;
+
+    stats.current_us = frames_to_us(i2s_audio_queued_frames());
+    stats.min_us = MIN(stats.min_us, stats.current_us);
+    stats.max_us = MAX(stats.max_us, stats.current_us);
+
+    average_us_q8 += (int32_t)((stats.current_us << 8) - average_us_q8) >> AVERAGE_SHIFT;
+    stats.average_us = average_us_q8 >> 8;
+
+    uint32_t drift = stats.average_us > stats.reported_us
+        ? stats.average_us - stats.reported_us
+        : stats.reported_us - stats.average_us;
+    if(drift < AUDIO_LATENCY_REPORT_STEP_US) return false;
+
+    stats.reported_us = stats.average_us;
+    stats.changes++;
+    return true;
+}
+
+uint32_t latency_speaker_ns() {
+    return stats.reported_us * 1000;
+}
+
+// The system function has no interrupt endpoint, so the host is never told of
+// a change. Report what it can rely on instead: steady streaming plus the
+// most the mixer queue holds.
+uint32_t latency_system_ns() {
+    return (frames_to_us(i2s_audio_nominal_frames()) + frames_to_us(MIXER_MAX_QUEUED_FRAMES)) * 1000;
+}
+
+void latency_get_stats(latency_stats_t *stats_out, bool reset) {
+    *stats_out = stats;
+    if(reset) {
+        stats.min_us = UINT32_MAX;
+        stats.max_us = 0;
+    }
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <stdint.h>
+
+// Playback latency as reported to the host through the UAC2 latency controls.
+// Measured from the queue depth once a millisecond while playing and smoothed,
+// the reported figure only moves when the average drifts past a threshold.
+
+// How far the average has to move before the host is told again
+#ifndef AUDIO_LATENCY_REPORT_STEP_US
+#define AUDIO_LATENCY_REPORT_STEP_US 500
+#endif
+
+typedef struct {
+    uint32_t current_us;
+    uint32_t average_us;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint32_t reported_us;
+    uint32_t changes;       // Times the reported figure moved
+} latency_stats_t;
+
+void latency_init();
+// Returns true when the reported latency changed and the host should be told
+bool latency_task(bool playing);
+// Speaker path, USB packet in to I2S out
+uint32_t latency_speaker_ns();
+// System sounds path, fixed at the most it waits in the mixer queue on top of
+// nominal output latency, as there's no way to notify the host it moved
+uint32_t latency_system_ns();
+void latency_get_stats(latency_stats_t *stats, bool reset);
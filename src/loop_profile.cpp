@@ -0,0 +1,57 @@
+#include "pico/stdlib.h"
+#include "loop_profile.h"
+#include "profile.h"
+
+static const char *names[LOOP_TASK_COUNT] = {
+    "health", "tud", "notify", "audio", "serial", "spectrum", "led", "settings", "latency", "update"
+};
+
+// Past this SysTick may have wrapped, saturate rather than guess
+static const uint32_t WRAP_GUARD_US = 60000;
+
+static loop_profile_stats_t stats = {};
+static uint32_t loop_start_us = 0;
+static uint32_t task_start_us = 0;
+static uint32_t last_audio_us = 0;
+
+uint32_t loop_profile_begin() {
+    uint32_t now = time_us_32();
+    if(stats.loops++) {
+        uint32_t loop_us = now - loop_start_us;
+        if(loop_us > stats.max_loop_us) stats.max_loop_us = loop_us;
+    }
+    loop_start_us = now;
+    task_start_us = now;
+    return profile_start();
+}
+
+uint32_t __not_in_flash_func(loop_profile_mark)(loop_task_t task, uint32_t mark) {
+    uint32_t cycles = profile_cycles(mark);
+    uint32_t now = time_us_32();
+    if(now - task_start_us > WRAP_GUARD_US) cycles = PROFILE_SYSTICK_MASK;
+
+    loop_task_stats_t &t = stats.tasks[task];
+    t.calls++;
+    if(cycles > t.max_cycles) t.max_cycles = cycles;
+    t.histogram[cycles ? 31 - __builtin_clz(cycles) : 0]++;
+
+    if(task == LOOP_AUDIO) {
+        if(last_audio_us && now - last_audio_us > stats.max_audio_gap_us) stats.max_audio_gap_us = now - last_audio_us;
+        last_audio_us = now;
+    }
+
+    task_start_us = now;
+    return profile_start();
+}
+
+const char *loop_profile_name(loop_task_t task) {
+    return names[task];
+}
+
+void loop_profile_get_stats(loop_profile_stats_t *stats_out, bool reset) {
+    *stats_out = stats;
+    if(reset) {
+        stats = {};
+        last_audio_us = 0;
+    }
+}
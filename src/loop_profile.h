@@ -0,0 +1,43 @@
+#pragma once
+#include <stdint.h>
+
+// Time spent in each main loop task, as a log2 histogram of cycles per call.
+// simulate-picade-audio.py builds its cost model from these.
+
+enum loop_task_t : uint8_t {
+    LOOP_HEALTH,
+    LOOP_TUD,
+    LOOP_NOTIFY,
+    LOOP_AUDIO,
+    LOOP_SERIAL,
+    LOOP_SPECTRUM,
+    LOOP_LED,
+    LOOP_SETTINGS,
+    LOOP_LATENCY,
+    LOOP_UPDATE,
+    LOOP_TASK_COUNT
+};
+
+// Bucket n counts calls of 2^n to 2^(n+1) - 1 cycles, SysTick is 24 bits.
+// Anything longer than a SysTick wrap lands in the last bucket.
+static const uint32_t LOOP_PROFILE_BUCKETS = 24;
+
+typedef struct {
+    uint32_t calls;
+    uint32_t max_cycles;
+    uint32_t histogram[LOOP_PROFILE_BUCKETS];
+} loop_task_stats_t;
+
+typedef struct {
+    uint32_t loops;
+    uint32_t max_loop_us;       // Longest single pass of the main loop
+    uint32_t max_audio_gap_us;  // Longest time between two audio_task() calls
+    loop_task_stats_t tasks[LOOP_TASK_COUNT];
+} loop_profile_stats_t;
+
+// Start of the loop, returns the mark for the first task
+uint32_t loop_profile_begin();
+// Charge the time since `mark` to `task`, returns the mark for the next one
+uint32_t loop_profile_mark(loop_task_t task, uint32_t mark);
+const char *loop_profile_name(loop_task_t task);
+void loop_profile_get_stats(loop_profile_stats_t *stats, bool reset);
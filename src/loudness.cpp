@@ -0,0 +1,68 @@
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "loudness.h"
+#include "loudness_table.h"
+#include "fixed.h"
+#include "profile.h"
+
+static const q15_t K_BASS = q15_t::from_raw(LOUDNESS_K_BASS);
+static const q15_t K_TREBLE = q15_t::from_raw(LOUDNESS_K_TREBLE);
+
+// One pole low passes per channel, samples in the top 16 bits
+static q31_t bass_lp[2];
+static q31_t treble_lp[2];
+
+static bool enabled = false;
+
+void loudness_set_enabled(bool enable) {
+    // Start from silence, so the shelves fade in rather than jump
+    if(enable && !enabled) {
+        memset(bass_lp, 0, sizeof(bass_lp));
+        memset(treble_lp, 0, sizeof(treble_lp));
+    }
+    enabled = enable;
+}
+
+bool loudness_enabled() {
+    return enabled;
+}
+
+static inline int32_t lowpass(q31_t *lp, int16_t x, q15_t k) {
+    q31_t input = fixed_to_q31(q15_t::from_raw(x));
+    *lp = fixed_add(*lp, fixed_mul(fixed_sub(input, *lp), k));
+    return fixed_shr_round(lp->raw, 16);
+}
+
+void __not_in_flash_func(loudness_process)(int16_t *samples, size_t frames, uint8_t volume) {
+    const loudness_step_t step = loudness_table[volume];
+    for(auto i = 0u; i < frames * 2; i++) {
+        int16_t x = samples[i];
+        int32_t bass = lowpass(&bass_lp[i & 1], x, K_BASS);
+        int32_t treble = x - lowpass(&treble_lp[i & 1], x, K_TREBLE);
+        int32_t boost = bass * step.bass + treble * step.treble;
+        samples[i] = fixed_sat16(x + fixed_shr_round(boost, LOUDNESS_GAIN_BITS));
+    }
+}
+
+uint32_t loudness_bench() {
+    static int16_t samples[48 * 2];
+    uint32_t seed = 1;
+    for(auto i = 0u; i < 48 * 2; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        samples[i] = (int16_t)(seed >> 16);
+    }
+
+    // Don't disturb the filters of whatever's playing
+    q31_t saved[4];
+    memcpy(&saved[0], bass_lp, sizeof(bass_lp));
+    memcpy(&saved[2], treble_lp, sizeof(treble_lp));
+
+    uint32_t start = profile_start();
+    loudness_process(samples, 48, 1);
+    uint32_t cycles = profile_cycles(start);
+
+    memcpy(bass_lp, &saved[0], sizeof(bass_lp));
+    memcpy(treble_lp, &saved[2], sizeof(treble_lp));
+    return cycles;
+}
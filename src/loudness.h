@@ -0,0 +1,15 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// Loudness compensated volume. A low shelf at 120Hz and a high shelf at 8kHz
+// are raised as the volume comes down, following the equal loudness contours
+// so the small cabinet speakers don't lose all their bass at low levels.
+// Gains come from src/loudness_table.h, see generate-loudness.py.
+
+void loudness_set_enabled(bool enabled);
+bool loudness_enabled();
+// In place on stereo frames already scaled by `volume`, the conversion kernel's gain
+void loudness_process(int16_t *samples, size_t frames, uint8_t volume);
+// Cycles for one millisecond of audio
+uint32_t loudness_bench();
@@ -0,0 +1,50 @@
+// Generated by generate-loudness.py, do not edit
+#pragma once
+#include <stdint.h>
+
+// One pole low passes at 120Hz and 8000Hz, Q15
+static const uint32_t LOUDNESS_COEFF_BITS = 15;
+static const int32_t LOUDNESS_K_BASS = 511;
+static const int32_t LOUDNESS_K_TREBLE = 21269;
+
+// Shelf gains above unity for each volume gain, Q12, up to 12dB bass and 4dB treble
+static const uint32_t LOUDNESS_GAIN_BITS = 12;
+struct loudness_step_t {
+    int16_t bass;
+    int16_t treble;
+};
+
+static const loudness_step_t loudness_table[256] = {
+    {12210, 2396}, {12210, 2396}, {12210, 2396}, {12210, 2291}, {12210, 2110}, {12210, 1973}, {12210, 1863}, {12210, 1772},
+    {12210, 1694}, {11510, 1627}, {10866, 1567}, {10306, 1513}, {9813, 1464}, {9375, 1420}, {8982, 1379}, {8626, 1342},
+    {8301, 1307}, {8004, 1274}, {7731, 1243}, {7478, 1215}, {7243, 1187}, {7024, 1162}, {6819, 1137}, {6626, 1114},
+    {6445, 1092}, {6275, 1071}, {6113, 1051}, {5960, 1031}, {5815, 1013}, {5677, 995}, {5545, 977}, {5419, 961},
+    {5299, 945}, {5184, 929}, {5074, 914}, {4969, 900}, {4867, 886}, {4769, 872}, {4675, 859}, {4585, 846},
+    {4497, 834}, {4413, 821}, {4331, 810}, {4252, 798}, {4176, 787}, {4102, 776}, {4030, 765}, {3960, 755},
+    {3893, 744}, {3827, 735}, {3763, 725}, {3701, 715}, {3641, 706}, {3582, 697}, {3525, 688}, {3469, 679},
+    {3415, 670}, {3362, 662}, {3310, 654}, {3260, 646}, {3211, 638}, {3162, 630}, {3115, 622}, {3069, 615},
+    {3024, 607}, {2980, 600}, {2937, 593}, {2895, 586}, {2854, 579}, {2813, 572}, {2774, 565}, {2735, 559},
+    {2697, 552}, {2659, 546}, {2623, 539}, {2587, 533}, {2551, 527}, {2517, 521}, {2483, 515}, {2449, 509},
+    {2416, 503}, {2384, 498}, {2352, 492}, {2321, 487}, {2291, 481}, {2260, 476}, {2231, 470}, {2202, 465},
+    {2173, 460}, {2145, 455}, {2117, 450}, {2089, 445}, {2062, 440}, {2036, 435}, {2010, 430}, {1984, 425},
+    {1958, 420}, {1933, 416}, {1909, 411}, {1884, 406}, {1860, 402}, {1837, 397}, {1813, 393}, {1790, 389},
+    {1768, 384}, {1745, 380}, {1723, 376}, {1701, 372}, {1680, 367}, {1658, 363}, {1637, 359}, {1617, 355},
+    {1596, 351}, {1576, 347}, {1556, 343}, {1536, 340}, {1517, 336}, {1498, 332}, {1479, 328}, {1460, 324},
+    {1441, 321}, {1423, 317}, {1405, 313}, {1387, 310}, {1369, 306}, {1352, 303}, {1334, 299}, {1317, 296},
+    {1300, 292}, {1283, 289}, {1267, 285}, {1250, 282}, {1234, 279}, {1218, 275}, {1202, 272}, {1187, 269},
+    {1171, 266}, {1156, 263}, {1140, 259}, {1125, 256}, {1110, 253}, {1095, 250}, {1081, 247}, {1066, 244},
+    {1052, 241}, {1038, 238}, {1024, 235}, {1010, 232}, {996, 229}, {982, 226}, {969, 223}, {955, 220},
+    {942, 217}, {929, 215}, {915, 212}, {903, 209}, {890, 206}, {877, 204}, {864, 201}, {852, 198},
+    {839, 195}, {827, 193}, {815, 190}, {803, 187}, {791, 185}, {779, 182}, {767, 180}, {756, 177},
+    {744, 175}, {733, 172}, {721, 169}, {710, 167}, {699, 165}, {688, 162}, {677, 160}, {666, 157},
+    {655, 155}, {644, 152}, {633, 150}, {623, 148}, {612, 145}, {602, 143}, {592, 140}, {581, 138},
+    {571, 136}, {561, 134}, {551, 131}, {541, 129}, {531, 127}, {521, 125}, {512, 122}, {502, 120},
+    {492, 118}, {483, 116}, {473, 114}, {464, 111}, {455, 109}, {445, 107}, {436, 105}, {427, 103},
+    {418, 101}, {409, 99}, {400, 97}, {391, 94}, {382, 92}, {374, 90}, {365, 88}, {356, 86},
+    {348, 84}, {339, 82}, {331, 80}, {322, 78}, {314, 76}, {306, 74}, {297, 72}, {289, 70},
+    {281, 69}, {273, 67}, {265, 65}, {257, 63}, {249, 61}, {241, 59}, {233, 57}, {226, 55},
+    {218, 53}, {210, 52}, {203, 50}, {195, 48}, {188, 46}, {180, 44}, {173, 42}, {165, 41},
+    {158, 39}, {151, 37}, {143, 35}, {136, 34}, {129, 32}, {122, 30}, {115, 28}, {108, 27},
+    {101, 25}, {94, 23}, {87, 21}, {80, 20}, {73, 18}, {66, 16}, {59, 15}, {53, 13},
+    {46, 11}, {39, 10}, {33, 8}, {26, 6}, {19, 5}, {13, 3}, {6, 2}, {0, 0},
+};
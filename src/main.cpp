@@ -24,8 +24,8 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
-#include <string_view>
 #include <sys/param.h> // MIN and MAX
 
 #include "bsp/board_api.h"
@@ -34,13 +34,26 @@
 #include "i2s_audio.h"
 #include "board_config.h"
 #include "board.h"
+#include "serial.h"
+#include "spectrum.h"
+#include "mixer.h"
+#include "profile.h"
+#include "settings.h"
+#include "notify.h"
+#include "boot.h"
+#include "sounds.h"
+#include "selftest.h"
+#include "update.h"
+#include "latency.h"
+#include "health.h"
+#include "loop_profile.h"
+#include "audio_arena.h"
+#include "loudness.h"
+#include "vbass.h"
 
 #include "hardware/clocks.h"
+#include "hardware/timer.h"
 #include "hardware/vreg.h"
-#include "pico/bootrom.h"
-#include "hardware/structs/rosc.h"
-#include "hardware/watchdog.h"
-#include "pico/timeout_helper.h"
 
 // Approximate exponential volume ramp - (n / 64) ^ 4
 // Tested with pure square for perceptual loudness.
@@ -73,6 +86,9 @@ uint32_t current_sample_rate  = 48000;
 
 #define N_SAMPLE_RATES  TU_ARRAY_SIZE(sample_rates)
 
+// Frames in one 1ms USB frame at the (fixed) sample rate
+#define SAMPLES_PER_MS  (CFG_TUD_AUDIO_FUNC_1_MAX_SAMPLE_RATE / 1000)
+
 /* Blink pattern
  * - 25 ms   : streaming data
  * - 250 ms  : device not mounted
@@ -90,7 +106,10 @@ enum
 static uint32_t blink_interval_ms = BLINK_NOT_MOUNTED;
 
 int system_volume = 255;
-int volume_speed = 10;
+
+// Knob or button to gain change latency, measured from the input IRQ
+// to the first buffer converted at the new gain
+input_latency_t input_latency = {};
 
 uint8_t led_red = 0;
 uint8_t led_green = 0;
@@ -101,143 +120,192 @@ uint8_t led_blue = 0;
 int8_t mute[CFG_TUD_AUDIO_FUNC_1_N_CHANNELS_RX + 1];       // +1 for master channel 0
 int16_t volume[CFG_TUD_AUDIO_FUNC_1_N_CHANNELS_RX + 1];    // +1 for master channel 0
 
-// Buffer for speaker data
-int32_t spk_buf[CFG_TUD_AUDIO_FUNC_1_EP_OUT_SW_BUF_SZ / 4];
-// Speaker data size received in the last frame
+#if AUDIO_SYSTEM_MIX
+// System sounds source gain, relative to the master volume above
+int8_t sys_mute[CFG_TUD_AUDIO_FUNC_2_N_CHANNELS_RX + 1];
+int16_t sys_volume[CFG_TUD_AUDIO_FUNC_2_N_CHANNELS_RX + 1] = {VOLUME_CTRL_100_DB, VOLUME_CTRL_100_DB, VOLUME_CTRL_100_DB};
+#endif
+
+bool spk_streaming = false;
+uint32_t spk_last_packet_ms = 0;
+
+// Speaker data, in audio_arena.spk_buf, size received in the last frame
 int spk_data_size;
 // Resolution per format
+// 32 is only used by the IEEE float format
 const uint8_t resolutions_per_format[CFG_TUD_AUDIO_FUNC_1_N_FORMATS] = {CFG_TUD_AUDIO_FUNC_1_FORMAT_1_RESOLUTION_RX,
-                                                                        CFG_TUD_AUDIO_FUNC_1_FORMAT_2_RESOLUTION_RX};
+                                                                        CFG_TUD_AUDIO_FUNC_1_FORMAT_2_RESOLUTION_RX,
+                                                                        CFG_TUD_AUDIO_FUNC_1_FORMAT_3_RESOLUTION_RX};
 // Current resolution, update on format change
 uint8_t current_resolution;
+// Resolution of the packet in spk_buf, which plays in the format it arrived in
+uint8_t spk_data_resolution;
+
+// Speaker stream starts and stops, carried out by audio_task() once any
+// packet still to play has gone
+static bool spk_open = false;
+static bool spk_open_pending = false;
+static bool spk_close_pending = false;
+static uint32_t spk_open_us = 0;
 
 
-const size_t MAX_UART_PACKET = 64;
+bool vu_meter_mode = false;
 
-const size_t COMMAND_LEN = 4;
-uint8_t command_buffer[COMMAND_LEN];
-std::string_view command((const char *)command_buffer, COMMAND_LEN);
+// Last time a buffer went out to I2S, settings writes wait for this to go quiet
+uint32_t audio_last_buffer_ms = 0;
 
 
 void led_task(void);
 void audio_task(void);
 void usb_serial_init(void);
-uint cdc_task(uint8_t *buf, size_t buf_len);
-
-uint cdc_task(uint8_t *buf, size_t buf_len) {
-
-    if (tud_cdc_connected()) {
-        if (tud_cdc_available()) {
-            return tud_cdc_read(buf, buf_len);
-        }
-    }
-
-    return 0;
-}
-
-bool cdc_wait_for(std::string_view data, uint timeout_ms=50) {
-    timeout_state ts;
-    absolute_time_t until = delayed_by_ms(get_absolute_time(), timeout_ms);
-    check_timeout_fn check_timeout = init_single_timeout_until(&ts, until);
-
-    for(auto expected_char : data) {
-        char got_char;
-        while(1){
-            tud_task();
-            if (cdc_task((uint8_t *)&got_char, 1) == 1) break;
-            if(check_timeout(&ts, false)) return false;
-        }
-        if (got_char != expected_char) return false;
-    }
-    return true;
-}
-
-size_t cdc_get_bytes(const uint8_t *buffer, const size_t len, const uint timeout_ms=1000) {
-    memset((void *)buffer, len, 0);
-
-    uint8_t *p = (uint8_t *)buffer;
-
-    timeout_state ts;
-    absolute_time_t until = delayed_by_ms(get_absolute_time(), timeout_ms);
-    check_timeout_fn check_timeout = init_single_timeout_until(&ts, until);
-
-    size_t bytes_remaining = len;
-    while (bytes_remaining && !check_timeout(&ts, false)) {
-        tud_task(); // tinyusb device task
-        size_t bytes_read = cdc_task(p, std::min(bytes_remaining, MAX_UART_PACKET));
-        bytes_remaining -= bytes_read;
-        p += bytes_read;
-    }
-    return len - bytes_remaining;
-}
-
-void serial_task(void) {
-  if (tud_cdc_connected()) {
-      if (tud_cdc_available()) {
-        if(!cdc_wait_for("multiverse:")) {
-            return; // Couldn't get 16 bytes of command
-        }
-
-        if(cdc_get_bytes(command_buffer, COMMAND_LEN) != COMMAND_LEN) {
-            //display::info("cto");
-            return;
-        }
-
-        if(command == "_rst") {
-            sleep_ms(500);
-            save_and_disable_interrupts();
-            rosc_hw->ctrl = ROSC_CTRL_ENABLE_VALUE_ENABLE << ROSC_CTRL_ENABLE_LSB;
-            watchdog_reboot(0, 0, 0);
-            return;
-        }
-
-        if(command == "_usb") {
-            sleep_ms(500);
-            save_and_disable_interrupts();
-            rosc_hw->ctrl = ROSC_CTRL_ENABLE_VALUE_ENABLE << ROSC_CTRL_ENABLE_LSB;
-            reset_usb_boot(0, 0);
-            return;
-        }
-      }
-    }
-}
+void settings_restore(void);
 
 /*------------- MAIN -------------*/
 int main(void)
 {
 
-  system_init();
+  boot_mark(BOOT_MAIN);
 
-  board_init();
+  // Start the overvolt now, it settles while USB comes up
+  system_power_init();
+  absolute_time_t vreg_settled = make_timeout_time_ms(VREG_SETTLE_MS);
+
+  // Volume and mute must be right before the host can ask for them
+  settings_restore();
+  update_init();
+  // The host may ask for latency while enumerating, before audio is up
+  latency_init();
 
   // Fetch the Pico serial (actually the flash chip ID) into `usb_serial`
   // This has nothing to do with CDC serial!
   usb_serial_init();
 
   // init device stack on configured roothub port
+  // Enumeration starts here, so everything below runs alongside it
   tud_init(BOARD_TUD_RHPORT);
+  boot_mark(BOOT_USB_INIT);
+
+  while (!time_reached(vreg_settled)) {
+    tud_task();
+  }
+  system_clock_init();
+  boot_mark(BOOT_CLOCKS);
+  tud_task();
+
+  board_init();
+
+  profile_init();
+
+  system_input_init();
+  boot_mark(BOOT_BOARD);
+  tud_task();
 
   i2s_audio_init();
   i2s_audio_start();
+  health_init();
+  boot_mark(BOOT_AUDIO);
+
+  // Holding mute at power on runs the test signal sequence instead of the chime
+  if (get_mute_button_down()) {
+    selftest_start_sequence();
+  } else if (!mute[0]) {
+    sounds_play(SOUND_BOOT, volume_ramp[system_volume]);
+  }
+  tud_task();
+
+  // Spectrum analysis runs on the otherwise idle core1
+  spectrum_init();
 
   TU_LOG1("Picade Max Audio Running\r\n");
+  boot_mark(BOOT_READY);
 
   while (1)
   {
+    // Each task's time is charged to it, see simulate-picade-audio.py
+    uint32_t mark = loop_profile_begin();
+    health_task();
+    mark = loop_profile_mark(LOOP_HEALTH, mark);
     tud_task();
+    mark = loop_profile_mark(LOOP_TUD, mark);
+    notify_task();
+    mark = loop_profile_mark(LOOP_NOTIFY, mark);
     audio_task();
+    mark = loop_profile_mark(LOOP_AUDIO, mark);
     serial_task();
+    mark = loop_profile_mark(LOOP_SERIAL, mark);
+    spectrum_task();
+    mark = loop_profile_mark(LOOP_SPECTRUM, mark);
     led_task();
+    mark = loop_profile_mark(LOOP_LED, mark);
+    bool playing = board_millis() - audio_last_buffer_ms < 100;
+    settings_task(playing);
+    mark = loop_profile_mark(LOOP_SETTINGS, mark);
+    // Only the speaker's figure moves, the system function's is fixed
+    if (latency_task(playing))
+    {
+      notify_changed(0, 0, UAC2_AC_CTRL_LATENCY);
+      notify_changed(UAC2_ENTITY_SPK_FEATURE_UNIT, 0, AUDIO_FU_CTRL_LATENCY);
+    }
+    mark = loop_profile_mark(LOOP_LATENCY, mark);
+    update_task(playing);
+    loop_profile_mark(LOOP_UPDATE, mark);
   }
 }
 
+// Restore volume and mute from flash, before the host can ask for them
+void settings_restore(void)
+{
+  settings_init();
+
+  int32_t value;
+  if (settings_get(SETTING_VOLUME, &value)) {
+    system_volume = MIN(255, MAX(0, value));
+  }
+  if (settings_get(SETTING_MUTE, &value)) {
+    mute[0] = mute[1] = mute[2] = value ? 1 : 0;
+  }
+  if (settings_get(SETTING_LOUDNESS, &value)) {
+    loudness_set_enabled(value);
+  }
+  if (settings_get(SETTING_VBASS, &value)) {
+    vbass_config_t vbass;
+    vbass_config_from_setting(value, &vbass);
+    vbass_set_config(&vbass);
+  }
+
+  volume[0] = volume[1] = volume[2] = system_volume * 100;
+  led_blue = system_volume;
+  led_red = mute[0] ? 255 : 0;
+}
+
 //--------------------------------------------------------------------+
 // Device callbacks
 //--------------------------------------------------------------------+
 
+// Switching straight from one format to another carries on without a break,
+// and a stop and start in the same pass cancel out
+static void spk_set_open(bool open)
+{
+  if (open && !spk_open)
+  {
+    spk_open_us = time_us_32();
+    spk_open_pending = true;
+  }
+  else if (!open && spk_open)
+  {
+    if (spk_open_pending)
+      spk_open_pending = false;
+    else
+      spk_close_pending = true;
+  }
+  spk_open = open;
+  spk_streaming = open;
+}
+
 // Invoked when device is mounted
 void tud_mount_cb(void)
 {
+  boot_mark(BOOT_MOUNTED);
   blink_interval_ms = BLINK_MOUNTED;
 }
 
@@ -245,6 +313,8 @@ void tud_mount_cb(void)
 void tud_umount_cb(void)
 {
   blink_interval_ms = BLINK_NOT_MOUNTED;
+  // Unplugged mid stream, the host never says it's stopping
+  spk_set_open(false);
 }
 
 // Invoked when usb bus is suspended
@@ -265,7 +335,7 @@ void tud_resume_cb(void)
 // Helper for clock get requests
 static bool tud_audio_clock_get_request(uint8_t rhport, audio_control_request_t const *request)
 {
-  TU_ASSERT(request->bEntityID == UAC2_ENTITY_CLOCK);
+  TU_ASSERT(request->bEntityID == UAC2_ENTITY_CLOCK || request->bEntityID == UAC2_ENTITY_SYS_CLOCK);
 
   if (request->bControlSelector == AUDIO_CS_CTRL_SAM_FREQ)
   {
@@ -311,7 +381,7 @@ static bool tud_audio_clock_set_request(uint8_t rhport, audio_control_request_t
 {
   (void)rhport;
 
-  TU_ASSERT(request->bEntityID == UAC2_ENTITY_CLOCK);
+  TU_ASSERT(request->bEntityID == UAC2_ENTITY_CLOCK || request->bEntityID == UAC2_ENTITY_SYS_CLOCK);
   TU_VERIFY(request->bRequest == AUDIO_CS_REQ_CUR);
 
   if (request->bControlSelector == AUDIO_CS_CTRL_SAM_FREQ)
@@ -335,14 +405,32 @@ static bool tud_audio_clock_set_request(uint8_t rhport, audio_control_request_t
 // Helper for feature unit get requests
 static bool tud_audio_feature_unit_get_request(uint8_t rhport, audio_control_request_t const *request)
 {
+  int8_t const *unit_mute = mute;
+  int16_t const *unit_volume = volume;
+#if AUDIO_SYSTEM_MIX
+  if (request->bEntityID == UAC2_ENTITY_SYS_FEATURE_UNIT)
+  {
+    unit_mute = sys_mute;
+    unit_volume = sys_volume;
+  }
+  else
+#endif
   TU_ASSERT(request->bEntityID == UAC2_ENTITY_SPK_FEATURE_UNIT);
 
   if (request->bControlSelector == AUDIO_FU_CTRL_MUTE && request->bRequest == AUDIO_CS_REQ_CUR)
   {
-    audio_control_cur_1_t mute1 = { .bCur = mute[request->bChannelNumber] };
+    audio_control_cur_1_t mute1 = { .bCur = unit_mute[request->bChannelNumber] };
     TU_LOG1("Get channel %u mute %d\r\n", request->bChannelNumber, mute1.bCur);
     return tud_audio_buffer_and_schedule_control_xfer(rhport, (tusb_control_request_t const *)request, &mute1, sizeof(mute1));
   }
+  else if (request->bControlSelector == AUDIO_FU_CTRL_LATENCY && request->bRequest == AUDIO_CS_REQ_CUR)
+  {
+    // Everything after the unit, system sounds also wait in the mixer queue
+    uint32_t ns = request->bEntityID == UAC2_ENTITY_SYS_FEATURE_UNIT ? latency_system_ns() : latency_speaker_ns();
+    audio_control_cur_4_t latency = { (int32_t) tu_htole32(ns) };
+    TU_LOG1("Get latency %" PRIu32 " ns\r\n", ns);
+    return tud_audio_buffer_and_schedule_control_xfer(rhport, (tusb_control_request_t const *)request, &latency, sizeof(latency));
+  }
   else if (request->bControlSelector == AUDIO_FU_CTRL_VOLUME)
   {
     if (request->bRequest == AUDIO_CS_REQ_RANGE)
@@ -356,7 +444,7 @@ static bool tud_audio_feature_unit_get_request(uint8_t rhport, audio_control_req
     }
     else if (request->bRequest == AUDIO_CS_REQ_CUR)
     {
-      audio_control_cur_2_t cur_vol = { .bCur = tu_htole16(volume[request->bChannelNumber]) };
+      audio_control_cur_2_t cur_vol = { .bCur = tu_htole16(unit_volume[request->bChannelNumber]) };
       TU_LOG1("Get channel %u volume %d dB\r\n", request->bChannelNumber, cur_vol.bCur / 256);
       return tud_audio_buffer_and_schedule_control_xfer(rhport, (tusb_control_request_t const *)request, &cur_vol, sizeof(cur_vol));
     }
@@ -412,6 +500,45 @@ static bool tud_audio_feature_unit_set_request(uint8_t rhport, audio_control_req
   }
 }
 
+#if AUDIO_SYSTEM_MIX
+// Helper for system sounds feature unit set requests
+// These only set the gain of system sounds in the mix, the master volume is untouched
+static bool tud_audio_system_unit_set_request(uint8_t rhport, audio_control_request_t const *request, uint8_t const *buf)
+{
+  (void)rhport;
+
+  TU_ASSERT(request->bEntityID == UAC2_ENTITY_SYS_FEATURE_UNIT);
+  TU_VERIFY(request->bRequest == AUDIO_CS_REQ_CUR);
+
+  if (request->bControlSelector == AUDIO_FU_CTRL_MUTE)
+  {
+    TU_VERIFY(request->wLength == sizeof(audio_control_cur_1_t));
+
+    sys_mute[request->bChannelNumber] = ((audio_control_cur_1_t const *)buf)->bCur;
+
+    TU_LOG1("Set system channel %d Mute: %d\r\n", request->bChannelNumber, sys_mute[request->bChannelNumber]);
+
+    return true;
+  }
+  else if (request->bControlSelector == AUDIO_FU_CTRL_VOLUME)
+  {
+    TU_VERIFY(request->wLength == sizeof(audio_control_cur_2_t));
+
+    sys_volume[request->bChannelNumber] = tu_le16toh(((audio_control_cur_2_t const *)buf)->bCur);
+
+    TU_LOG1("Set system channel %d volume: %d dB\r\n", request->bChannelNumber, sys_volume[request->bChannelNumber] / 256);
+
+    return true;
+  }
+  else
+  {
+    TU_LOG1("System unit set request not supported, entity = %u, selector = %u, request = %u\r\n",
+            request->bEntityID, request->bControlSelector, request->bRequest);
+    return false;
+  }
+}
+#endif
+
 //--------------------------------------------------------------------+
 // Application Callback API Implementations
 //--------------------------------------------------------------------+
@@ -421,9 +548,9 @@ bool tud_audio_get_req_entity_cb(uint8_t rhport, tusb_control_request_t const *p
 {
   audio_control_request_t const *request = (audio_control_request_t const *)p_request;
 
-  if (request->bEntityID == UAC2_ENTITY_CLOCK)
+  if (request->bEntityID == UAC2_ENTITY_CLOCK || request->bEntityID == UAC2_ENTITY_SYS_CLOCK)
     return tud_audio_clock_get_request(rhport, request);
-  if (request->bEntityID == UAC2_ENTITY_SPK_FEATURE_UNIT)
+  if (request->bEntityID == UAC2_ENTITY_SPK_FEATURE_UNIT || request->bEntityID == UAC2_ENTITY_SYS_FEATURE_UNIT)
     return tud_audio_feature_unit_get_request(rhport, request);
   else
   {
@@ -433,6 +560,30 @@ bool tud_audio_get_req_entity_cb(uint8_t rhport, tusb_control_request_t const *p
   return false;
 }
 
+// Invoked when audio class specific get request received for an interface
+// The only control on either audio control interface is latency, USB in to I2S out
+bool tud_audio_get_req_itf_cb(uint8_t rhport, tusb_control_request_t const *p_request)
+{
+  audio_control_request_t const *request = (audio_control_request_t const *)p_request;
+  uint8_t const itf = tu_u16_low(tu_le16toh(p_request->wIndex));
+
+  if (request->bControlSelector == UAC2_AC_CTRL_LATENCY && request->bRequest == AUDIO_CS_REQ_CUR)
+  {
+#if AUDIO_SYSTEM_MIX
+    uint32_t ns = itf == ITF_NUM_AUDIO_CONTROL_SYS ? latency_system_ns() : latency_speaker_ns();
+#else
+    (void)itf;
+    uint32_t ns = latency_speaker_ns();
+#endif
+    audio_control_cur_4_t latency = { (int32_t) tu_htole32(ns) };
+    return tud_audio_buffer_and_schedule_control_xfer(rhport, p_request, &latency, sizeof(latency));
+  }
+
+  TU_LOG1("Interface get request not handled, itf = %u, selector = %u, request = %u\r\n",
+          itf, request->bControlSelector, request->bRequest);
+  return false;
+}
+
 // Invoked when audio class specific set request received for an entity
 bool tud_audio_set_req_entity_cb(uint8_t rhport, tusb_control_request_t const *p_request, uint8_t *buf)
 {
@@ -440,8 +591,12 @@ bool tud_audio_set_req_entity_cb(uint8_t rhport, tusb_control_request_t const *p
 
   if (request->bEntityID == UAC2_ENTITY_SPK_FEATURE_UNIT)
     return tud_audio_feature_unit_set_request(rhport, request, buf);
-  if (request->bEntityID == UAC2_ENTITY_CLOCK)
+  if (request->bEntityID == UAC2_ENTITY_CLOCK || request->bEntityID == UAC2_ENTITY_SYS_CLOCK)
     return tud_audio_clock_set_request(rhport, request, buf);
+#if AUDIO_SYSTEM_MIX
+  if (request->bEntityID == UAC2_ENTITY_SYS_FEATURE_UNIT)
+    return tud_audio_system_unit_set_request(rhport, request, buf);
+#endif
   TU_LOG1("Set request not handled, entity = %d, selector = %d, request = %d\r\n",
           request->bEntityID, request->bControlSelector, request->bRequest);
 
@@ -458,6 +613,19 @@ bool tud_audio_set_itf_close_EP_cb(uint8_t rhport, tusb_control_request_t const
   if (ITF_NUM_AUDIO_STREAMING_SPK == itf && alt == 0)
       blink_interval_ms = BLINK_MOUNTED;
 
+#if AUDIO_LOOPBACK
+  if (ITF_NUM_AUDIO_STREAMING_LOOPBACK == itf && alt == 0)
+      i2s_audio_set_loopback(false);
+#endif
+
+  if (ITF_NUM_AUDIO_STREAMING_SPK == itf && alt == 0)
+      spk_streaming = false;
+
+#if AUDIO_SYSTEM_MIX
+  if (ITF_NUM_AUDIO_STREAMING_SYS == itf && alt == 0)
+      mixer_system_set_streaming(false);
+#endif
+
   return true;
 }
 
@@ -468,11 +636,31 @@ bool tud_audio_set_itf_cb(uint8_t rhport, tusb_control_request_t const * p_reque
   uint8_t const alt = tu_u16_low(tu_le16toh(p_request->wValue));
 
   TU_LOG2("Set interface %d alt %d\r\n", itf, alt);
+
+#if AUDIO_LOOPBACK
+  if (ITF_NUM_AUDIO_STREAMING_LOOPBACK == itf)
+  {
+    i2s_audio_set_loopback(alt != 0);
+    return true;
+  }
+#endif
+
+#if AUDIO_SYSTEM_MIX
+  if (ITF_NUM_AUDIO_STREAMING_SYS == itf)
+  {
+    mixer_system_set_streaming(alt != 0);
+    return true;
+  }
+#endif
+
+  if (ITF_NUM_AUDIO_STREAMING_SPK == itf)
+  {
+    spk_set_open(alt != 0);
+  }
+
   if (ITF_NUM_AUDIO_STREAMING_SPK == itf && alt != 0)
       blink_interval_ms = BLINK_STREAMING;
 
-  // Clear buffer when streaming format is changed
-  spk_data_size = 0;
   if(alt != 0)
   {
     current_resolution = resolutions_per_format[alt-1];
@@ -481,14 +669,37 @@ bool tud_audio_set_itf_cb(uint8_t rhport, tusb_control_request_t const * p_reque
   return true;
 }
 
+#if AUDIO_SYSTEM_MIX
+// The host can set any volume down to VOLUME_CTRL_SILENCE, not just the range
+// it's offered, so anything negative is clamped to the bottom of the ramp
+static int system_sounds_gain(void)
+{
+  int16_t volume = sys_volume[0];
+  if (sys_mute[0] || mute[0] || volume == (int16_t)VOLUME_CTRL_SILENCE) return 0;
+  return volume_ramp[MIN(255, MAX(0, volume / 100))];
+}
+#endif
+
 bool tud_audio_rx_done_pre_read_cb(uint8_t rhport, uint16_t n_bytes_received, uint8_t func_id, uint8_t ep_out, uint8_t cur_alt_setting)
 {
   (void)rhport;
-  (void)func_id;
   (void)ep_out;
   (void)cur_alt_setting;
 
-  spk_data_size = tud_audio_read(spk_buf, n_bytes_received);
+#if AUDIO_SYSTEM_MIX
+  // Function 2 is system sounds, queue them at their own gain for the mixer
+  if (func_id == 1)
+  {
+    uint16_t n_bytes = tud_audio_n_read(func_id, audio_arena.sys_buf, MIN(n_bytes_received, sizeof(audio_arena.sys_buf)));
+    mixer_system_write(audio_arena.sys_buf, n_bytes / sizeof(int16_t) / 2, system_sounds_gain());
+    return true;
+  }
+#endif
+
+  spk_last_packet_ms = board_millis();
+
+  spk_data_size = tud_audio_n_read(func_id, audio_arena.spk_buf, MIN(n_bytes_received, sizeof(audio_arena.spk_buf)));
+  spk_data_resolution = current_resolution;
   return true;
 }
 
@@ -499,7 +710,8 @@ bool tud_audio_tx_done_pre_load_cb(uint8_t rhport, uint8_t itf, uint8_t ep_in, u
   (void)ep_in;
   (void)cur_alt_setting;
 
-  // This callback could be used to fill microphone data separately
+  // Loopback data is queued by i2s_audio_give_buffer as each buffer is handed
+  // to I2S, so there is nothing to prepare here.
   return true;
 }
 
@@ -507,12 +719,38 @@ bool tud_audio_tx_done_pre_load_cb(uint8_t rhport, uint8_t itf, uint8_t ep_in, u
 // AUDIO Task
 //--------------------------------------------------------------------+
 
+// Volume steps per encoder detent, by time since the previous detent.
+// Slow turns give fine control, a quick spin sweeps the whole range.
+static int32_t volume_step(uint32_t interval_us)
+{
+  if (interval_us > 120000) return 2;
+  if (interval_us > 60000) return 4;
+  if (interval_us > 30000) return 8;
+  if (interval_us > 15000) return 12;
+  return 20;
+}
+
+static void input_latency_applied(void)
+{
+  if (!input_latency.pending) return;
+  input_latency.pending = false;
+  input_latency.last_us = time_us_32() - input_latency.event_us;
+  input_latency.max_us = MAX(input_latency.max_us, input_latency.last_us);
+  // Still to play out ahead of the new gain, at least
+  input_latency.output_us = i2s_audio_dma_remaining_us();
+}
+
 void audio_task(void)
 {
-  static uint32_t start_ms = 0;
-  uint32_t volume_interval_ms = 50;
+  i2s_audio_task();
 
-  if (spk_data_size)
+  // The test signal owns the output until it's done, USB audio is discarded
+  if (selftest_active())
+  {
+    selftest_task();
+    spk_data_size = 0;
+  }
+  else if (spk_data_size)
   {
     // "Hardware" volume is 0 - 100 in steps of 256, with a maximum value of 25600
     int current_volume = volume_ramp[system_volume];
@@ -521,83 +759,112 @@ void audio_task(void)
       current_volume = 0;
     }
 
-    i2s_audio_give_buffer(spk_buf, (size_t)spk_data_size, current_resolution, current_volume);
+    i2s_audio_give_buffer(audio_arena.spk_buf, (size_t)spk_data_size, spk_data_resolution, current_volume);
     spk_data_size = 0;
+    audio_last_buffer_ms = board_millis();
+    input_latency_applied();
+  }
+  // With no game audio the system sounds and UI sounds clock the output themselves.
+  // Give the main stream a couple of packets' grace so they don't race it.
+  else if ((!spk_streaming || board_millis() - spk_last_packet_ms > 2) &&
+           (mixer_system_available() >= SAMPLES_PER_MS || sounds_playing()))
+  {
+    int current_volume = mute[0] ? 0 : volume_ramp[system_volume];
+    i2s_audio_give_mix(SAMPLES_PER_MS, current_volume);
+    audio_last_buffer_ms = board_millis();
+    input_latency_applied();
   }
 
-  // Only handle volume control changes every volume_interval_ms
-  // The encoder driver should - I believe - asynchronously gather a delta to be handled here
-  if (board_millis() - start_ms >= volume_interval_ms)
+  // Fade out after the last packet, then pre-roll and fade in the next stream
+  if (selftest_active())
+  {
+    spk_close_pending = false;
+    spk_open_pending = false;
+  }
+  if (spk_close_pending)
   {
-    // This is just the raw delta from the encoder
-    int32_t volume_delta = get_volume_delta();
+    spk_close_pending = false;
+    i2s_audio_stream_close();
+  }
+  if (spk_open_pending)
+  {
+    spk_open_pending = false;
+    i2s_audio_stream_open(spk_open_us);
+  }
 
-    // Adjust the speed of volume control (number of volume steps per encoder turn)
-    volume_delta *= volume_speed;
+  // Long press triggers reset to bootloader
+  handle_mute_button_held();
 
-    // Long press triggers reset to bootloader
-    handle_mute_button_held();
+  bool mute_changed = false;
+  int old_system_volume = system_volume;
+  input_event_t event;
 
-    if(get_mute_button_pressed()) {
+  while (get_input_event(&event))
+  {
+    if (event.type == INPUT_BUTTON_DOWN)
+    {
       // Toggle one channel and copy the mute value to the other
       // We don't want to end up with one muted and one unmuted somehow...
       mute[0] = !mute[0];
       mute[1] = mute[0];
+      mute_changed = !mute_changed;
 
       // Illuminate the LED red if muted
       led_red = mute[0] ? 255 : 0;
+    }
+    else if (event.type == INPUT_ENCODER)
+    {
+      static uint32_t last_detent_us = 0;
+      uint32_t detents = (uint32_t)abs(event.steps);
+      int32_t step = volume_step((event.time_us - last_detent_us) / detents);
+      last_detent_us = event.time_us;
 
-      // Mute was changed - notify the host with an interrupt
-      // 6.1 Interrupt Data Message
-      const audio_interrupt_data_t data = {
-        .bInfo = 0,                                       // Class-specific interrupt, originated from an interface
-        .bAttribute = AUDIO_CS_REQ_CUR,                   // Caused by current settings
-        .wValue_cn_or_mcn = 0,                            // CH0: master volume
-        .wValue_cs = AUDIO_FU_CTRL_MUTE,                  // Muted/Unmuted
-        .wIndex_ep_or_int = 0,                            // From the interface itself
-        .wIndex_entity_id = UAC2_ENTITY_SPK_FEATURE_UNIT, // From feature unit
-      };
-
-      tud_audio_int_write(&data);
-      // Call tud_task to handle the interrupt to host
-      tud_task();
+      system_volume = MIN(255, MAX(0, system_volume + event.steps * step));
+    }
+    else
+    {
+      continue;
     }
 
-    int old_system_volume = system_volume;
+    // Only time changes that will be heard, otherwise there's no buffer to stop the clock
+    if (!input_latency.pending && board_millis() - audio_last_buffer_ms < 100)
+    {
+      input_latency.pending = true;
+      input_latency.event_us = event.time_us;
+    }
+  }
 
+  // Audible feedback while nothing else is playing, at the level the user will hear.
+  // UI sounds are mixed in after mute, so the mute chime still plays.
+  bool stream_idle = board_millis() - spk_last_packet_ms > 100 && !mixer_system_available();
+  if (stream_idle && mute_changed)
+  {
+    sounds_play(mute[0] ? SOUND_MUTE : SOUND_UNMUTE, volume_ramp[system_volume]);
+  }
+  else if (stream_idle && system_volume != old_system_volume)
+  {
+    sounds_play(SOUND_TICK, volume_ramp[system_volume]);
+  }
 
-    if(volume_delta + system_volume > 255) {
-        system_volume = 255;
-    } else if (volume_delta + system_volume < 0) {
-        system_volume = 0;
-    } else {
-        system_volume += volume_delta;
-    }
+  // The host is told from the main loop, merged and rate limited by notify_task()
+  if (mute_changed)
+  {
+    notify_changed(UAC2_ENTITY_SPK_FEATURE_UNIT, 0, AUDIO_FU_CTRL_MUTE);
+  }
 
-    if(system_volume != old_system_volume) {
-      led_blue = system_volume;
-
-      volume[0] = system_volume * 100;
-      volume[1] = system_volume * 100;
-
-      // Volume has changed - notify the host with an interrupt
-      // 6.1 Interrupt Data Message
-      const audio_interrupt_data_t data = {
-        .bInfo = 0,                                       // Class-specific interrupt, originated from an interface
-        .bAttribute = AUDIO_CS_REQ_CUR,                   // Caused by current settings
-        .wValue_cn_or_mcn = 0,                            // CH0: master volume
-        .wValue_cs = AUDIO_FU_CTRL_VOLUME,                // Volume change
-        .wIndex_ep_or_int = 0,                            // From the interface itself
-        .wIndex_entity_id = UAC2_ENTITY_SPK_FEATURE_UNIT, // From feature unit
-      };
+  if (system_volume != old_system_volume)
+  {
+    led_blue = system_volume;
 
-      tud_audio_int_write(&data);
-      // Call tud_task to handle the interrupt to host
-      tud_task();
-    }
+    volume[0] = system_volume * 100;
+    volume[1] = system_volume * 100;
 
-    start_ms += volume_interval_ms;
+    notify_changed(UAC2_ENTITY_SPK_FEATURE_UNIT, 0, AUDIO_FU_CTRL_VOLUME);
   }
+
+  // Changes from the knob, button or host are saved once they settle
+  settings_set(SETTING_VOLUME, system_volume);
+  settings_set(SETTING_MUTE, mute[0]);
 }
 
 //--------------------------------------------------------------------+
@@ -616,5 +883,21 @@ void led_task(void)
     led_state = !led_state;
   }
 
+  if (vu_meter_mode) {
+    static uint32_t vu_start_ms = 0;
+    static uint8_t vu_level = 0;
+
+    // Peak hold with a falloff of roughly 6dB per 20ms update
+    if (board_millis() - vu_start_ms >= 20) {
+      vu_start_ms += 20;
+      uint8_t peak = MIN(255, i2s_audio_take_vu_peak() >> 7);
+      vu_level = MAX(peak, vu_level / 2);
+    }
+
+    // Green for level, with red showing through as the output nears full scale
+    system_led(MAX(led_red, vu_level > 192 ? vu_level : 0), vu_level, led_blue);
+    return;
+  }
+
   system_led(led_red, led_green, led_blue);
 }
@@ -0,0 +1,77 @@
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "mixer.h"
+
+// System sounds arrive on their own endpoint with their own packet timing, so
+// they're queued here at their source gain and pulled a block at a time by
+// whichever stream is driving the output.
+static const uint RING_FRAMES = 512;
+static int16_t ring[RING_FRAMES * 2];
+static uint32_t ring_read = 0;
+static uint32_t ring_write = 0;
+
+// Largest block handed to the output in one go
+static const uint MAX_BLOCK_FRAMES = 96;
+static int16_t block[MAX_BLOCK_FRAMES * 2];
+
+static bool streaming = false;
+static mixer_stats_t stats;
+
+void mixer_system_write(const int16_t *samples, size_t frames, uint8_t gain) {
+    for(auto i = 0u; i < frames; i++) {
+        uint32_t w = (ring_write & (RING_FRAMES - 1)) * 2;
+        ring[w + 0] = (samples[i * 2 + 0] * gain) >> 8;
+        ring[w + 1] = (samples[i * 2 + 1] * gain) >> 8;
+        ring_write++;
+    }
+
+    uint32_t queued = ring_write - ring_read;
+    if(queued > MIXER_MAX_QUEUED_FRAMES) {
+        stats.dropped_frames += queued - MIXER_MAX_QUEUED_FRAMES;
+        ring_read = ring_write - MIXER_MAX_QUEUED_FRAMES;
+        queued = MIXER_MAX_QUEUED_FRAMES;
+    }
+    if(queued > stats.max_level_frames) stats.max_level_frames = queued;
+}
+
+void mixer_system_set_streaming(bool enabled) {
+    streaming = enabled;
+    if(!streaming) ring_read = ring_write;
+}
+
+size_t mixer_system_available() {
+    return ring_write - ring_read;
+}
+
+// Returns a contiguous block of exactly `frames` frames, padded with silence
+// if the system stream is running late, or nullptr if it has nothing to mix.
+const int16_t *mixer_system_take(size_t frames) {
+    if(!streaming || frames > MAX_BLOCK_FRAMES) return nullptr;
+
+    size_t available = ring_write - ring_read;
+    if(available == 0) {
+        stats.underruns++;
+        return nullptr;
+    }
+
+    size_t count = available < frames ? available : frames;
+    for(auto i = 0u; i < count; i++) {
+        uint32_t r = (ring_read & (RING_FRAMES - 1)) * 2;
+        block[i * 2 + 0] = ring[r + 0];
+        block[i * 2 + 1] = ring[r + 1];
+        ring_read++;
+    }
+    if(count < frames) {
+        stats.underruns++;
+        memset(&block[count * 2], 0, (frames - count) * sizeof(int16_t) * 2);
+    }
+
+    return block;
+}
+
+void mixer_get_stats(mixer_stats_t *out, bool reset) {
+    *out = stats;
+    out->level_frames = ring_write - ring_read;
+    if(reset) stats = {};
+}
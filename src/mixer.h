@@ -0,0 +1,19 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// Keep no more than ~4ms queued, older frames are dropped to bound latency
+static const uint32_t MIXER_MAX_QUEUED_FRAMES = 192;
+
+typedef struct {
+    uint32_t level_frames;  // Frames currently queued, ie: added latency
+    uint32_t max_level_frames;
+    uint32_t underruns;     // Mix requests the system stream couldn't fill
+    uint32_t dropped_frames;
+} mixer_stats_t;
+
+void mixer_system_write(const int16_t *samples, size_t frames, uint8_t gain);
+void mixer_system_set_streaming(bool streaming);
+size_t mixer_system_available();
+const int16_t *mixer_system_take(size_t frames);
+void mixer_get_stats(mixer_stats_t *stats, bool reset);
@@ -0,0 +1,69 @@
+#include "tusb.h"
+#include "bsp/board_api.h"
+#include "notify.h"
+
+typedef struct {
+    uint8_t entity;
+    uint8_t channel;
+    uint8_t control;
+} notify_change_t;
+
+// Enough for every device initiated change to be pending at once
+static const uint32_t MAX_PENDING = 8;
+static notify_change_t pending[MAX_PENDING];
+static uint32_t pending_count = 0;
+
+static uint32_t last_sent_ms = 0;
+static notify_stats_t stats;
+
+void notify_changed(uint8_t entity, uint8_t channel, uint8_t control) {
+    for(auto i = 0u; i < pending_count; i++) {
+        if(pending[i].entity == entity && pending[i].channel == channel && pending[i].control == control) {
+            stats.coalesced++;
+            return;
+        }
+    }
+
+    // The host reads the current value when notified, so dropping is only ever a merge
+    if(pending_count == MAX_PENDING) {
+        stats.coalesced++;
+        return;
+    }
+
+    pending[pending_count++] = {entity, channel, control};
+}
+
+void notify_task() {
+    if(!pending_count || !tud_mounted()) return;
+    if(board_millis() - last_sent_ms < AUDIO_NOTIFY_INTERVAL_MS) return;
+
+    // 6.1 Interrupt Data Message
+    const audio_interrupt_data_t data = {
+        .bInfo = 0,                             // Class-specific interrupt, originated from an interface
+        .bAttribute = AUDIO_CS_REQ_CUR,         // Caused by current settings
+        .wValue_cn_or_mcn = pending[0].channel,
+        .wValue_cs = pending[0].control,
+        .wIndex_ep_or_int = 0,                  // From the interface itself
+        .wIndex_entity_id = pending[0].entity,
+    };
+
+    // Busy endpoint, try again on the next pass
+    if(!tud_audio_int_write(&data)) return;
+
+    last_sent_ms = board_millis();
+    stats.sent++;
+
+    pending_count--;
+    for(auto i = 0u; i < pending_count; i++) {
+        pending[i] = pending[i + 1];
+    }
+}
+
+void notify_get_stats(notify_stats_t *stats_out, bool reset) {
+    *stats_out = stats;
+    stats_out->pending = pending_count;
+    if(reset) {
+        stats.sent = 0;
+        stats.coalesced = 0;
+    }
+}
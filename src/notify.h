@@ -0,0 +1,20 @@
+#pragma once
+#include <stdint.h>
+
+// Minimum time between audio interrupt messages to the host.
+// Matches the polling interval of the interrupt endpoint.
+#ifndef AUDIO_NOTIFY_INTERVAL_MS
+#define AUDIO_NOTIFY_INTERVAL_MS 16
+#endif
+
+typedef struct {
+    uint32_t sent;
+    uint32_t coalesced;     // Changes merged into one already pending
+    uint32_t pending;
+} notify_stats_t;
+
+// Queue a control change notification, repeats of a pending one are merged
+void notify_changed(uint8_t entity, uint8_t channel, uint8_t control);
+// Send at most one pending notification, call right after tud_task()
+void notify_task();
+void notify_get_stats(notify_stats_t *stats, bool reset);
@@ -0,0 +1,70 @@
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "oversample.h"
+#include "halfband_taps.h"
+#include "fixed.h"
+#include "profile.h"
+
+static const size_t TAPS = count_of(halfband_taps);
+
+// Input frames the filter looks back over
+static const size_t HISTORY = 2 * TAPS - 1;
+
+// Stereo interleaved, the last HISTORY frames of the previous block then this one
+static int16_t line[(HISTORY + OVERSAMPLE_MAX_FRAMES) * 2];
+
+uint32_t oversample_delay_frames() {
+    // The even outputs sit half way between input frames TAPS - 1 and TAPS back
+    return 2 * TAPS - 1;
+}
+
+void oversample_reset() {
+    memset(line, 0, sizeof(line));
+}
+
+// The symmetric taps of the even output, paired so each coefficient is one multiply.
+// `x` points at the newest frame of this channel, earlier frames are at negative offsets.
+static inline int16_t __not_in_flash_func(interpolate)(const int16_t *x) {
+    int32_t sum = 0;
+    for(auto j = 0u; j < TAPS; j++) {
+        int32_t pair = x[-(int32_t)(TAPS - 1 - j) * 2] + x[-(int32_t)(TAPS + j) * 2];
+        sum += pair * halfband_taps[j];
+    }
+    return fixed_sat16(fixed_shr_round(sum, HALFBAND_COEFF_BITS));
+}
+
+void __not_in_flash_func(oversample_2x)(int16_t *samples, size_t frames) {
+    if(frames > OVERSAMPLE_MAX_FRAMES) frames = OVERSAMPLE_MAX_FRAMES;
+
+    int16_t *in = line + HISTORY * 2;
+    memcpy(in, samples, frames * sizeof(int16_t) * 2);
+
+    for(auto n = 0u; n < frames; n++) {
+        const int16_t *x = in + n * 2;
+        int16_t *out = samples + n * 4;
+        out[0] = interpolate(x);
+        out[1] = interpolate(x + 1);
+        // The odd outputs land on the centre tap, an input frame as is
+        out[2] = x[-(int32_t)(TAPS - 1) * 2];
+        out[3] = x[-(int32_t)(TAPS - 1) * 2 + 1];
+    }
+
+    memmove(line, line + frames * 2, HISTORY * sizeof(int16_t) * 2);
+}
+
+uint32_t oversample_bench() {
+    static int16_t samples[48 * 2 * 2];
+    uint32_t seed = 1;
+    for(auto i = 0u; i < 48 * 2; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        samples[i] = (int16_t)(seed >> 16);
+    }
+
+    uint32_t start = profile_start();
+    oversample_2x(samples, 48);
+    uint32_t cycles = profile_cycles(start);
+
+    oversample_reset();
+    return cycles;
+}
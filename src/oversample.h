@@ -0,0 +1,24 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// 2x halfband interpolation, 48kHz to 96kHz, for AUDIO_OVERSAMPLE_2X.
+// Moves the images of the audio band from 24-48kHz up to 76-96kHz at the
+// output of the filterless amp, with the filter taking out everything
+// between 28kHz and 68kHz by ~79dB.
+
+#ifndef AUDIO_OVERSAMPLE_2X
+#define AUDIO_OVERSAMPLE_2X 0
+#endif
+
+// Input frames per call, a packet with a frame to spare
+static const size_t OVERSAMPLE_MAX_FRAMES = 64;
+
+// Group delay, in output (96kHz) frames
+uint32_t oversample_delay_frames();
+
+void oversample_reset();
+// Upsample `frames` stereo frames in place, `samples` must hold twice as many
+void oversample_2x(int16_t *samples, size_t frames);
+// Worst case cycles for one millisecond of audio
+uint32_t oversample_bench();
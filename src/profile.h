@@ -0,0 +1,20 @@
+#pragma once
+#include "hardware/structs/systick.h"
+
+// SysTick runs from the processor clock and counts down from 0xffffff,
+// so it wraps every ~67ms at 250MHz. Only use it for short sections.
+static const uint32_t PROFILE_SYSTICK_MASK = 0x00ffffff;
+
+static inline void profile_init() {
+    systick_hw->rvr = PROFILE_SYSTICK_MASK;
+    systick_hw->cvr = 0;
+    systick_hw->csr = 0b101; // CLKSOURCE = processor clock, ENABLE
+}
+
+static inline uint32_t profile_start() {
+    return systick_hw->cvr;
+}
+
+static inline uint32_t profile_cycles(uint32_t start) {
+    return (start - systick_hw->cvr) & PROFILE_SYSTICK_MASK;
+}
@@ -0,0 +1,75 @@
+#include "pico/stdlib.h"
+#include "selftest.h"
+#include "i2s_audio.h"
+#include "profile.h"
+
+static const size_t BLOCK_FRAMES = 48;
+static const uint32_t SAMPLE_RATE = 48000;
+
+static const siggen_config_t sequence[] = {
+    {SIGGEN_SINE, -12, 1000, 0, 1000},
+    {SIGGEN_SWEEP, -12, 20, 20000, 1000},
+    {SIGGEN_PINK, -12, 0, 0, 1000},
+    {SIGGEN_IMPULSE, -12, 10, 0, 1000},
+};
+
+static bool active = false;
+static size_t sequence_next = count_of(sequence);
+static selftest_stats_t stats = {};
+
+// Only the generator is timed, not the handover to I2S
+static void fill(int16_t *out, size_t frames) {
+    uint32_t start = profile_start();
+    siggen_fill(out, frames);
+    uint32_t cycles = profile_cycles(start);
+
+    stats.total_cycles += cycles;
+    if(cycles > stats.worst_cycles) stats.worst_cycles = cycles;
+}
+
+void selftest_start(const siggen_config_t *config) {
+    sequence_next = count_of(sequence);
+    siggen_start(config, SAMPLE_RATE);
+    active = siggen_active();
+}
+
+void selftest_start_sequence() {
+    siggen_start(&sequence[0], SAMPLE_RATE);
+    sequence_next = 1;
+    active = true;
+}
+
+void selftest_stop() {
+    siggen_stop();
+    sequence_next = count_of(sequence);
+    active = false;
+}
+
+bool selftest_active() {
+    return active;
+}
+
+void selftest_task() {
+    if(!active) return;
+
+    if(!siggen_active()) {
+        if(sequence_next == count_of(sequence)) {
+            active = false;
+            return;
+        }
+        siggen_start(&sequence[sequence_next++], SAMPLE_RATE);
+    }
+
+    // Keep every free buffer filled so I2S is never waiting on us
+    bool starved;
+    while(i2s_audio_give_direct(fill, BLOCK_FRAMES, &starved)) {
+        stats.blocks++;
+        if(starved) stats.starved++;
+        if(!siggen_active()) break;
+    }
+}
+
+void selftest_get_stats(selftest_stats_t *stats_out, bool reset) {
+    *stats_out = stats;
+    if(reset) stats = {};
+}
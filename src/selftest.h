@@ -0,0 +1,20 @@
+#pragma once
+#include <stdint.h>
+#include "siggen.h"
+
+typedef struct {
+    uint32_t blocks;
+    uint32_t starved;       // Blocks handed over with nothing else queued for I2S
+    uint32_t worst_cycles;  // Per block of generation
+    uint32_t total_cycles;
+} selftest_stats_t;
+
+// Feed the signal generator straight to I2S, bypassing USB, volume and mixing
+void selftest_start(const siggen_config_t *config);
+// Sine, sweep, pink noise and impulses, one second each at -12dBFS
+void selftest_start_sequence();
+void selftest_stop();
+bool selftest_active();
+// Keep I2S fed while active, call from the main loop
+void selftest_task();
+void selftest_get_stats(selftest_stats_t *stats, bool reset);
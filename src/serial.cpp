@@ -0,0 +1,565 @@
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <string_view>
+#include <algorithm>
+
+#include "tusb.h"
+#include "serial.h"
+#include "i2s_audio.h"
+#include "spectrum.h"
+#include "mixer.h"
+#include "settings.h"
+#include "flash_ops.h"
+#include "board.h"
+#include "notify.h"
+#include "boot.h"
+#include "sounds.h"
+#include "selftest.h"
+#include "fixed_bench.h"
+#include "oversample.h"
+#include "update.h"
+#include "latency.h"
+#include "health.h"
+#include "loop_profile.h"
+#include "audio_arena.h"
+#include "loudness.h"
+#include "vbass.h"
+#include "bench_cases.h"
+#include "dsp.h"
+#include "profile.h"
+
+#include "pico/bootrom.h"
+#include "hardware/structs/rosc.h"
+#include "hardware/watchdog.h"
+#include "hardware/sync.h"
+#include "hardware/clocks.h"
+#include "pico/timeout_helper.h"
+
+extern bool vu_meter_mode;
+extern input_latency_t input_latency;
+extern bool spk_streaming;
+
+const size_t MAX_UART_PACKET = 64;
+
+const size_t COMMAND_LEN = 4;
+uint8_t command_buffer[COMMAND_LEN];
+std::string_view command((const char *)command_buffer, COMMAND_LEN);
+
+
+uint cdc_task(uint8_t *buf, size_t buf_len);
+
+uint cdc_task(uint8_t *buf, size_t buf_len) {
+
+    if (tud_cdc_connected()) {
+        if (tud_cdc_available()) {
+            return tud_cdc_read(buf, buf_len);
+        }
+    }
+
+    return 0;
+}
+
+bool cdc_wait_for(std::string_view data, uint timeout_ms=50) {
+    timeout_state ts;
+    absolute_time_t until = delayed_by_ms(get_absolute_time(), timeout_ms);
+    check_timeout_fn check_timeout = init_single_timeout_until(&ts, until);
+
+    for(auto expected_char : data) {
+        char got_char;
+        while(1){
+            tud_task();
+            if (cdc_task((uint8_t *)&got_char, 1) == 1) break;
+            if(check_timeout(&ts, false)) return false;
+        }
+        if (got_char != expected_char) return false;
+    }
+    return true;
+}
+
+size_t cdc_get_bytes(const uint8_t *buffer, const size_t len, const uint timeout_ms=1000) {
+    memset((void *)buffer, len, 0);
+
+    uint8_t *p = (uint8_t *)buffer;
+
+    timeout_state ts;
+    absolute_time_t until = delayed_by_ms(get_absolute_time(), timeout_ms);
+    check_timeout_fn check_timeout = init_single_timeout_until(&ts, until);
+
+    size_t bytes_remaining = len;
+    while (bytes_remaining && !check_timeout(&ts, false)) {
+        tud_task(); // tinyusb device task
+        size_t bytes_read = cdc_task(p, std::min(bytes_remaining, MAX_UART_PACKET));
+        bytes_remaining -= bytes_read;
+        p += bytes_read;
+    }
+    return len - bytes_remaining;
+}
+
+size_t cdc_write(const void *data, size_t len, uint timeout_ms) {
+    if (!tud_cdc_connected()) return 0;
+
+    spectrum_flush(timeout_ms);
+
+    const uint8_t *p = (const uint8_t *)data;
+
+    timeout_state ts;
+    absolute_time_t until = delayed_by_ms(get_absolute_time(), timeout_ms);
+    check_timeout_fn check_timeout = init_single_timeout_until(&ts, until);
+
+    // The TX FIFO is only 64 bytes, so keep the stack running while we drain it
+    size_t bytes_remaining = len;
+    while (bytes_remaining && !check_timeout(&ts, false)) {
+        size_t bytes_written = tud_cdc_write(p, bytes_remaining);
+        bytes_remaining -= bytes_written;
+        p += bytes_written;
+        tud_cdc_write_flush();
+        if (bytes_remaining) tud_task();
+    }
+    return len - bytes_remaining;
+}
+
+void cdc_printf(const char *format, ...) {
+    char buf[128];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(buf, sizeof(buf), format, args);
+    va_end(args);
+    if (len > 0) cdc_write(buf, std::min((size_t)len, sizeof(buf) - 1));
+}
+
+static void print_levels() {
+    i2s_audio_levels_t levels;
+    i2s_audio_get_levels(&levels, true);
+    cdc_printf("frames %lu silent_ms %lu\n", levels.frames, levels.silent_ms);
+    for(auto c = 0u; c < 2; c++) {
+        cdc_printf("ch%u peak %u rms %u clips %lu\n", c, levels.peak[c], levels.rms[c], levels.clips[c]);
+    }
+}
+
+static void print_benchmark() {
+    for(uint8_t bit_depth : {16, 24, 32}) {
+        uint32_t plain = i2s_audio_bench_kernel(bit_depth, false);
+        uint32_t metering = i2s_audio_bench_kernel(bit_depth, true);
+        uint32_t mixing = i2s_audio_bench_kernel(bit_depth, true, true);
+        cdc_printf("%s%u plain %lu metering %lu mixing %lu cycles/ms\n", bit_depth == 32 ? "f" : "s", bit_depth, plain, metering, mixing);
+        uint32_t interp_metering = i2s_audio_bench_kernel(bit_depth, true, false, true);
+        uint32_t interp_mixing = i2s_audio_bench_kernel(bit_depth, true, true, true);
+        cdc_printf("%s%u interp metering %lu mixing %lu cycles/ms\n", bit_depth == 32 ? "f" : "s", bit_depth, interp_metering, interp_mixing);
+    }
+    cdc_printf("f32 soft-float %lu cycles/ms\n", i2s_audio_bench_kernel(0, false));
+    cdc_printf("ui sound adpcm decode+mix worst %lu cycles/ms\n", sounds_bench(48));
+    cdc_printf("oversample 2x %lu cycles/ms\n", oversample_bench());
+    cdc_printf("loudness shelves %lu cycles/ms\n", loudness_bench());
+    cdc_printf("virtual bass %lu cycles/ms\n", vbass_bench());
+    for(auto i = 0u; i < FIXED_BENCH_OP_COUNT; i++) {
+        uint32_t cycles = fixed_bench((fixed_bench_op_t)i);
+        cdc_printf("%s %lu.%02lu cycles/op\n", fixed_bench_name((fixed_bench_op_t)i), cycles / 100, cycles % 100);
+    }
+}
+
+// One JSON object per line, for bench-picade-audio.py to compare against a baseline
+static void print_benchmark_json() {
+    // The give cases play, don't trample on the host's audio
+    if(spk_streaming) {
+        cdc_printf("{\"error\":\"streaming\"}\n");
+        return;
+    }
+
+    bench_cases_begin();
+    cdc_printf("{\"platform\":\"board\",\"clock_hz\":%lu,\"dsp\":\"%s\",\"frames\":%u}\n", clock_get_hz(clk_sys), dsp_target_name(), BENCH_CASE_FRAMES);
+    for(auto i = 0u; i < BENCH_CASE_COUNT; i++) {
+        const bench_case_t *c = &bench_cases[i];
+        c->setup();
+        c->run();
+
+        // Best of a few, a packet given with no buffer free is dropped untimed
+        // so wait for I2S to take one
+        const uint32_t runs = c->gives ? 3 : 8;
+        uint32_t best = UINT32_MAX;
+        for(auto r = 0u, attempts = 0u; r < runs && attempts < 100; attempts++) {
+            uint32_t dropped = i2s_audio_dropped_buffers();
+            uint32_t start = profile_start();
+            c->run();
+            uint32_t cycles = profile_cycles(start);
+            if(i2s_audio_dropped_buffers() != dropped) {
+                sleep_ms(1);
+                continue;
+            }
+            best = std::min(best, cycles);
+            r++;
+        }
+        cdc_printf("{\"name\":\"%s\",\"runs\":%lu,\"cycles\":%lu,\"cycles_per_frame\":%lu.%02lu}\n", c->name, runs, best,
+            best / BENCH_CASE_FRAMES, best * 100 / BENCH_CASE_FRAMES % 100);
+    }
+    bench_cases_end();
+}
+
+static void print_loop_profile() {
+    loop_profile_stats_t stats;
+    loop_profile_get_stats(&stats, true);
+    cdc_printf("loops %lu max_loop_us %lu max_audio_gap_us %lu\n", stats.loops, stats.max_loop_us, stats.max_audio_gap_us);
+    for(auto i = 0u; i < LOOP_TASK_COUNT; i++) {
+        const loop_task_stats_t &task = stats.tasks[i];
+        cdc_printf("%s calls %lu max %lu hist", loop_profile_name((loop_task_t)i), task.calls, task.max_cycles);
+        for(auto b = 0u; b < LOOP_PROFILE_BUCKETS; b++) {
+            if(task.histogram[b]) cdc_printf(" %u:%lu", b, task.histogram[b]);
+        }
+        cdc_printf("\n");
+    }
+}
+
+static void print_audio_memory() {
+    audio_arena_stats_t stats;
+    audio_arena_get_stats(&stats);
+    cdc_printf("packets %lu producer %lu i2s %lu silence %lu usb %lu\n", stats.packets, stats.producer, stats.i2s, stats.silence, stats.usb);
+    cdc_printf("total %lu budget %lu free %lu\n", stats.total, stats.budget, stats.budget - stats.total);
+}
+
+static void print_vbass() {
+    vbass_config_t config;
+    vbass_get_config(&config);
+    cdc_printf("vbass %s cutoff_hz %u gain_db %d envelope %ld\n",
+        config.enabled ? "on" : "off", config.cutoff_hz, config.gain_db, vbass_envelope());
+}
+
+static void print_spectrum_stats() {
+    spectrum_stats_t stats;
+    spectrum_get_stats(&stats);
+    cdc_printf("fft_cycles %lu core1_permille %lu frames %lu\n", stats.fft_cycles, stats.busy_permille, stats.frames);
+}
+
+static void print_mixer_stats() {
+    mixer_stats_t stats;
+    mixer_get_stats(&stats, true);
+    cdc_printf("level %lu max %lu frames underruns %lu dropped %lu\n",
+        stats.level_frames, stats.max_level_frames, stats.underruns, stats.dropped_frames);
+}
+
+static void print_settings_stats() {
+    settings_stats_t stats;
+    settings_get_stats(&stats);
+    flash_ops_stats_t flash;
+    flash_ops_get_stats(&flash);
+    cdc_printf("compactions %lu free %lu flash_writes %lu worst_stall_us %lu\n",
+        stats.compactions, stats.free_records, flash.writes, flash.worst_stall_us);
+    if(flash.playback_writes) {
+        cdc_printf("playback_writes %lu worst_margin_us %ld\n", flash.playback_writes, flash.worst_margin_us);
+    }
+}
+
+static void print_input_latency() {
+    cdc_printf("knob_to_gain_us last %lu max %lu output_us %lu dropped %lu\n",
+        input_latency.last_us, input_latency.max_us, input_latency.output_us, get_input_dropped());
+    input_latency.max_us = 0;
+}
+
+static void print_notify_stats() {
+    notify_stats_t stats;
+    notify_get_stats(&stats, true);
+    cdc_printf("sent %lu coalesced %lu pending %lu interval_ms %u\n",
+        stats.sent, stats.coalesced, stats.pending, AUDIO_NOTIFY_INTERVAL_MS);
+}
+
+static void print_boot_times() {
+    uint32_t previous = 0;
+    for(auto i = 0u; i < BOOT_PHASE_COUNT; i++) {
+        uint32_t t = boot_time_us((boot_phase_t)i);
+        if(!t) {
+            cdc_printf("%s -\n", boot_phase_name((boot_phase_t)i));
+            continue;
+        }
+        cdc_printf("%s %lu us (+%lu)\n", boot_phase_name((boot_phase_t)i), t, t - previous);
+        previous = t;
+    }
+}
+
+static void print_update_stats() {
+    update_stats_t stats;
+    update_get_stats(&stats);
+    cdc_printf("received %lu/%lu bytes %lu KB/s playback_refusals %lu\n",
+        stats.received, stats.size, stats.bytes_per_sec / 1024, stats.playback_refusals);
+    if(stats.installed || stats.install_failed) {
+        // Audio was down for the install, the reboot and the boot up to starting I2S
+        uint32_t audio_off_ms = (stats.install_us + boot_time_us(BOOT_AUDIO)) / 1000;
+        cdc_printf("last install %s %lu ms audio_off %lu ms\n",
+            stats.installed ? "ok" : "failed", stats.install_us / 1000, audio_off_ms);
+    }
+}
+
+static void print_latency_stats() {
+    latency_stats_t stats;
+    latency_get_stats(&stats, true);
+    cdc_printf("latency_us now %lu avg %lu min %lu max %lu reported %lu system %lu changes %lu\n",
+        stats.current_us, stats.average_us, stats.min_us == UINT32_MAX ? 0 : stats.min_us, stats.max_us,
+        stats.reported_us, latency_system_ns() / 1000, stats.changes);
+}
+
+static void print_stream_stats() {
+    i2s_audio_stream_stats_t stats;
+    i2s_audio_get_stream_stats(&stats);
+    cdc_printf("opens %lu closes %lu preroll %lu open_us last %lu min %lu max %lu\n",
+        stats.opens, stats.closes, stats.preroll_frames, stats.last_open_us,
+        stats.min_open_us == UINT32_MAX ? 0 : stats.min_open_us, stats.max_open_us);
+}
+
+// Per second, and the share of the CPU spent getting audio out. The minimum
+// safe latency is how far the queue could shrink and still keep a packet spare.
+static void print_engine_stats() {
+    i2s_audio_engine_stats_t stats;
+    i2s_audio_get_engine_stats(&stats, true);
+    uint64_t elapsed_us = std::max<uint32_t>(stats.elapsed_us, 1);
+    uint64_t available = elapsed_us * (clock_get_hz(clk_sys) / 1000000);
+    uint32_t load = (stats.irq_cycles + stats.give_cycles) * 10000 / available;
+    uint32_t rate = i2s_audio_sample_rate();
+    uint32_t min_safe_us = 0;
+    if(stats.min_queued != UINT32_MAX) {
+        uint32_t frames = stats.nominal - std::min(stats.min_queued, stats.nominal) + rate / 1000;
+        min_safe_us = (uint64_t)frames * 1000000 / rate;
+    }
+    cdc_printf("engine %s irqs/s %lu irq_cycles avg %lu max %lu give_cycles/frame %lu cpu %lu.%02lu%%\n",
+        stats.ring ? "ring" : "pool", (uint32_t)(stats.irqs * 1000000ull / elapsed_us),
+        stats.irqs ? (uint32_t)(stats.irq_cycles / stats.irqs) : 0, stats.irq_max_cycles,
+        stats.given_frames ? (uint32_t)(stats.give_cycles / stats.given_frames) : 0, load / 100, load % 100);
+    cdc_printf("nominal_us %lu min_queued %lu min_safe_us %lu underruns %lu overruns %lu laps %lu\n",
+        (uint32_t)((uint64_t)stats.nominal * 1000000 / rate),
+        stats.min_queued == UINT32_MAX ? 0 : stats.min_queued, min_safe_us, stats.underruns, stats.overruns, stats.laps);
+}
+
+static void print_health_stats() {
+    static const char *reset_names[] = {"none", "stall", "hang"};
+    health_stats_t stats;
+    health_get_stats(&stats);
+    cdc_printf("stalls %lu recovered %lu worst_recover_us %lu last_reset %s\n",
+        stats.stalls, stats.recovered, stats.worst_recover_us, reset_names[stats.last_reset]);
+    cdc_printf("buffers/s %lu frames/s %lu dropped %lu\n",
+        stats.buffers_per_sec, stats.frames_per_sec, stats.dropped_buffers);
+    for(auto i = 0u; i < MIN(stats.log_count, HEALTH_LOG_SIZE); i++) {
+        const health_event_t &event = stats.log[i];
+        cdc_printf("at %lu ms detect_us %lu recover_us %lu attempts %lu\n",
+            event.time_ms, event.detect_us, event.recover_us, event.attempts);
+    }
+}
+
+static void print_selftest_stats() {
+    selftest_stats_t stats;
+    selftest_get_stats(&stats, true);
+    cdc_printf("active %u blocks %lu starved %lu worst %lu avg %lu cycles/block\n",
+        selftest_active(), stats.blocks, stats.starved, stats.worst_cycles,
+        stats.blocks ? stats.total_cycles / stats.blocks : 0);
+}
+
+void serial_task(void) {
+  // The port belongs to update_task() until the image is in
+  if (update_receiving()) return;
+
+  if (tud_cdc_connected()) {
+      if (tud_cdc_available()) {
+        if(!cdc_wait_for("multiverse:")) {
+            return; // Couldn't get 16 bytes of command
+        }
+
+        if(cdc_get_bytes(command_buffer, COMMAND_LEN) != COMMAND_LEN) {
+            //display::info("cto");
+            return;
+        }
+
+        if(command == "_rst") {
+            sleep_ms(500);
+            save_and_disable_interrupts();
+            rosc_hw->ctrl = ROSC_CTRL_ENABLE_VALUE_ENABLE << ROSC_CTRL_ENABLE_LSB;
+            watchdog_reboot(0, 0, 0);
+            return;
+        }
+
+        if(command == "_usb") {
+            sleep_ms(500);
+            save_and_disable_interrupts();
+            rosc_hw->ctrl = ROSC_CTRL_ENABLE_VALUE_ENABLE << ROSC_CTRL_ENABLE_LSB;
+            reset_usb_boot(0, 0);
+            return;
+        }
+
+        // Print and reset the signal level meters
+        if(command == "_lvl") {
+            print_levels();
+            return;
+        }
+
+        // VU meter on the status LED, on or off
+        if(command == "_vu1" || command == "_vu0") {
+            vu_meter_mode = command == "_vu1";
+            return;
+        }
+
+        // Loudness compensated volume, on or off, and saved
+        if(command == "_ld1" || command == "_ld0") {
+            loudness_set_enabled(command == "_ld1");
+            settings_set(SETTING_LOUDNESS, loudness_enabled());
+            return;
+        }
+
+        // Virtual bass: on/off, harmonic gain dB, crossover Hz. Saved.
+        if(command == "_vbs") {
+            uint8_t payload[4];
+            if(cdc_get_bytes(payload, sizeof(payload)) != sizeof(payload)) return;
+            vbass_config_t config = {
+                .enabled = payload[0] != 0,
+                .cutoff_hz = (uint16_t)(payload[2] | payload[3] << 8),
+                .gain_db = (int8_t)payload[1],
+            };
+            vbass_set_config(&config);
+            vbass_get_config(&config);
+            settings_set(SETTING_VBASS, vbass_config_to_setting(&config));
+            return;
+        }
+
+        if(command == "_vbi") {
+            print_vbass();
+            return;
+        }
+
+        // Stream spectrum frames, on or off
+        if(command == "_sp1" || command == "_sp0") {
+            spectrum_set_streaming(command == "_sp1");
+            return;
+        }
+
+        if(command == "_spi") {
+            print_spectrum_stats();
+            return;
+        }
+
+        // System sounds queue depth (added latency) and timing slips
+        if(command == "_mix") {
+            print_mixer_stats();
+            return;
+        }
+
+        // Volume knob and mute button reaction time
+        if(command == "_inp") {
+            print_input_latency();
+            return;
+        }
+
+        // Volume/mute interrupt messages sent to the host
+        if(command == "_ntf") {
+            print_notify_stats();
+            return;
+        }
+
+        // Playback latency as measured and as reported to the host
+        if(command == "_lat") {
+            print_latency_stats();
+            return;
+        }
+
+        // Stream starts and stops, and the time from SET_INTERFACE to the first sample
+        if(command == "_trn") {
+            print_stream_stats();
+            return;
+        }
+
+        // What the I2S output engine costs in interrupts and cycles, and its latency
+        if(command == "_i2s") {
+            print_engine_stats();
+            return;
+        }
+
+        // Output stalls, how long they took to spot and to recover from
+        if(command == "_hlt") {
+            print_health_stats();
+            return;
+        }
+
+        if(command == "_mem") {
+            print_audio_memory();
+            return;
+        }
+
+        if(command == "_tsk") {
+            print_loop_profile();
+            return;
+        }
+
+        // Stop the I2S DMA, the health monitor should restart it within a few ms
+        if(command == "_stl") {
+            i2s_audio_inject_stall();
+            return;
+        }
+
+        // Power on to each boot phase, and to enumeration
+        if(command == "_bot") {
+            print_boot_times();
+            return;
+        }
+
+        // Test signal: type, level dBFS, freq, end freq, duration ms. Type 0 stops.
+        if(command == "_gen") {
+            uint8_t payload[8];
+            if(cdc_get_bytes(payload, sizeof(payload)) != sizeof(payload)) return;
+            siggen_config_t config = {
+                .type = (siggen_type_t)payload[0],
+                .level_db = (int8_t)payload[1],
+                .freq = (uint16_t)(payload[2] | payload[3] << 8),
+                .freq_end = (uint16_t)(payload[4] | payload[5] << 8),
+                .duration_ms = (uint16_t)(payload[6] | payload[7] << 8),
+            };
+            if(config.type == SIGGEN_OFF) {
+                selftest_stop();
+            } else {
+                selftest_start(&config);
+            }
+            return;
+        }
+
+        if(command == "_sst") {
+            selftest_start_sequence();
+            return;
+        }
+
+        // Blocks fed, near starvation and generator cost
+        if(command == "_gst") {
+            print_selftest_stats();
+            return;
+        }
+
+        // Flash settings store wear and worst case interrupt stall
+        if(command == "_cfg") {
+            print_settings_stats();
+            return;
+        }
+
+        // Firmware image size and CRC32, then the image, see update-picade-audio.py
+        if(command == "_upd") {
+            uint8_t payload[8];
+            if(cdc_get_bytes(payload, sizeof(payload)) != sizeof(payload)) return;
+            uint32_t size, crc;
+            memcpy(&size, payload, sizeof(size));
+            memcpy(&crc, payload + 4, sizeof(crc));
+            update_begin(size, crc);
+            return;
+        }
+
+        if(command == "_ups") {
+            print_update_stats();
+            return;
+        }
+
+        // Both block the main loop for longer than the watchdog allows
+        if(command == "_bnc") {
+            health_pause_loop_watchdog(true);
+            print_benchmark();
+            health_pause_loop_watchdog(false);
+            return;
+        }
+
+        if(command == "_bnj") {
+            health_pause_loop_watchdog(true);
+            print_benchmark_json();
+            health_pause_loop_watchdog(false);
+            return;
+        }
+      }
+    }
+}
@@ -0,0 +1,7 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+void serial_task(void);
+size_t cdc_write(const void *data, size_t len, uint timeout_ms=50);
+void cdc_printf(const char *format, ...) __attribute__((format(printf, 1, 2)));
@@ -0,0 +1,119 @@
+#include "pico/stdlib.h"
+#include "hardware/flash.h"
+#include "bsp/board_api.h"
+#include "settings.h"
+#include "settings_log.h"
+#include "flash_ops.h"
+
+// The last two sectors of flash, clear of the firmware image
+static const uint32_t SETTINGS_FLASH_OFFSET = PICO_FLASH_SIZE_BYTES - 2 * FLASH_SECTOR_SIZE;
+
+// Wait this long after the last change, so a turn of the knob is one write
+static const uint32_t SETTINGS_SETTLE_MS = 2000;
+
+// If audio never stops, give up waiting for idle and write anyway
+static const uint32_t SETTINGS_MAX_DEFER_MS = 30000;
+
+static_assert(SETTINGS_LOG_SECTOR_SIZE == FLASH_SECTOR_SIZE);
+static_assert(SETTINGS_LOG_PAGE_SIZE == FLASH_PAGE_SIZE);
+
+static settings_log_t store;
+
+static int32_t pending[SETTINGS_LOG_MAX_KEYS];
+static uint16_t dirty = 0;
+static uint32_t first_change_ms = 0;
+static uint32_t last_change_ms = 0;
+
+static bool playback_write = false;
+static settings_stats_t stats = {};
+
+static void flash_erase(uint32_t offset) {
+    flash_ops_erase(SETTINGS_FLASH_OFFSET + offset, playback_write);
+}
+
+static void flash_program(uint32_t offset, const uint8_t *data) {
+    flash_ops_program(SETTINGS_FLASH_OFFSET + offset, data, playback_write);
+}
+
+static const settings_log_flash_t flash = {
+    .base = (const uint8_t *)(XIP_BASE + SETTINGS_FLASH_OFFSET),
+    .erase = flash_erase,
+    .program = flash_program,
+};
+
+void settings_init() {
+    settings_log_load(&store, &flash);
+}
+
+bool settings_get(settings_key_t key, int32_t *value) {
+    if(dirty & (1u << key)) {
+        *value = pending[key];
+        return true;
+    }
+    if(store.present & (1u << key)) {
+        *value = store.values[key];
+        return true;
+    }
+    return false;
+}
+
+void settings_set(settings_key_t key, int32_t value) {
+    int32_t current;
+    if(settings_get(key, &current) && current == value) return;
+
+    // A change back to what's already stored doesn't need writing
+    if((store.present & (1u << key)) && store.values[key] == value) {
+        dirty &= ~(1u << key);
+        return;
+    }
+
+    if(!dirty) first_change_ms = board_millis();
+    last_change_ms = board_millis();
+    pending[key] = value;
+    dirty |= 1u << key;
+}
+
+void settings_task(bool playing) {
+    if(!dirty) return;
+
+    uint32_t now = board_millis();
+    if(now - last_change_ms < SETTINGS_SETTLE_MS) return;
+
+    uint8_t keys[SETTINGS_LOG_MAX_KEYS];
+    int32_t values[SETTINGS_LOG_MAX_KEYS];
+    size_t count = 0;
+    for(auto key = 0u; key < SETTINGS_LOG_MAX_KEYS; key++) {
+        if(!(dirty & (1u << key))) continue;
+        keys[count] = key;
+        values[count] = pending[key];
+        count++;
+    }
+
+    if(playing) {
+        // Never erase under playback, that stalls for tens of milliseconds
+        if(now - first_change_ms < SETTINGS_MAX_DEFER_MS) return;
+        if(settings_log_free(&store) < count) return;
+        if(!flash_ops_can_program(true)) return;
+        // A batch crossing a page boundary would need two programs
+        if(count > 1 && (store.next_slot % (FLASH_PAGE_SIZE / sizeof(settings_log_slot_t))) + count > FLASH_PAGE_SIZE / sizeof(settings_log_slot_t)) {
+            count = 1;
+        }
+    }
+
+    playback_write = playing;
+    if(!settings_log_append(&store, keys, values, count)) {
+        settings_log_compact(&store);
+        stats.compactions++;
+        settings_log_append(&store, keys, values, count);
+    }
+    playback_write = false;
+
+    for(auto i = 0u; i < count; i++) {
+        dirty &= ~(1u << keys[i]);
+    }
+}
+
+void settings_get_stats(settings_stats_t *stats_out) {
+    *stats_out = stats;
+    stats_out->free_records = settings_log_free(&store);
+}
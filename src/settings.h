@@ -0,0 +1,23 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// Keys are stored in flash, never renumber them
+enum settings_key_t : uint8_t {
+    SETTING_VOLUME = 0,
+    SETTING_MUTE = 1,
+    SETTING_LOUDNESS = 2,
+    SETTING_VBASS = 3,
+};
+
+typedef struct {
+    uint32_t compactions;
+    uint32_t free_records;
+} settings_stats_t;
+
+void settings_init();
+bool settings_get(settings_key_t key, int32_t *value);
+void settings_set(settings_key_t key, int32_t value);
+// Write out changed settings, once they've settled and preferably while no audio is playing
+void settings_task(bool playing);
+void settings_get_stats(settings_stats_t *stats);
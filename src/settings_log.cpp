@@ -0,0 +1,149 @@
+#include <string.h>
+
+#include "settings_log.h"
+
+static const uint16_t TAG_HEADER = 0xa55a;
+static const uint16_t TAG_ERASED = 0xffff;
+
+static uint16_t crc16(uint16_t tag, uint32_t value) {
+    uint8_t bytes[6] = {
+        (uint8_t)tag, (uint8_t)(tag >> 8),
+        (uint8_t)value, (uint8_t)(value >> 8), (uint8_t)(value >> 16), (uint8_t)(value >> 24)
+    };
+    uint16_t crc = 0xffff;
+    for(auto byte : bytes) {
+        crc ^= (uint16_t)byte << 8;
+        for(auto bit = 0u; bit < 8; bit++) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+static const settings_log_slot_t *sector_slots(const settings_log_t *log, uint8_t sector) {
+    return (const settings_log_slot_t *)(log->flash->base + sector * SETTINGS_LOG_SECTOR_SIZE);
+}
+
+static bool slot_valid(const settings_log_slot_t *slot) {
+    return slot->crc == crc16(slot->tag, slot->value);
+}
+
+static bool slot_erased(const settings_log_slot_t *slot) {
+    return slot->tag == TAG_ERASED && slot->crc == 0xffff && slot->value == 0xffffffff;
+}
+
+static bool header_valid(const settings_log_slot_t *slot) {
+    return slot->tag == TAG_HEADER && slot_valid(slot);
+}
+
+// Program slots into a sector, merging with what's already in each page.
+// Programming a byte with its current value leaves it unchanged, so earlier
+// records in a partially used page survive being programmed again.
+static void program_slots(settings_log_t *log, uint8_t sector, uint16_t first_slot, const settings_log_slot_t *slots, size_t count) {
+    const uint32_t slots_per_page = SETTINGS_LOG_PAGE_SIZE / sizeof(settings_log_slot_t);
+    uint8_t page[SETTINGS_LOG_PAGE_SIZE];
+
+    while(count) {
+        uint32_t page_index = first_slot / slots_per_page;
+        uint32_t offset = sector * SETTINGS_LOG_SECTOR_SIZE + page_index * SETTINGS_LOG_PAGE_SIZE;
+        uint32_t in_page = first_slot % slots_per_page;
+        size_t n = slots_per_page - in_page;
+        if(n > count) n = count;
+
+        memcpy(page, log->flash->base + offset, SETTINGS_LOG_PAGE_SIZE);
+        memcpy(page + in_page * sizeof(settings_log_slot_t), slots, n * sizeof(settings_log_slot_t));
+        log->flash->program(offset, page);
+
+        first_slot += n;
+        slots += n;
+        count -= n;
+    }
+}
+
+void settings_log_load(settings_log_t *log, const settings_log_flash_t *flash) {
+    memset(log, 0, sizeof(settings_log_t));
+    log->flash = flash;
+
+    const settings_log_slot_t *header[2] = {sector_slots(log, 0), sector_slots(log, 1)};
+    bool valid[2] = {header_valid(header[0]), header_valid(header[1])};
+
+    if(!valid[0] && !valid[1]) {
+        // Unformatted, the first append will compact into sector 0
+        log->sector = 1;
+        log->next_slot = SETTINGS_LOG_SLOTS;
+        return;
+    }
+
+    if(valid[0] && valid[1]) {
+        log->sector = (int32_t)(header[1]->value - header[0]->value) > 0 ? 1 : 0;
+    } else {
+        log->sector = valid[1] ? 1 : 0;
+    }
+    log->sequence = header[log->sector]->value;
+
+    // Records with a bad CRC were torn by power loss and are skipped.
+    // Append after the last slot that isn't erased.
+    const settings_log_slot_t *slots = sector_slots(log, log->sector);
+    log->next_slot = 1;
+    for(auto i = 1u; i < SETTINGS_LOG_SLOTS; i++) {
+        if(slot_erased(&slots[i])) continue;
+        log->next_slot = i + 1;
+        if(!slot_valid(&slots[i]) || slots[i].tag >= SETTINGS_LOG_MAX_KEYS) continue;
+        log->values[slots[i].tag] = (int32_t)slots[i].value;
+        log->present |= 1u << slots[i].tag;
+    }
+}
+
+uint32_t settings_log_free(const settings_log_t *log) {
+    return SETTINGS_LOG_SLOTS - log->next_slot;
+}
+
+bool settings_log_append(settings_log_t *log, const uint8_t *keys, const int32_t *values, size_t count) {
+    if(count > settings_log_free(log)) return false;
+    if(!count) return true;
+
+    settings_log_slot_t slots[SETTINGS_LOG_MAX_KEYS];
+    size_t n = 0;
+    for(auto i = 0u; i < count; i++) {
+        if(keys[i] >= SETTINGS_LOG_MAX_KEYS || n == SETTINGS_LOG_MAX_KEYS) return false;
+        slots[n].tag = keys[i];
+        slots[n].value = (uint32_t)values[i];
+        slots[n].crc = crc16(slots[n].tag, slots[n].value);
+        n++;
+    }
+
+    program_slots(log, log->sector, log->next_slot, slots, n);
+    log->next_slot += n;
+
+    for(auto i = 0u; i < n; i++) {
+        log->values[keys[i]] = values[i];
+        log->present |= 1u << keys[i];
+    }
+    return true;
+}
+
+void settings_log_compact(settings_log_t *log) {
+    uint8_t sector = log->sector ^ 1;
+    uint32_t sequence = log->sequence + 1;
+
+    log->flash->erase(sector * SETTINGS_LOG_SECTOR_SIZE);
+
+    settings_log_slot_t slots[SETTINGS_LOG_MAX_KEYS];
+    size_t n = 0;
+    for(auto key = 0u; key < SETTINGS_LOG_MAX_KEYS; key++) {
+        if(!(log->present & (1u << key))) continue;
+        slots[n].tag = key;
+        slots[n].value = (uint32_t)log->values[key];
+        slots[n].crc = crc16(slots[n].tag, slots[n].value);
+        n++;
+    }
+    if(n) program_slots(log, sector, 1, slots, n);
+
+    // The header goes in last, until then the old sector is still the valid one
+    settings_log_slot_t header = {TAG_HEADER, crc16(TAG_HEADER, sequence), sequence};
+    program_slots(log, sector, 0, &header, 1);
+
+    log->sector = sector;
+    log->sequence = sequence;
+    log->next_slot = 1 + n;
+}
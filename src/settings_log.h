@@ -0,0 +1,56 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// Log-structured key/value store over two flash sectors.
+//
+// Each sector is an array of 8 byte slots. Slot 0 is the header, the rest are
+// records appended in order. Later records for a key replace earlier ones.
+// When a sector fills up, the latest values are compacted into the other
+// sector and its header is written *last*, so power loss at any point leaves
+// at least one complete, valid sector.
+//
+// This file has no SDK dependencies so the format can be exercised on a host
+// against a simulated flash.
+
+const uint32_t SETTINGS_LOG_SECTOR_SIZE = 4096;
+const uint32_t SETTINGS_LOG_PAGE_SIZE = 256;
+const uint32_t SETTINGS_LOG_SLOTS = SETTINGS_LOG_SECTOR_SIZE / 8;
+const uint8_t SETTINGS_LOG_MAX_KEYS = 16;
+
+typedef struct {
+    uint16_t tag;       // Header tag, or key for a record. 0xffff is erased.
+    uint16_t crc;       // CRC16-CCITT of tag and value
+    uint32_t value;     // Header sequence, or record value
+} settings_log_slot_t;
+
+// Flash access. Offsets are relative to the start of the two sector region.
+// `program` is always page aligned and a whole page.
+typedef struct {
+    const uint8_t *base;
+    void (*erase)(uint32_t offset);
+    void (*program)(uint32_t offset, const uint8_t *data);
+} settings_log_flash_t;
+
+typedef struct {
+    const settings_log_flash_t *flash;
+    uint8_t sector;     // Active sector, 0 or 1
+    uint16_t next_slot; // Next free slot in the active sector
+    uint32_t sequence;  // Header sequence of the active sector
+    int32_t values[SETTINGS_LOG_MAX_KEYS];
+    uint16_t present;   // Bitmask of keys with a value
+} settings_log_t;
+
+// Scan both sectors and load the latest value of every key.
+// A region with no valid header is formatted on the next compaction.
+void settings_log_load(settings_log_t *log, const settings_log_flash_t *flash);
+
+// Number of records that can be appended without a compaction (ie: erase)
+uint32_t settings_log_free(const settings_log_t *log);
+
+// Append records for `count` keys, one page program per page touched.
+// Returns false, writing nothing, if there isn't room for all of them.
+bool settings_log_append(settings_log_t *log, const uint8_t *keys, const int32_t *values, size_t count);
+
+// Erase the other sector and rewrite the latest values into it
+void settings_log_compact(settings_log_t *log);
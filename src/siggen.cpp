@@ -0,0 +1,149 @@
+#include <math.h>
+#include <string.h>
+
+#include "siggen.h"
+
+// Quarter wave, with one extra entry so interpolation never wraps
+static const uint32_t QUARTER_BITS = 8;
+static const uint32_t QUARTER_SIZE = 1 << QUARTER_BITS;
+static int16_t quarter_sine[QUARTER_SIZE + 1];
+// Between entries, fine enough that the phase adds well under an LSB of error
+static const uint32_t FRAC_BITS = 14;
+
+static const uint32_t PINK_ROWS = 12;
+
+static siggen_config_t config = {};
+static uint32_t rate = 48000;
+static int32_t gain = 0;            // Q15, 32768 is unity
+static uint32_t frames_left = 0;
+static uint32_t phase = 0;
+static uint32_t phase_inc = 0;
+static uint32_t sweep_ratio = 0;    // Q30, phase_inc multiplier per sample
+static uint32_t impulse_period = 0;
+static uint32_t impulse_count = 0;
+
+static uint32_t noise_state = 1;
+static uint32_t pink_counter = 0;
+static int32_t pink_rows[PINK_ROWS];
+static int32_t pink_sum = 0;
+
+// Phase is a full turn in 32 bits, the top two pick the quadrant
+static inline int32_t sine(uint32_t phase) {
+    uint32_t quadrant = phase >> 30;
+    uint32_t offset = (phase >> (30 - QUARTER_BITS - FRAC_BITS)) & ((QUARTER_SIZE << FRAC_BITS) - 1);
+    if(quadrant & 1) offset = (QUARTER_SIZE << FRAC_BITS) - offset;
+
+    uint32_t index = offset >> FRAC_BITS;
+    int32_t frac = offset & ((1 << FRAC_BITS) - 1);
+    int32_t a = quarter_sine[index];
+    int32_t b = quarter_sine[index + (index < QUARTER_SIZE ? 1 : 0)];
+    int32_t value = a + (((b - a) * frac + (1 << (FRAC_BITS - 1))) >> FRAC_BITS);
+
+    return (quadrant & 2) ? -value : value;
+}
+
+static inline int32_t white() {
+    // xorshift32
+    noise_state ^= noise_state << 13;
+    noise_state ^= noise_state >> 17;
+    noise_state ^= noise_state << 5;
+    return (int32_t)noise_state >> 16;
+}
+
+// Voss-McCartney, each row updated at half the rate of the one before
+static inline int32_t pink() {
+    pink_counter++;
+    uint32_t row = __builtin_ctz(pink_counter | (1u << (PINK_ROWS - 1)));
+    int32_t value = white();
+    pink_sum += value - pink_rows[row];
+    pink_rows[row] = value;
+    // Rows plus a white term, scaled back to roughly +/-1.0 peaks
+    return (pink_sum + white()) / (int32_t)(PINK_ROWS / 2);
+}
+
+static uint32_t phase_increment(uint32_t freq) {
+    return (uint32_t)(((uint64_t)freq << 32) / rate);
+}
+
+void siggen_start(const siggen_config_t *new_config, uint32_t sample_rate) {
+    if(!quarter_sine[QUARTER_SIZE]) {
+        for(auto i = 0u; i <= QUARTER_SIZE; i++) {
+            quarter_sine[i] = (int16_t)lrintf(sinf((float)M_PI_2 * i / QUARTER_SIZE) * 32767.0f);
+        }
+    }
+
+    config = *new_config;
+    rate = sample_rate;
+
+    int8_t level = config.level_db > 0 ? 0 : config.level_db;
+    gain = (int32_t)lrintf(32768.0f * powf(10.0f, level / 20.0f));
+
+    frames_left = config.duration_ms ? config.duration_ms * (rate / 1000) : UINT32_MAX;
+    phase = 0;
+    phase_inc = phase_increment(config.freq);
+
+    sweep_ratio = 1u << 30;
+    if(config.type == SIGGEN_SWEEP && config.duration_ms && config.freq) {
+        // In double, a float ratio is only good to 1e-7, which adds up to a
+        // percent over a long sweep. It's worked out once, so the soft float
+        // doesn't matter.
+        double ratio = pow((double)config.freq_end / config.freq, 1.0 / frames_left);
+        sweep_ratio = (uint32_t)lrint(ratio * (1u << 30));
+    }
+
+    impulse_period = config.freq ? rate / config.freq : rate;
+    impulse_count = 0;
+
+    pink_counter = 0;
+    pink_sum = 0;
+    memset(pink_rows, 0, sizeof(pink_rows));
+}
+
+void siggen_stop() {
+    config.type = SIGGEN_OFF;
+}
+
+bool siggen_active() {
+    return config.type != SIGGEN_OFF;
+}
+
+bool siggen_fill(int16_t *out, size_t frames) {
+    if(config.type == SIGGEN_OFF) return false;
+
+    for(auto i = 0u; i < frames; i++) {
+        int32_t value = 0;
+
+        if(frames_left) {
+            frames_left--;
+            switch(config.type) {
+                case SIGGEN_SINE:
+                    value = sine(phase);
+                    phase += phase_inc;
+                    break;
+                case SIGGEN_SWEEP:
+                    value = sine(phase);
+                    phase += phase_inc;
+                    phase_inc = (uint32_t)(((uint64_t)phase_inc * sweep_ratio + (1u << 29)) >> 30);
+                    break;
+                case SIGGEN_PINK:
+                    value = pink();
+                    value = value > 32767 ? 32767 : (value < -32767 ? -32767 : value);
+                    break;
+                case SIGGEN_IMPULSE:
+                    value = impulse_count == 0 ? 32767 : 0;
+                    if(++impulse_count == impulse_period) impulse_count = 0;
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        // Rounded, so quiet signals don't pick up a DC offset
+        int16_t sample = (value * gain + (1 << 14)) >> 15;
+        out[i * 2 + 0] = sample;
+        out[i * 2 + 1] = sample;
+    }
+
+    if(!frames_left) config.type = SIGGEN_OFF;
+    return true;
+}
@@ -0,0 +1,29 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// Test signal generator. The generation itself has no SDK dependencies,
+// so the same code can produce reference signals on a host.
+
+enum siggen_type_t : uint8_t {
+    SIGGEN_OFF,
+    SIGGEN_SINE,        // freq
+    SIGGEN_PINK,
+    SIGGEN_SWEEP,       // Logarithmic, freq to freq_end over the duration
+    SIGGEN_IMPULSE,     // One full level sample every 1000 / freq ms
+};
+
+typedef struct {
+    siggen_type_t type;
+    int8_t level_db;        // dBFS, 0 or below
+    uint16_t freq;
+    uint16_t freq_end;
+    uint16_t duration_ms;   // 0 runs until stopped
+} siggen_config_t;
+
+void siggen_start(const siggen_config_t *config, uint32_t sample_rate);
+void siggen_stop();
+bool siggen_active();
+// Fill interleaved stereo, both channels the same. Returns false once finished.
+bool siggen_fill(int16_t *out, size_t frames);
+
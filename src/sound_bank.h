@@ -0,0 +1,1274 @@
+// Generated by generate-sound-bank.py, do not edit
+#pragma once
+#include "sounds.h"
+
+// 576 frames, 12ms
+static const uint8_t sound_tick_adpcm[288] = {
+    0x70, 0x77, 0x77, 0x27, 0x01, 0x80, 0xa9, 0xcc, 0xcc, 0xbb, 0xbc, 0xaa, 0x89, 0x30, 0x45, 0x44,
+    0x34, 0x24, 0x33, 0x12, 0x81, 0xb9, 0xcd, 0xcc, 0xcb, 0xab, 0xab, 0x8a, 0x08, 0x32, 0x45, 0x34,
+    0x43, 0x33, 0x23, 0x12, 0x88, 0xba, 0xbe, 0xcc, 0xbb, 0xac, 0xab, 0x99, 0x00, 0x31, 0x45, 0x43,
+    0x43, 0x32, 0x22, 0x12, 0x90, 0xba, 0xdc, 0xdb, 0xca, 0xaa, 0xaa, 0x99, 0x00, 0x31, 0x44, 0x34,
+    0x43, 0x33, 0x23, 0x12, 0x80, 0xca, 0xcc, 0xcb, 0xbc, 0xba, 0xab, 0x8a, 0x08, 0x32, 0x36, 0x44,
+    0x33, 0x33, 0x24, 0x11, 0x88, 0xaa, 0xbd, 0xbd, 0xcb, 0xbb, 0xba, 0x99, 0x08, 0x42, 0x34, 0x35,
+    0x34, 0x33, 0x23, 0x12, 0x90, 0xca, 0xcc, 0xdb, 0xbb, 0xbb, 0xab, 0x9a, 0x08, 0x42, 0x44, 0x34,
+    0x34, 0x33, 0x23, 0x12, 0x80, 0xca, 0xcc, 0xbc, 0xcb, 0xbb, 0xab, 0x9a, 0x00, 0x42, 0x63, 0x43,
+    0x33, 0x43, 0x22, 0x02, 0x80, 0xba, 0xdc, 0xcb, 0xcb, 0xba, 0xab, 0x99, 0x18, 0x41, 0x53, 0x53,
+    0x42, 0x22, 0x22, 0x11, 0x90, 0xb9, 0xcc, 0xbc, 0xbc, 0xba, 0xbb, 0x8a, 0x08, 0x42, 0x44, 0x43,
+    0x24, 0x33, 0x23, 0x12, 0x90, 0xba, 0xcd, 0xbc, 0xbc, 0xbb, 0xab, 0x9a, 0x18, 0x42, 0x44, 0x53,
+    0x42, 0x22, 0x22, 0x02, 0x80, 0xba, 0xcc, 0xbc, 0xbc, 0xbb, 0xab, 0x9a, 0x18, 0x42, 0x44, 0x53,
+    0x33, 0x33, 0x33, 0x12, 0x90, 0xca, 0xcc, 0xbc, 0xbc, 0xbb, 0xbb, 0x9a, 0x18, 0x42, 0x44, 0x34,
+    0x43, 0x33, 0x33, 0x11, 0x80, 0xca, 0xcc, 0xcb, 0xac, 0xbb, 0xab, 0x9a, 0x18, 0x32, 0x36, 0x44,
+    0x33, 0x43, 0x22, 0x02, 0x80, 0xba, 0xbd, 0xbd, 0xcb, 0xbb, 0xab, 0x9a, 0x18, 0x42, 0x63, 0x43,
+    0x33, 0x43, 0x22, 0x02, 0x80, 0xba, 0xbd, 0xbd, 0xbc, 0xbb, 0xba, 0x9a, 0x00, 0x42, 0x34, 0x26,
+    0x43, 0x32, 0x22, 0x12, 0x90, 0xb9, 0xcd, 0xcb, 0xac, 0xbb, 0xaa, 0x9a, 0x18, 0x32, 0x45, 0x53,
+    0x33, 0x33, 0x24, 0x11, 0x90, 0xba, 0xcc, 0xdb, 0xbb, 0xbc, 0xaa, 0x99, 0x08, 0x32, 0x54, 0x43,
+};
+
+// 7200 frames, 150ms
+static const uint8_t sound_mute_adpcm[3600] = {
+    0x70, 0x77, 0x77, 0x27, 0x23, 0x33, 0x24, 0x22, 0x02, 0x90, 0xdb, 0xdc, 0xdb, 0xdb, 0xcb, 0xbb,
+    0xbc, 0xac, 0xbb, 0xba, 0xa9, 0x88, 0x21, 0x54, 0x54, 0x43, 0x43, 0x43, 0x33, 0x33, 0x24, 0x23,
+    0x22, 0x02, 0x80, 0xa9, 0xcc, 0xcc, 0xcb, 0xbc, 0xbc, 0xcb, 0xbb, 0xbb, 0xac, 0xab, 0x9a, 0x89,
+    0x00, 0x32, 0x45, 0x34, 0x35, 0x34, 0x43, 0x43, 0x32, 0x33, 0x33, 0x23, 0x22, 0x00, 0xa9, 0xdb,
+    0xbd, 0xbd, 0xbc, 0xbc, 0xbc, 0xcb, 0xbb, 0xab, 0xbb, 0xab, 0x99, 0x18, 0x31, 0x45, 0x34, 0x35,
+    0x34, 0x34, 0x34, 0x33, 0x24, 0x23, 0x23, 0x12, 0x01, 0x98, 0xca, 0xcc, 0xdb, 0xdb, 0xca, 0xba,
+    0xac, 0xbb, 0xcb, 0xaa, 0xaa, 0x99, 0x08, 0x20, 0x43, 0x44, 0x44, 0x33, 0x44, 0x33, 0x43, 0x33,
+    0x33, 0x33, 0x22, 0x02, 0x90, 0xc9, 0xcc, 0xdb, 0xbc, 0xbc, 0xbc, 0xcb, 0xbb, 0xbb, 0xcb, 0xaa,
+    0x9a, 0x88, 0x10, 0x42, 0x44, 0x53, 0x43, 0x43, 0x43, 0x33, 0x33, 0x34, 0x32, 0x22, 0x11, 0x00,
+    0xa9, 0xcc, 0xbc, 0xbd, 0xcc, 0xbb, 0xbc, 0xcb, 0xba, 0xbb, 0xab, 0xaa, 0x99, 0x00, 0x42, 0x44,
+    0x53, 0x34, 0x43, 0x34, 0x33, 0x34, 0x33, 0x33, 0x23, 0x13, 0x01, 0xa9, 0xdb, 0xcc, 0xcc, 0xcb,
+    0xbb, 0xad, 0xcb, 0xba, 0xba, 0xab, 0xab, 0x99, 0x08, 0x31, 0x44, 0x44, 0x34, 0x34, 0x34, 0x34,
+    0x33, 0x43, 0x23, 0x23, 0x22, 0x01, 0x98, 0xba, 0xcd, 0xcc, 0xcb, 0xbc, 0xcb, 0xbb, 0xac, 0xbb,
+    0xbb, 0xaa, 0xaa, 0x88, 0x21, 0x53, 0x44, 0x34, 0x35, 0x43, 0x43, 0x32, 0x24, 0x23, 0x23, 0x22,
+    0x01, 0x80, 0xa9, 0xbd, 0xbd, 0xbd, 0xbc, 0xdb, 0xba, 0xac, 0xbb, 0xba, 0xab, 0x9a, 0x89, 0x10,
+    0x42, 0x44, 0x44, 0x43, 0x43, 0x43, 0x42, 0x32, 0x32, 0x32, 0x32, 0x11, 0x00, 0xa9, 0xdb, 0xcc,
+    0xbc, 0xcc, 0xca, 0xbb, 0xbb, 0xbc, 0xbb, 0xba, 0x9b, 0x8a, 0x08, 0x32, 0x45, 0x44, 0x53, 0x33,
+    0x34, 0x24, 0x43, 0x32, 0x32, 0x22, 0x12, 0x01, 0x98, 0xcb, 0xcc, 0xbc, 0xcc, 0xcb, 0xbb, 0xbc,
+    0xbb, 0xac, 0xab, 0xaa, 0x99, 0x88, 0x21, 0x34, 0x45, 0x34, 0x34, 0x34, 0x34, 0x33, 0x43, 0x23,
+    0x33, 0x12, 0x11, 0x88, 0xba, 0xbe, 0xcc, 0xbc, 0xbc, 0xbc, 0xcb, 0xbb, 0xbb, 0xac, 0xaa, 0x9a,
+    0x88, 0x20, 0x42, 0x44, 0x34, 0x44, 0x33, 0x34, 0x34, 0x33, 0x33, 0x33, 0x23, 0x12, 0x80, 0xb9,
+    0xcd, 0xcc, 0xdb, 0xbb, 0xcc, 0xba, 0xac, 0xbb, 0xba, 0xab, 0x9b, 0x89, 0x18, 0x42, 0x44, 0x34,
+    0x35, 0x34, 0x43, 0x43, 0x23, 0x33, 0x24, 0x12, 0x12, 0x80, 0x98, 0xcb, 0xcc, 0xdb, 0xcb, 0xcb,
+    0xbb, 0xbc, 0xbb, 0xcb, 0xaa, 0xaa, 0x99, 0x18, 0x21, 0x44, 0x44, 0x43, 0x34, 0x43, 0x43, 0x23,
+    0x24, 0x32, 0x22, 0x21, 0x00, 0x90, 0xca, 0xdb, 0xbc, 0xbd, 0xcb, 0xcb, 0xcb, 0xba, 0xab, 0xbb,
+    0xab, 0xa9, 0x08, 0x20, 0x44, 0x44, 0x53, 0x33, 0x35, 0x33, 0x34, 0x43, 0x32, 0x32, 0x21, 0x11,
+    0x88, 0xb9, 0xdc, 0xdb, 0xcb, 0xcb, 0xac, 0xcb, 0xba, 0xbb, 0xbb, 0xbb, 0x9a, 0x89, 0x10, 0x53,
+    0x44, 0x53, 0x43, 0x24, 0x24, 0x33, 0x24, 0x23, 0x33, 0x22, 0x11, 0x00, 0xb9, 0xeb, 0xdb, 0xdb,
+    0xbb, 0xbc, 0xbc, 0xac, 0xbb, 0xab, 0xbb, 0xaa, 0x89, 0x18, 0x32, 0x55, 0x43, 0x44, 0x33, 0x34,
+    0x34, 0x33, 0x43, 0x32, 0x22, 0x12, 0x00, 0xa8, 0xda, 0xdb, 0xdb, 0xcb, 0xcb, 0xbb, 0xbc, 0xbb,
+    0xac, 0xab, 0xaa, 0x99, 0x08, 0x31, 0x63, 0x53, 0x43, 0x34, 0x43, 0x43, 0x33, 0x33, 0x43, 0x22,
+    0x12, 0x01, 0x90, 0xba, 0xbd, 0xbe, 0xbc, 0xbc, 0xbc, 0xcb, 0xbb, 0xbb, 0xac, 0xaa, 0x99, 0x09,
+    0x20, 0x52, 0x53, 0x53, 0x33, 0x35, 0x33, 0x34, 0x24, 0x23, 0x23, 0x22, 0x11, 0x90, 0xb9, 0xcc,
+    0xcc, 0xbc, 0xdb, 0xbb, 0xbc, 0xcb, 0xab, 0xbb, 0xba, 0x9a, 0x99, 0x10, 0x43, 0x44, 0x44, 0x43,
+    0x43, 0x43, 0x33, 0x43, 0x23, 0x33, 0x22, 0x12, 0x80, 0xa8, 0xcc, 0xdb, 0xbc, 0xcc, 0xbb, 0xbc,
+    0xcb, 0xbb, 0xba, 0xbb, 0xaa, 0x9a, 0x00, 0x32, 0x36, 0x35, 0x44, 0x43, 0x43, 0x33, 0x43, 0x33,
+    0x23, 0x33, 0x12, 0x01, 0xa8, 0xda, 0xbc, 0xcd, 0xcb, 0xcb, 0xbb, 0xbc, 0xbb, 0xac, 0xab, 0xaa,
+    0x9a, 0x08, 0x21, 0x34, 0x36, 0x44, 0x33, 0x35, 0x33, 0x34, 0x24, 0x23, 0x32, 0x21, 0x01, 0x90,
+    0xb9, 0xcd, 0xdb, 0xcb, 0xbc, 0xcb, 0xbb, 0xbc, 0xab, 0xbb, 0xbb, 0x9a, 0x89, 0x11, 0x53, 0x44,
+    0x34, 0x35, 0x43, 0x43, 0x33, 0x43, 0x32, 0x32, 0x22, 0x11, 0x80, 0xa9, 0xcc, 0xcc, 0xdb, 0xbb,
+    0xcc, 0xbb, 0xbb, 0xbc, 0xbb, 0xba, 0xaa, 0x89, 0x10, 0x32, 0x46, 0x53, 0x43, 0x43, 0x43, 0x33,
+    0x43, 0x33, 0x32, 0x32, 0x21, 0x00, 0x99, 0xbc, 0xcd, 0xbc, 0xcc, 0xbb, 0xbc, 0xcb, 0xbb, 0xca,
+    0xaa, 0xa9, 0x89, 0x08, 0x21, 0x63, 0x43, 0x34, 0x44, 0x42, 0x32, 0x43, 0x32, 0x23, 0x23, 0x12,
+    0x01, 0x90, 0xcb, 0xcc, 0xbc, 0xcc, 0xcb, 0xbb, 0xbc, 0xcb, 0xba, 0xab, 0xaa, 0x9a, 0x88, 0x21,
+    0x53, 0x44, 0x34, 0x34, 0x34, 0x34, 0x33, 0x34, 0x32, 0x33, 0x22, 0x11, 0x88, 0xba, 0xcd, 0xbc,
+    0xbd, 0xbc, 0xbc, 0xac, 0xcb, 0xaa, 0xab, 0xab, 0xa9, 0x88, 0x10, 0x42, 0x44, 0x34, 0x44, 0x33,
+    0x44, 0x32, 0x33, 0x24, 0x23, 0x22, 0x11, 0x80, 0xa9, 0xdb, 0xcc, 0xdb, 0xbb, 0xcc, 0xbb, 0xbb,
+    0xbc, 0xbb, 0xbb, 0xaa, 0x89, 0x18, 0x42, 0x44, 0x34, 0x35, 0x53, 0x33, 0x34, 0x33, 0x43, 0x32,
+    0x22, 0x12, 0x01, 0x99, 0xcb, 0xbd, 0xbd, 0xbc, 0xad, 0xcb, 0xbb, 0xbb, 0xac, 0xab, 0xaa, 0x99,
+    0x08, 0x31, 0x44, 0x34, 0x35, 0x44, 0x33, 0x43, 0x43, 0x23, 0x33, 0x22, 0x13, 0x01, 0x90, 0xca,
+    0xcc, 0xdb, 0xbc, 0xcb, 0xac, 0xac, 0xab, 0xbb, 0xbb, 0xab, 0xaa, 0x88, 0x21, 0x63, 0x53, 0x34,
+    0x34, 0x34, 0x34, 0x33, 0x34, 0x33, 0x32, 0x23, 0x11, 0x90, 0xb9, 0xcd, 0xbc, 0xbd, 0xbc, 0xbc,
+    0xcb, 0xcb, 0xaa, 0xbb, 0xaa, 0x9a, 0x89, 0x00, 0x33, 0x36, 0x35, 0x44, 0x33, 0x25, 0x33, 0x34,
+    0x32, 0x23, 0x23, 0x12, 0x00, 0xa9, 0xcc, 0xbc, 0xbd, 0xbd, 0xcb, 0xbb, 0xbc, 0xcb, 0xaa, 0xab,
+    0x9a, 0x99, 0x18, 0x31, 0x44, 0x44, 0x34, 0x53, 0x33, 0x34, 0x33, 0x24, 0x23, 0x23, 0x12, 0x01,
+    0x98, 0xcb, 0xdc, 0xcb, 0xdb, 0xbb, 0xbc, 0xcb, 0xbb, 0xcb, 0xaa, 0xaa, 0x99, 0x08, 0x21, 0x53,
+    0x34, 0x35, 0x44, 0x33, 0x43, 0x24, 0x23, 0x33, 0x23, 0x13, 0x02, 0x90, 0xca, 0xbc, 0xbe, 0xbc,
+    0xbc, 0xbc, 0xac, 0xcb, 0xaa, 0xab, 0xaa, 0x9a, 0x89, 0x11, 0x43, 0x44, 0x34, 0x35, 0x43, 0x43,
+    0x33, 0x24, 0x23, 0x33, 0x22, 0x11, 0x80, 0xb9, 0xcc, 0xcc, 0xbc, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc,
+    0xba, 0xaa, 0xaa, 0x89, 0x18, 0x42, 0x44, 0x53, 0x43, 0x43, 0x24, 0x43, 0x32, 0x32, 0x33, 0x23,
+    0x12, 0x81, 0x99, 0xcc, 0xdb, 0xbc, 0xbd, 0xcb, 0xbb, 0xbc, 0xcb, 0xba, 0xba, 0x9a, 0x8a, 0x08,
+    0x31, 0x44, 0x44, 0x53, 0x33, 0x44, 0x32, 0x43, 0x23, 0x33, 0x22, 0x13, 0x01, 0x98, 0xca, 0xbd,
+    0xcc, 0xbc, 0xdb, 0xbb, 0xcb, 0xbb, 0xcb, 0xaa, 0xaa, 0x9a, 0x08, 0x20, 0x53, 0x44, 0x43, 0x53,
+    0x33, 0x34, 0x33, 0x34, 0x33, 0x23, 0x23, 0x11, 0x88, 0xba, 0xbe, 0xbd, 0xbd, 0xcb, 0xbc, 0xbb,
+    0xbc, 0xbb, 0xbb, 0xbb, 0x9b, 0x99, 0x11, 0x34, 0x36, 0x44, 0x53, 0x33, 0x53, 0x32, 0x43, 0x32,
+    0x32, 0x22, 0x11, 0x80, 0xa9, 0xeb, 0xdb, 0xcb, 0xcb, 0xbc, 0xbb, 0xbc, 0xcb, 0xaa, 0xab, 0x9a,
+    0x99, 0x00, 0x32, 0x45, 0x53, 0x43, 0x53, 0x32, 0x24, 0x33, 0x24, 0x32, 0x22, 0x21, 0x00, 0x99,
+    0xcb, 0xcc, 0xbc, 0xcc, 0xbb, 0xbc, 0xac, 0xbb, 0xac, 0xba, 0xa9, 0x99, 0x08, 0x21, 0x34, 0x36,
+    0x34, 0x44, 0x33, 0x34, 0x33, 0x34, 0x33, 0x32, 0x22, 0x01, 0x90, 0xca, 0xcc, 0xbc, 0xbd, 0xbc,
+    0xcb, 0xac, 0xbb, 0xbb, 0xbb, 0xab, 0xaa, 0x09, 0x30, 0x63, 0x34, 0x35, 0x44, 0x33, 0x34, 0x43,
+    0x32, 0x43, 0x22, 0x21, 0x11, 0x88, 0xb9, 0xdb, 0xcc, 0xcb, 0xbc, 0xcb, 0xcb, 0xbb, 0xbb, 0xcb,
+    0xaa, 0x9a, 0x89, 0x10, 0x41, 0x34, 0x45, 0x33, 0x35, 0x43, 0x33, 0x34, 0x32, 0x33, 0x23, 0x12,
+    0x81, 0xa9, 0xcc, 0xcc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbb, 0xac, 0xbb, 0xbb, 0xaa, 0x99, 0x18, 0x32,
+    0x45, 0x34, 0x35, 0x34, 0x34, 0x24, 0x33, 0x24, 0x23, 0x32, 0x21, 0x01, 0xa8, 0xca, 0xcc, 0xbc,
+    0xcc, 0xbb, 0xbc, 0xbc, 0xbb, 0xac, 0xba, 0x9a, 0x9a, 0x08, 0x30, 0x53, 0x34, 0x36, 0x43, 0x43,
+    0x33, 0x34, 0x33, 0x24, 0x32, 0x21, 0x11, 0x98, 0xb9, 0xbd, 0xcd, 0xcb, 0xcb, 0xcb, 0xbb, 0xcb,
+    0xbb, 0xbb, 0xba, 0x9a, 0x89, 0x20, 0x53, 0x44, 0x53, 0x43, 0x43, 0x43, 0x32, 0x24, 0x23, 0x23,
+    0x22, 0x11, 0x80, 0xb9, 0xeb, 0xdb, 0xdb, 0xbb, 0xbc, 0xbc, 0xbb, 0xbc, 0xba, 0xbb, 0xaa, 0x89,
+    0x10, 0x42, 0x63, 0x53, 0x43, 0x43, 0x33, 0x34, 0x43, 0x32, 0x33, 0x32, 0x11, 0x01, 0xa9, 0xcb,
+    0xcd, 0xdb, 0xcb, 0xcb, 0xbb, 0xdb, 0xba, 0xba, 0xab, 0x9b, 0xa9, 0x00, 0x31, 0x35, 0x35, 0x35,
+    0x34, 0x34, 0x34, 0x33, 0x43, 0x33, 0x22, 0x12, 0x02, 0x98, 0xbb, 0xbf, 0xdb, 0xdb, 0xbb, 0xdb,
+    0xba, 0xcb, 0xab, 0xab, 0xaa, 0x9a, 0x88, 0x21, 0x53, 0x44, 0x43, 0x34, 0x34, 0x34, 0x33, 0x34,
+    0x32, 0x33, 0x22, 0x11, 0x90, 0xba, 0xbe, 0xbc, 0xbd, 0xbc, 0xbc, 0xcb, 0xbb, 0xcb, 0xba, 0xaa,
+    0x9a, 0x09, 0x10, 0x42, 0x34, 0x36, 0x53, 0x33, 0x34, 0x34, 0x33, 0x33, 0x24, 0x22, 0x11, 0x00,
+    0x9a, 0xbc, 0xcd, 0xcb, 0xbc, 0xdb, 0xba, 0xac, 0xbb, 0xbb, 0xab, 0xba, 0x99, 0x10, 0x33, 0x36,
+    0x43, 0x34, 0x34, 0x34, 0x34, 0x33, 0x43, 0x23, 0x22, 0x12, 0x01, 0x99, 0xdb, 0xcb, 0xdb, 0xbb,
+    0xbd, 0xcb, 0xbb, 0xbc, 0xba, 0xab, 0xab, 0x99, 0x18, 0x31, 0x35, 0x43, 0x34, 0x35, 0x43, 0x43,
+    0x33, 0x33, 0x43, 0x22, 0x22, 0x01, 0x98, 0xbb, 0xbd, 0xbc, 0xbc, 0xbd, 0xcb, 0xbb, 0xcb, 0xbb,
+    0xbb, 0xab, 0x9a, 0x99, 0x31, 0x33, 0x36, 0x42, 0x53, 0x23, 0x34, 0x33, 0x34, 0x32, 0x33, 0x23,
+    0x11, 0x91, 0xb9, 0xbc, 0xdb, 0xbc, 0xbc, 0xbc, 0xcb, 0xbb, 0xcb, 0xba, 0xba, 0x9a, 0x09, 0x11,
+    0x77, 0x77, 0x27, 0x43, 0x34, 0x34, 0x34, 0x34, 0x33, 0x34, 0x32, 0x23, 0x12, 0x80, 0xb9, 0xcd,
+    0xcd, 0xdb, 0xcb, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbb, 0xbb, 0xbb, 0xbb, 0xab, 0xaa, 0x89, 0x10,
+    0x52, 0x53, 0x44, 0x43, 0x34, 0x34, 0x34, 0x34, 0x43, 0x43, 0x32, 0x24, 0x33, 0x33, 0x33, 0x24,
+    0x22, 0x22, 0x11, 0x88, 0xa8, 0xbc, 0xcd, 0xbc, 0xbc, 0xbd, 0xcb, 0xcb, 0xcb, 0xbb, 0xbc, 0xbb,
+    0xbc, 0xbb, 0xcb, 0xba, 0xaa, 0xaa, 0x9a, 0x88, 0x10, 0x42, 0x63, 0x43, 0x44, 0x33, 0x35, 0x43,
+    0x43, 0x33, 0x34, 0x24, 0x43, 0x32, 0x32, 0x33, 0x32, 0x33, 0x12, 0x02, 0x80, 0xaa, 0xcd, 0xdb,
+    0xbc, 0xcc, 0xcb, 0xbb, 0xbd, 0xbb, 0xcc, 0xba, 0xcb, 0xba, 0xbb, 0xac, 0xba, 0xaa, 0xaa, 0x9a,
+    0x88, 0x11, 0x42, 0x44, 0x44, 0x43, 0x43, 0x34, 0x43, 0x43, 0x43, 0x33, 0x43, 0x42, 0x32, 0x32,
+    0x23, 0x33, 0x23, 0x22, 0x01, 0x88, 0xba, 0xdc, 0xcc, 0xcb, 0xbc, 0xcc, 0xca, 0xbb, 0xcb, 0xcb,
+    0xbb, 0xac, 0xbb, 0xac, 0xab, 0xbb, 0xba, 0xaa, 0x99, 0x88, 0x11, 0x34, 0x45, 0x53, 0x43, 0x34,
+    0x43, 0x34, 0x43, 0x33, 0x34, 0x24, 0x33, 0x43, 0x23, 0x33, 0x32, 0x32, 0x12, 0x01, 0x90, 0xca,
+    0xdb, 0xcc, 0xbc, 0xbc, 0xbc, 0xcc, 0xca, 0xba, 0xcb, 0xbb, 0xac, 0xbb, 0xac, 0xab, 0xab, 0xab,
+    0xaa, 0x99, 0x08, 0x21, 0x53, 0x44, 0x34, 0x44, 0x43, 0x43, 0x43, 0x33, 0x34, 0x43, 0x33, 0x34,
+    0x33, 0x33, 0x43, 0x22, 0x13, 0x12, 0x01, 0x98, 0xba, 0xcd, 0xbc, 0xbd, 0xbc, 0xcc, 0xbb, 0xbc,
+    0xbc, 0xbb, 0xcc, 0xba, 0xbb, 0xbb, 0xcb, 0xba, 0xba, 0xa9, 0x99, 0x08, 0x21, 0x44, 0x34, 0x35,
+    0x35, 0x53, 0x33, 0x34, 0x34, 0x24, 0x24, 0x33, 0x33, 0x24, 0x33, 0x33, 0x33, 0x22, 0x12, 0x01,
+    0x98, 0xdb, 0xeb, 0xcb, 0xbc, 0xbc, 0xcc, 0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xcb, 0xbb, 0xbb, 0xcb,
+    0xba, 0xaa, 0x9a, 0x99, 0x00, 0x21, 0x44, 0x44, 0x53, 0x43, 0x43, 0x43, 0x43, 0x43, 0x42, 0x32,
+    0x33, 0x43, 0x33, 0x33, 0x33, 0x24, 0x12, 0x02, 0x81, 0x98, 0xca, 0xcc, 0xbc, 0xcc, 0xcb, 0xcb,
+    0xac, 0xac, 0xbb, 0xbc, 0xcb, 0xba, 0xac, 0xba, 0xab, 0xbb, 0xaa, 0xaa, 0x89, 0x18, 0x31, 0x45,
+    0x34, 0x35, 0x34, 0x35, 0x43, 0x43, 0x33, 0x34, 0x24, 0x43, 0x32, 0x23, 0x24, 0x22, 0x22, 0x22,
+    0x11, 0x80, 0xa8, 0xca, 0xcc, 0xbc, 0xbd, 0xbc, 0xbc, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xbb, 0xcb,
+    0xab, 0xbb, 0xbb, 0xab, 0xaa, 0x89, 0x00, 0x33, 0x36, 0x45, 0x43, 0x34, 0x34, 0x34, 0x34, 0x43,
+    0x43, 0x32, 0x24, 0x33, 0x33, 0x24, 0x23, 0x22, 0x22, 0x11, 0x80, 0xa8, 0xbc, 0xcd, 0xdb, 0xcb,
+    0xcb, 0xbc, 0xcb, 0xcb, 0xbb, 0xdb, 0xba, 0xbb, 0xac, 0xbb, 0xab, 0xbb, 0xba, 0x9a, 0x89, 0x10,
+    0x33, 0x46, 0x53, 0x34, 0x53, 0x43, 0x33, 0x44, 0x33, 0x43, 0x33, 0x34, 0x33, 0x43, 0x32, 0x23,
+    0x23, 0x22, 0x11, 0x80, 0xa9, 0xcc, 0xcc, 0xbc, 0xcc, 0xbb, 0xbd, 0xcb, 0xcb, 0xbb, 0xbc, 0xbb,
+    0xbc, 0xbb, 0xcb, 0xba, 0xaa, 0xab, 0x99, 0x09, 0x10, 0x42, 0x44, 0x34, 0x35, 0x34, 0x34, 0x34,
+    0x34, 0x43, 0x43, 0x33, 0x33, 0x34, 0x33, 0x33, 0x24, 0x22, 0x12, 0x01, 0x80, 0xa9, 0xcc, 0xbc,
+    0xbd, 0xbd, 0xcb, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xbb, 0xbc, 0xbb, 0xbb, 0xac, 0xab, 0xaa, 0x99,
+    0x88, 0x20, 0x42, 0x44, 0x44, 0x43, 0x53, 0x33, 0x34, 0x34, 0x43, 0x43, 0x23, 0x24, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x22, 0x11, 0x88, 0xbb, 0xdd, 0xdb, 0xbc, 0xdb, 0xcb, 0xcb, 0xcb, 0xbb, 0xdb,
+    0xba, 0xcb, 0xba, 0xbb, 0xac, 0xba, 0xaa, 0xaa, 0x99, 0x08, 0x20, 0x43, 0x44, 0x44, 0x43, 0x34,
+    0x53, 0x33, 0x34, 0x43, 0x43, 0x32, 0x24, 0x33, 0x32, 0x24, 0x22, 0x22, 0x21, 0x00, 0x90, 0xaa,
+    0xbd, 0xbd, 0xbd, 0xbc, 0xcc, 0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xcb, 0xbb, 0xcb, 0xba, 0xba, 0xba,
+    0xaa, 0x99, 0x08, 0x21, 0x34, 0x36, 0x44, 0x43, 0x34, 0x34, 0x53, 0x42, 0x32, 0x33, 0x34, 0x43,
+    0x32, 0x33, 0x33, 0x33, 0x23, 0x12, 0x01, 0xa0, 0xca, 0xbd, 0xcd, 0xcb, 0xbc, 0xdb, 0xbb, 0xbc,
+    0xbc, 0xcb, 0xbb, 0xcb, 0xbb, 0xcb, 0xba, 0xba, 0xaa, 0xaa, 0x99, 0x08, 0x22, 0x63, 0x53, 0x53,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x33, 0x43, 0x33, 0x24, 0x33, 0x24, 0x32, 0x22, 0x22, 0x21, 0x00,
+    0xa8, 0xba, 0xbe, 0xbd, 0xcc, 0xcb, 0xcb, 0xac, 0xac, 0xcb, 0xba, 0xcb, 0xbb, 0xbb, 0xbc, 0xba,
+    0xab, 0xab, 0x9b, 0x99, 0x18, 0x31, 0x54, 0x34, 0x35, 0x34, 0x35, 0x43, 0x43, 0x33, 0x34, 0x34,
+    0x33, 0x43, 0x33, 0x33, 0x43, 0x22, 0x22, 0x11, 0x00, 0x99, 0xca, 0xcc, 0xbc, 0xbd, 0xdb, 0xcb,
+    0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xcb, 0xbb, 0xbb, 0xac, 0xab, 0xaa, 0x9a, 0x89, 0x18, 0x31, 0x35,
+    0x45, 0x43, 0x34, 0x34, 0x34, 0x34, 0x43, 0x43, 0x42, 0x32, 0x32, 0x24, 0x32, 0x32, 0x32, 0x12,
+    0x12, 0x80, 0xa8, 0xdb, 0xbc, 0xcd, 0xcb, 0xcb, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xbb, 0xbc, 0xcb,
+    0xba, 0xba, 0xba, 0xba, 0xa9, 0x89, 0x10, 0x32, 0x45, 0x44, 0x43, 0x34, 0x34, 0x34, 0x34, 0x34,
+    0x33, 0x34, 0x43, 0x33, 0x33, 0x43, 0x32, 0x22, 0x22, 0x11, 0x80, 0xa9, 0xbc, 0xcd, 0xdb, 0xcb,
+    0xbc, 0xcb, 0xac, 0xac, 0xcb, 0xba, 0xac, 0xbb, 0xbb, 0xac, 0xab, 0xab, 0xab, 0x99, 0x89, 0x10,
+    0x42, 0x44, 0x53, 0x34, 0x53, 0x43, 0x43, 0x33, 0x34, 0x34, 0x33, 0x24, 0x24, 0x32, 0x23, 0x33,
+    0x22, 0x13, 0x02, 0x80, 0xb9, 0xcc, 0xcc, 0xbc, 0xcc, 0xcb, 0xcb, 0xbb, 0xcc, 0xba, 0xac, 0xbb,
+    0xac, 0xbb, 0xbb, 0xbb, 0xac, 0x9a, 0x8a, 0x89, 0x11, 0x32, 0x45, 0x44, 0x43, 0x43, 0x34, 0x53,
+    0x42, 0x32, 0x43, 0x32, 0x24, 0x33, 0x33, 0x43, 0x22, 0x13, 0x22, 0x01, 0x90, 0xb9, 0xeb, 0xdb,
+    0xdb, 0xcb, 0xcb, 0xcb, 0xbb, 0xcc, 0xba, 0xac, 0xbb, 0xac, 0xbb, 0xbb, 0xbb, 0xbb, 0xba, 0xa9,
+    0x88, 0x21, 0x53, 0x35, 0x35, 0x44, 0x43, 0x43, 0x43, 0x33, 0x34, 0x34, 0x33, 0x24, 0x24, 0x32,
+    0x32, 0x32, 0x22, 0x22, 0x10, 0x98, 0xb9, 0xcd, 0xdb, 0xbc, 0xbc, 0xcc, 0xbb, 0xbc, 0xbc, 0xcb,
+    0xbb, 0xcb, 0xbb, 0xac, 0xbb, 0xba, 0xab, 0xaa, 0x99, 0x09, 0x21, 0x53, 0x44, 0x34, 0x44, 0x43,
+    0x43, 0x43, 0x43, 0x33, 0x43, 0x33, 0x34, 0x33, 0x43, 0x32, 0x32, 0x22, 0x21, 0x10, 0x98, 0xba,
+    0xcd, 0xbc, 0xbd, 0xcc, 0xbb, 0xcc, 0xca, 0xba, 0xbc, 0xca, 0xba, 0xbb, 0xcb, 0xba, 0xab, 0xab,
+    0xaa, 0x99, 0x08, 0x21, 0x44, 0x63, 0x43, 0x43, 0x34, 0x34, 0x34, 0x43, 0x43, 0x33, 0x43, 0x33,
+    0x33, 0x34, 0x32, 0x33, 0x22, 0x12, 0x01, 0xa8, 0xca, 0xcc, 0xcc, 0xcb, 0xbc, 0xbc, 0xbc, 0xcb,
+    0xac, 0xcb, 0xba, 0xcb, 0xab, 0xbb, 0xcb, 0xaa, 0xaa, 0x9a, 0x8a, 0x08, 0x31, 0x53, 0x44, 0x53,
+    0x43, 0x43, 0x34, 0x43, 0x33, 0x34, 0x34, 0x33, 0x43, 0x33, 0x24, 0x32, 0x22, 0x22, 0x21, 0x00,
+    0x99, 0xca, 0xcc, 0xdb, 0xbc, 0xdb, 0xbb, 0xbd, 0xbb, 0xad, 0xcb, 0xba, 0xac, 0xab, 0xbb, 0xcb,
+    0xaa, 0xaa, 0x9a, 0x89, 0x00, 0x21, 0x44, 0x34, 0x35, 0x44, 0x33, 0x35, 0x43, 0x33, 0x34, 0x34,
+    0x33, 0x24, 0x33, 0x43, 0x22, 0x23, 0x12, 0x12, 0x80, 0xa8, 0xca, 0xcc, 0xcc, 0xcb, 0xcb, 0xdb,
+    0xca, 0xba, 0xac, 0xcb, 0xba, 0xcb, 0xba, 0xbb, 0xbb, 0xbb, 0xab, 0xaa, 0x99, 0x10, 0x32, 0x46,
+    0x53, 0x43, 0x34, 0x34, 0x34, 0x34, 0x34, 0x33, 0x34, 0x24, 0x33, 0x24, 0x32, 0x23, 0x32, 0x22,
+    0x11, 0x80, 0x99, 0xbc, 0xcd, 0xdb, 0xcb, 0xbc, 0xcb, 0xbc, 0xbb, 0xad, 0xcb, 0xba, 0xcb, 0xba,
+    0xbb, 0xbb, 0xab, 0xbb, 0x9a, 0x99, 0x10, 0x43, 0x44, 0x44, 0x53, 0x43, 0x33, 0x35, 0x43, 0x43,
+    0x33, 0x43, 0x33, 0x34, 0x32, 0x43, 0x22, 0x22, 0x12, 0x11, 0x80, 0xa9, 0xdb, 0xdb, 0xbc, 0xcc,
+    0xcb, 0xcb, 0xbb, 0xcc, 0xba, 0xbc, 0xca, 0xba, 0xbb, 0xbb, 0xbb, 0xcb, 0x9a, 0x9a, 0x09, 0x10,
+    0x32, 0x45, 0x34, 0x35, 0x34, 0x44, 0x33, 0x34, 0x43, 0x43, 0x33, 0x43, 0x33, 0x33, 0x33, 0x24,
+    0x23, 0x21, 0x11, 0x90, 0xa9, 0xcc, 0xbc, 0xcd, 0xbb, 0xbd, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb,
+    0xbb, 0xbb, 0xcb, 0xba, 0xba, 0xaa, 0xa9, 0x88, 0x20, 0x43, 0x44, 0x44, 0x43, 0x34, 0x53, 0x33,
+    0x34, 0x43, 0x24, 0x33, 0x43, 0x33, 0x33, 0x33, 0x24, 0x22, 0x12, 0x11, 0x88, 0xaa, 0xcc, 0xcc,
+    0xbc, 0xbc, 0xcc, 0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xbb, 0xcb, 0xab, 0xbb, 0xab, 0xba, 0x99,
+    0x09, 0x20, 0x63, 0x53, 0x43, 0x34, 0x44, 0x33, 0x44, 0x42, 0x32, 0x43, 0x33, 0x33, 0x34, 0x33,
+    0x24, 0x32, 0x12, 0x22, 0x10, 0x98, 0xb9, 0xbd, 0xcd, 0xcb, 0xbc, 0xdb, 0xbb, 0xcc, 0xba, 0xac,
+    0xcb, 0xba, 0xbb, 0xac, 0xbb, 0xba, 0xab, 0xab, 0x99, 0x08, 0x30, 0x53, 0x35, 0x44, 0x34, 0x53,
+    0x33, 0x25, 0x24, 0x33, 0x34, 0x33, 0x34, 0x33, 0x43, 0x32, 0x32, 0x22, 0x12, 0x01, 0x90, 0xbb,
+    0xcd, 0xcc, 0xcb, 0xbc, 0xbc, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xba, 0xbb, 0xac, 0xab, 0xaa,
+    0xaa, 0x99, 0x80, 0x31, 0x53, 0x44, 0x53, 0x43, 0x43, 0x34, 0x43, 0x33, 0x25, 0x33, 0x34, 0x42,
+    0x32, 0x32, 0x33, 0x32, 0x23, 0x12, 0x01, 0x99, 0xda, 0xdb, 0xbc, 0xbd, 0xbc, 0xbc, 0xbc, 0xbc,
+    0xcb, 0xbb, 0xbc, 0xcb, 0xba, 0xbb, 0xac, 0xba, 0xaa, 0x9a, 0x99, 0x00, 0x31, 0x63, 0x53, 0x43,
+    0x34, 0x34, 0x34, 0x34, 0x34, 0x33, 0x25, 0x33, 0x43, 0x23, 0x33, 0x33, 0x24, 0x21, 0x11, 0x01,
+    0x99, 0xca, 0xeb, 0xcb, 0xdb, 0xcb, 0xcb, 0xbb, 0xcc, 0xab, 0xbc, 0xbb, 0xcb, 0xbb, 0xac, 0xab,
+    0xbb, 0xaa, 0x9a, 0x8a, 0x00, 0x31, 0x35, 0x36, 0x34, 0x44, 0x43, 0x43, 0x33, 0x34, 0x34, 0x43,
+    0x33, 0x33, 0x34, 0x33, 0x32, 0x33, 0x23, 0x22, 0x80, 0xa9, 0xdb, 0xbd, 0xbd, 0xcc, 0xcb, 0xcb,
+    0xbb, 0xad, 0xcb, 0xbb, 0xcb, 0xbb, 0xcb, 0xba, 0xab, 0xbb, 0xab, 0xaa, 0x89, 0x00, 0x42, 0x44,
+    0x53, 0x34, 0x34, 0x34, 0x44, 0x33, 0x43, 0x43, 0x33, 0x24, 0x33, 0x24, 0x23, 0x33, 0x32, 0x22,
+    0x11, 0x00, 0xb9, 0xdb, 0xcc, 0xbc, 0xcc, 0xcb, 0xcb, 0xcb, 0xbb, 0xbc, 0xac, 0xcb, 0xba, 0xbb,
+    0xcb, 0xba, 0xaa, 0xab, 0xa9, 0x09, 0x18, 0x33, 0x45, 0x34, 0x35, 0x44, 0x33, 0x34, 0x34, 0x34,
+    0x43, 0x33, 0x43, 0x33, 0x43, 0x32, 0x23, 0x32, 0x22, 0x11, 0x80, 0xaa, 0xeb, 0xdb, 0xdb, 0xcb,
+    0xcb, 0xcb, 0xcb, 0xcb, 0xba, 0xbc, 0xbb, 0xcb, 0xbb, 0xcb, 0xba, 0xaa, 0xaa, 0x9a, 0x89, 0x11,
+    0x42, 0x63, 0x43, 0x34, 0x44, 0x33, 0x44, 0x33, 0x53, 0x32, 0x43, 0x33, 0x33, 0x34, 0x23, 0x33,
+    0x23, 0x23, 0x01, 0x80, 0xaa, 0xdc, 0xdb, 0xbc, 0xbc, 0xbd, 0xcb, 0xcb, 0xbb, 0xbc, 0xbc, 0xbb,
+    0xcb, 0xbb, 0xbb, 0xac, 0xba, 0xaa, 0x99, 0x09, 0x20, 0x33, 0x36, 0x35, 0x35, 0x34, 0x34, 0x34,
+    0x43, 0x24, 0x43, 0x32, 0x43, 0x32, 0x33, 0x33, 0x33, 0x33, 0x22, 0x02, 0x91, 0xbb, 0xdd, 0xdb,
+    0xdb, 0xbb, 0xcc, 0xbb, 0xad, 0xcb, 0xbb, 0xcb, 0xbb, 0xbc, 0xbb, 0xbb, 0xbb, 0xac, 0xaa, 0x99,
+    0x08, 0x20, 0x43, 0x44, 0x53, 0x34, 0x34, 0x34, 0x34, 0x34, 0x43, 0x33, 0x53, 0x32, 0x33, 0x33,
+    0x43, 0x23, 0x22, 0x12, 0x11, 0x98, 0xba, 0xdc, 0xdb, 0xdb, 0xcb, 0xbb, 0xbd, 0xcb, 0xcb, 0xbb,
+    0xcb, 0xbb, 0xac, 0xbb, 0xbb, 0xac, 0xab, 0x9a, 0x99, 0x08, 0x11, 0x53, 0x53, 0x34, 0x34, 0x35,
+    0x53, 0x33, 0x53, 0x32, 0x24, 0x33, 0x34, 0x32, 0x43, 0x32, 0x22, 0x23, 0x11, 0x01, 0x90, 0xbb,
+    0xcd, 0xdb, 0xbc, 0xbc, 0xcc, 0xca, 0xba, 0xbc, 0xcb, 0xba, 0xac, 0xbb, 0xcb, 0xba, 0xba, 0xba,
+    0xa9, 0x99, 0x08, 0x21, 0x44, 0x53, 0x44, 0x33, 0x35, 0x34, 0x43, 0x43, 0x33, 0x34, 0x43, 0x33,
+    0x33, 0x43, 0x33, 0x32, 0x22, 0x12, 0x01, 0x99, 0xcb, 0xbc, 0xcd, 0xcb, 0xdb, 0xbb, 0xcc, 0xca,
+    0xba, 0xcb, 0xbb, 0xbb, 0xad, 0xab, 0xbb, 0xab, 0xab, 0xaa, 0x99, 0x08, 0x33, 0x44, 0x53, 0x53,
+    0x43, 0x43, 0x43, 0x43, 0x33, 0x34, 0x43, 0x33, 0x24, 0x33, 0x43, 0x22, 0x23, 0x12, 0x12, 0x81,
+    0x98, 0xdb, 0xcb, 0xdb, 0xcb, 0xbc, 0xbc, 0xdb, 0xbb, 0xcb, 0xac, 0xbb, 0xcb, 0xbb, 0xbb, 0xac,
+    0xab, 0xaa, 0xaa, 0x89, 0x00, 0x31, 0x35, 0x34, 0x35, 0x34, 0x44, 0x33, 0x34, 0x34, 0x34, 0x33,
+    0x34, 0x33, 0x43, 0x33, 0x23, 0x33, 0x32, 0x21, 0x90, 0xb9, 0xcb, 0xdb, 0xcb, 0xbc, 0xcc, 0xbb,
+    0xad, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbb, 0xcb, 0xab, 0xab, 0xab, 0x9a, 0x99, 0x11, 0x33, 0x35,
+    0x53, 0x43, 0x34, 0x34, 0x34, 0x53, 0x33, 0x43, 0x43, 0x32, 0x43, 0x32, 0x33, 0x32, 0x23, 0x13,
+    0x12, 0x91, 0xb9, 0xcb, 0xcb, 0xbc, 0xbd, 0xdb, 0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xcb, 0xbb,
+    0xbb, 0xcb, 0xaa, 0xaa, 0x9a, 0x88, 0x10, 0x33, 0x34, 0x44, 0x43, 0x34, 0x53, 0x43, 0x33, 0x34,
+    0x34, 0x33, 0x34, 0x33, 0x43, 0x32, 0x23, 0x33, 0x12, 0x12, 0x00, 0xaa, 0xbb, 0xbd, 0xbc, 0xcc,
+    0xbb, 0xbd, 0xcb, 0xcb, 0xbb, 0xbc, 0xbb, 0xbc, 0xbb, 0xcb, 0xba, 0xba, 0xaa, 0x9a, 0x90, 0x11,
+    0x33, 0x34, 0x34, 0x44, 0x43, 0x34, 0x43, 0x43, 0x43, 0x32, 0x34, 0x33, 0x43, 0x23, 0x33, 0x33,
+    0x33, 0x22, 0x12, 0x91, 0xb9, 0xcb, 0xbb, 0xcd, 0xbb, 0xbd, 0xcb, 0xcb, 0xcb, 0xbb, 0xbc, 0xbb,
+    0xbc, 0xbb, 0xcb, 0xba, 0xba, 0xaa, 0x99, 0x99, 0x11, 0x33, 0x53, 0x33, 0x34, 0x35, 0x34, 0x43,
+    0x43, 0x43, 0x33, 0x33, 0x25, 0x33, 0x33, 0x33, 0x24, 0x22, 0x21, 0x11, 0x90, 0xb9, 0xbb, 0xbd,
+    0xcb, 0xcb, 0xbc, 0xdb, 0xbb, 0xcb, 0xcb, 0xbb, 0xcb, 0xbb, 0xac, 0xbb, 0xba, 0xab, 0xba, 0x9b,
+    0x09, 0x11, 0x33, 0x53, 0x33, 0x53, 0x33, 0x35, 0x34, 0x43, 0x33, 0x34, 0x43, 0x33, 0x43, 0x33,
+    0x32, 0x33, 0x33, 0x23, 0x11, 0x90, 0xb9, 0xbb, 0xbd, 0xca, 0xcb, 0xbb, 0xbd, 0xbc, 0xbb, 0xbd,
+    0xba, 0xbc, 0xba, 0xbc, 0xba, 0xab, 0xab, 0xbb, 0xa9, 0x00, 0x11, 0x33, 0x43, 0x33, 0x35, 0x34,
+    0x53, 0x33, 0x34, 0x34, 0x33, 0x34, 0x43, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 0x90, 0xaa,
+    0xbb, 0xdb, 0xbb, 0xdb, 0xbb, 0xbc, 0xbc, 0xbc, 0xcb, 0xcb, 0xba, 0xbb, 0xcb, 0xba, 0xab, 0xab,
+    0xab, 0x99, 0x09, 0x11, 0x33, 0x33, 0x35, 0x33, 0x34, 0x35, 0x33, 0x35, 0x43, 0x33, 0x43, 0x33,
+    0x33, 0x34, 0x32, 0x33, 0x33, 0x12, 0x11, 0x99, 0xb9, 0xbb, 0xdb, 0xba, 0xcb, 0xcb, 0xcb, 0xcb,
+    0xbb, 0xbc, 0xbb, 0xad, 0xbb, 0xbb, 0xbb, 0xcb, 0xaa, 0xa9, 0x99, 0x09, 0x21, 0x22, 0x33, 0x25,
+    0x33, 0x34, 0x53, 0x33, 0x34, 0x43, 0x33, 0x25, 0x33, 0x33, 0x33, 0x53, 0x12, 0x12, 0x11, 0x11,
+    0x99, 0xb9, 0xbb, 0xbb, 0xbd, 0xba, 0xbc, 0xbc, 0xac, 0xbc, 0xca, 0xba, 0xcb, 0xba, 0xbb, 0xbb,
+    0xac, 0xaa, 0x9a, 0x99, 0x19, 0x11, 0x23, 0x33, 0x34, 0x42, 0x43, 0x33, 0x25, 0x43, 0x33, 0x43,
+    0x33, 0x34, 0x33, 0x33, 0x24, 0x32, 0x22, 0x11, 0x01, 0x90, 0xaa, 0xba, 0xbb, 0xad, 0xbb, 0xcb,
+    0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbb, 0xbc, 0xba, 0xcb, 0x99, 0x9a, 0x99, 0x10, 0x11, 0x23,
+};
+
+// 7200 frames, 150ms
+static const uint8_t sound_unmute_adpcm[3600] = {
+    0x70, 0x77, 0x77, 0x24, 0x34, 0x43, 0x43, 0x24, 0x33, 0x43, 0x22, 0x22, 0x12, 0x80, 0xa9, 0xcd,
+    0xcc, 0xbc, 0xbd, 0xcc, 0xbb, 0xbd, 0xbb, 0xbd, 0xab, 0xbb, 0xbb, 0xbb, 0xab, 0xaa, 0x88, 0x28,
+    0x42, 0x35, 0x45, 0x43, 0x34, 0x53, 0x33, 0x34, 0x34, 0x33, 0x34, 0x34, 0x32, 0x24, 0x32, 0x32,
+    0x22, 0x22, 0x01, 0x80, 0xa9, 0xcc, 0xbc, 0xbd, 0xcc, 0xcb, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb,
+    0xcb, 0xba, 0xcb, 0xaa, 0xaa, 0xaa, 0x99, 0x88, 0x10, 0x32, 0x45, 0x34, 0x35, 0x34, 0x34, 0x34,
+    0x34, 0x24, 0x43, 0x33, 0x33, 0x34, 0x33, 0x33, 0x33, 0x33, 0x22, 0x11, 0x90, 0xba, 0xcd, 0xcc,
+    0xbc, 0xcc, 0xbb, 0xbd, 0xcb, 0xbb, 0xbc, 0xbc, 0xbb, 0xac, 0xbb, 0xcb, 0xaa, 0xba, 0xa9, 0x99,
+    0x09, 0x10, 0x43, 0x44, 0x53, 0x34, 0x53, 0x33, 0x44, 0x33, 0x53, 0x32, 0x43, 0x23, 0x24, 0x32,
+    0x23, 0x23, 0x23, 0x12, 0x01, 0x90, 0xb9, 0xcd, 0xdb, 0xbc, 0xbc, 0xcc, 0xbb, 0xbc, 0xbc, 0xcb,
+    0xbb, 0xbc, 0xbb, 0xcb, 0xba, 0xab, 0xab, 0xaa, 0x8a, 0x09, 0x11, 0x34, 0x45, 0x34, 0x44, 0x43,
+    0x43, 0x43, 0x33, 0x34, 0x43, 0x33, 0x34, 0x33, 0x33, 0x43, 0x32, 0x22, 0x11, 0x01, 0x90, 0xba,
+    0xbd, 0xcd, 0xbc, 0xdb, 0xcb, 0xcb, 0xbb, 0xbc, 0xbc, 0xbb, 0xbc, 0xbb, 0xac, 0xbb, 0xab, 0xab,
+    0x9b, 0x9a, 0x08, 0x21, 0x44, 0x44, 0x53, 0x43, 0x53, 0x42, 0x33, 0x43, 0x43, 0x33, 0x24, 0x24,
+    0x32, 0x32, 0x33, 0x23, 0x23, 0x12, 0x01, 0xa8, 0xca, 0xcc, 0xcc, 0xcb, 0xbc, 0xbc, 0xbc, 0xbc,
+    0xcb, 0xbb, 0xbc, 0xbb, 0xbc, 0xab, 0xac, 0xaa, 0xab, 0xa9, 0x89, 0x08, 0x21, 0x34, 0x45, 0x53,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x42, 0x32, 0x33, 0x43, 0x33, 0x33, 0x24, 0x22, 0x22, 0x11, 0x01,
+    0x99, 0xca, 0xeb, 0xcb, 0xbc, 0xbc, 0xcc, 0xbb, 0xbc, 0xcb, 0xac, 0xbb, 0xcb, 0xab, 0xac, 0xba,
+    0xaa, 0xaa, 0x9a, 0x99, 0x00, 0x31, 0x44, 0x34, 0x35, 0x35, 0x43, 0x34, 0x43, 0x43, 0x33, 0x34,
+    0x33, 0x34, 0x33, 0x33, 0x24, 0x32, 0x12, 0x12, 0x80, 0x98, 0xcb, 0xcc, 0xcc, 0xcb, 0xcb, 0xbc,
+    0xcb, 0xcb, 0xbb, 0xbc, 0xac, 0xbb, 0xcb, 0xba, 0xba, 0xbb, 0xaa, 0xaa, 0x89, 0x00, 0x32, 0x45,
+    0x34, 0x35, 0x35, 0x43, 0x43, 0x43, 0x43, 0x33, 0x43, 0x33, 0x43, 0x33, 0x33, 0x33, 0x33, 0x22,
+    0x12, 0x00, 0xb9, 0xeb, 0xbc, 0xbd, 0xbd, 0xbc, 0xdb, 0xbb, 0xbc, 0xbc, 0xbb, 0xbc, 0xac, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xab, 0xaa, 0x89, 0x00, 0x43, 0x54, 0x43, 0x44, 0x43, 0x43, 0x43, 0x43, 0x33,
+    0x34, 0x33, 0x34, 0x24, 0x23, 0x33, 0x33, 0x32, 0x22, 0x02, 0x00, 0xaa, 0xcc, 0xcc, 0xbc, 0xcc,
+    0xcb, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xcb, 0xbb, 0xbb, 0xcb, 0xaa, 0xaa, 0xa9, 0x88, 0x10,
+    0x32, 0x45, 0x34, 0x35, 0x34, 0x34, 0x34, 0x34, 0x24, 0x24, 0x33, 0x43, 0x32, 0x43, 0x22, 0x23,
+    0x22, 0x22, 0x01, 0x80, 0xb9, 0xdb, 0xcc, 0xbc, 0xcc, 0xbb, 0xbd, 0xcb, 0xbb, 0xad, 0xbb, 0xbc,
+    0xba, 0xac, 0xbb, 0xba, 0xba, 0xaa, 0x9a, 0x09, 0x10, 0x43, 0x54, 0x43, 0x34, 0x44, 0x43, 0x33,
+    0x34, 0x34, 0x43, 0x33, 0x43, 0x33, 0x33, 0x24, 0x23, 0x22, 0x22, 0x01, 0x88, 0xb9, 0xcc, 0xcc,
+    0xdb, 0xcb, 0xcb, 0xcb, 0xcb, 0xbb, 0xbc, 0xac, 0xcb, 0xba, 0xba, 0xbb, 0xac, 0xaa, 0x9a, 0x8a,
+    0x88, 0x20, 0x42, 0x44, 0x53, 0x43, 0x34, 0x34, 0x43, 0x24, 0x24, 0x33, 0x24, 0x33, 0x24, 0x33,
+    0x32, 0x33, 0x32, 0x12, 0x11, 0x98, 0xba, 0xcd, 0xcc, 0xdb, 0xbb, 0xbd, 0xdb, 0xca, 0xba, 0xcb,
+    0xbb, 0xcb, 0xbb, 0xcb, 0xba, 0xba, 0xba, 0x9a, 0x8a, 0x09, 0x21, 0x53, 0x34, 0x45, 0x43, 0x53,
+    0x42, 0x33, 0x43, 0x24, 0x43, 0x32, 0x33, 0x34, 0x32, 0x33, 0x33, 0x32, 0x21, 0x01, 0x98, 0xca,
+    0xcc, 0xcc, 0xcb, 0xbc, 0xbc, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xab, 0xcb, 0xaa, 0xab, 0xaa,
+    0xaa, 0x89, 0x08, 0x20, 0x34, 0x45, 0x53, 0x43, 0x43, 0x43, 0x43, 0x43, 0x33, 0x43, 0x33, 0x34,
+    0x33, 0x33, 0x24, 0x32, 0x22, 0x11, 0x81, 0x90, 0xbb, 0xcd, 0xcc, 0xcb, 0xbc, 0xdb, 0xbb, 0xbc,
+    0xbc, 0xbb, 0xad, 0xbb, 0xbb, 0xac, 0xbb, 0xab, 0xab, 0xaa, 0x99, 0x08, 0x22, 0x35, 0x45, 0x43,
+    0x34, 0x44, 0x33, 0x34, 0x34, 0x43, 0x33, 0x24, 0x43, 0x32, 0x32, 0x33, 0x23, 0x32, 0x11, 0x01,
+    0x99, 0xcb, 0xbd, 0xcd, 0xcb, 0xdb, 0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xba, 0xbb, 0xcb,
+    0xaa, 0xaa, 0x9a, 0x89, 0x08, 0x22, 0x44, 0x34, 0x35, 0x44, 0x43, 0x33, 0x25, 0x24, 0x33, 0x34,
+    0x42, 0x32, 0x33, 0x33, 0x24, 0x22, 0x22, 0x11, 0x80, 0x98, 0xcb, 0xcc, 0xbc, 0xbd, 0xbc, 0xbc,
+    0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xbb, 0xcb, 0xab, 0xbb, 0xbb, 0xab, 0xaa, 0x89, 0x00, 0x33, 0x55,
+    0x53, 0x43, 0x34, 0x53, 0x33, 0x34, 0x34, 0x43, 0x33, 0x34, 0x33, 0x43, 0x32, 0x23, 0x23, 0x22,
+    0x11, 0x81, 0xa9, 0xeb, 0xdb, 0xcb, 0xbc, 0xcc, 0xbb, 0xbc, 0xbc, 0xcb, 0xcb, 0xab, 0xac, 0xab,
+    0xbb, 0xbb, 0xbb, 0xab, 0x9b, 0x89, 0x10, 0x42, 0x35, 0x35, 0x35, 0x34, 0x44, 0x42, 0x42, 0x32,
+    0x43, 0x33, 0x43, 0x23, 0x24, 0x32, 0x32, 0x22, 0x22, 0x01, 0x00, 0xb9, 0xdb, 0xcc, 0xbc, 0xcc,
+    0xbb, 0xbd, 0xcb, 0xcb, 0xbb, 0xbc, 0xbb, 0xbc, 0xbb, 0xcb, 0xba, 0xba, 0xaa, 0x99, 0x89, 0x10,
+    0x33, 0x46, 0x43, 0x34, 0x35, 0x43, 0x43, 0x43, 0x33, 0x34, 0x24, 0x33, 0x43, 0x32, 0x33, 0x23,
+    0x33, 0x22, 0x11, 0x90, 0xb9, 0xcd, 0xdb, 0xbc, 0xbc, 0xbd, 0xcb, 0xcb, 0xbb, 0xbc, 0xac, 0xcb,
+    0xba, 0xbb, 0xbb, 0xbb, 0xac, 0x9a, 0x9a, 0x88, 0x20, 0x42, 0x44, 0x53, 0x53, 0x33, 0x44, 0x33,
+    0x34, 0x43, 0x24, 0x33, 0x43, 0x23, 0x24, 0x32, 0x22, 0x22, 0x12, 0x11, 0x88, 0xb9, 0xbd, 0xbd,
+    0xcc, 0xbc, 0xcb, 0xbc, 0xcb, 0xac, 0xcb, 0xba, 0xcb, 0xba, 0xbb, 0xcb, 0xba, 0xaa, 0xaa, 0x99,
+    0x09, 0x20, 0x43, 0x35, 0x35, 0x44, 0x43, 0x33, 0x35, 0x43, 0x33, 0x34, 0x43, 0x33, 0x43, 0x32,
+    0x23, 0x33, 0x32, 0x21, 0x01, 0x90, 0xba, 0xdd, 0xcb, 0xbc, 0xcc, 0xcb, 0xbb, 0xbd, 0xbb, 0xbc,
+    0xac, 0xcb, 0xba, 0xbb, 0xbb, 0xbb, 0xbb, 0xba, 0xa9, 0x08, 0x21, 0x54, 0x53, 0x53, 0x43, 0x34,
+    0x43, 0x43, 0x43, 0x33, 0x53, 0x32, 0x33, 0x24, 0x33, 0x32, 0x33, 0x23, 0x12, 0x02, 0x98, 0xcb,
+    0xcc, 0xbc, 0xbd, 0xbd, 0xcb, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xca, 0xaa, 0xbb, 0xbb, 0xba, 0xbb,
+    0xaa, 0x9a, 0x80, 0x32, 0x44, 0x35, 0x44, 0x53, 0x33, 0x44, 0x33, 0x34, 0x43, 0x43, 0x32, 0x43,
+    0x32, 0x33, 0x33, 0x33, 0x32, 0x12, 0x01, 0x99, 0xdb, 0xdb, 0xcc, 0xcb, 0xbc, 0xdb, 0xbb, 0xbc,
+    0xcb, 0xcb, 0xbb, 0xcb, 0xba, 0xcb, 0xba, 0xaa, 0xab, 0xa9, 0x99, 0x00, 0x31, 0x44, 0x34, 0x35,
+    0x35, 0x53, 0x33, 0x34, 0x53, 0x32, 0x24, 0x33, 0x43, 0x33, 0x32, 0x24, 0x22, 0x12, 0x12, 0x00,
+    0x99, 0xca, 0xbc, 0xcd, 0xcb, 0xcb, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xac, 0xbb, 0xcb, 0xba, 0xbb,
+    0xba, 0xab, 0xab, 0x89, 0x00, 0x32, 0x45, 0x34, 0x35, 0x35, 0x43, 0x43, 0x24, 0x43, 0x33, 0x43,
+    0x33, 0x34, 0x32, 0x43, 0x22, 0x32, 0x21, 0x12, 0x80, 0x99, 0xdb, 0xdb, 0xdb, 0xcb, 0xcb, 0xcb,
+    0xac, 0xcb, 0xbb, 0xbc, 0xbb, 0xbc, 0xbb, 0xcb, 0xab, 0xab, 0xab, 0x9a, 0x99, 0x10, 0x32, 0x45,
+    0x34, 0x35, 0x44, 0x33, 0x34, 0x25, 0x43, 0x32, 0x43, 0x33, 0x43, 0x23, 0x33, 0x33, 0x33, 0x23,
+    0x11, 0x81, 0xa9, 0xbd, 0xcd, 0xcb, 0xbc, 0xbd, 0xbb, 0xbd, 0xcb, 0xbb, 0xad, 0xbb, 0xbb, 0xbc,
+    0xba, 0xcb, 0xaa, 0xaa, 0x99, 0x09, 0x18, 0x32, 0x44, 0x44, 0x34, 0x34, 0x44, 0x33, 0x53, 0x33,
+    0x53, 0x32, 0x33, 0x24, 0x33, 0x33, 0x43, 0x22, 0x12, 0x11, 0x90, 0xa9, 0xdb, 0xeb, 0xbb, 0xbd,
+    0xbc, 0xad, 0xcb, 0xbb, 0xbc, 0xbb, 0xad, 0xbb, 0xbb, 0xcb, 0xab, 0xab, 0xaa, 0x9a, 0x89, 0x10,
+    0x53, 0x43, 0x53, 0x34, 0x53, 0x43, 0x33, 0x25, 0x43, 0x33, 0x33, 0x25, 0x33, 0x33, 0x33, 0x43,
+    0x22, 0x21, 0x11, 0x90, 0xb9, 0xbc, 0xbd, 0xbd, 0xbc, 0xcc, 0xbb, 0xbd, 0xbb, 0xbc, 0xac, 0xcb,
+    0xba, 0xbb, 0xcb, 0xba, 0xaa, 0xaa, 0x99, 0x09, 0x20, 0x43, 0x43, 0x44, 0x43, 0x34, 0x34, 0x34,
+    0x43, 0x43, 0x33, 0x34, 0x33, 0x34, 0x32, 0x33, 0x33, 0x33, 0x22, 0x11, 0x91, 0xbb, 0xeb, 0xba,
+    0xad, 0xbc, 0xdb, 0xbb, 0xbc, 0xbc, 0xac, 0xcb, 0xba, 0xcb, 0xba, 0xba, 0xab, 0xab, 0xab, 0x9a,
+    0x00, 0x31, 0x33, 0x35, 0x34, 0x34, 0x35, 0x34, 0x43, 0x43, 0x43, 0x33, 0x43, 0x33, 0x43, 0x32,
+    0x32, 0x33, 0x23, 0x12, 0x21, 0x99, 0xba, 0xdb, 0xbb, 0xbd, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbb,
+    0xbc, 0xac, 0xbb, 0xcb, 0xba, 0xba, 0xba, 0x9a, 0x99, 0x99, 0x31, 0x33, 0x34, 0x34, 0x35, 0x34,
+    0x34, 0x34, 0x34, 0x33, 0x25, 0x33, 0x34, 0x32, 0x33, 0x43, 0x22, 0x22, 0x12, 0x10, 0x90, 0xbb,
+    0xcb, 0xcb, 0xcb, 0xdb, 0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xba, 0xac, 0xbb, 0xba, 0xab,
+    0xaa, 0x9a, 0x19, 0x21, 0x33, 0x53, 0x33, 0x34, 0x35, 0x43, 0x43, 0x33, 0x25, 0x33, 0x43, 0x33,
+    0x33, 0x34, 0x32, 0x33, 0x22, 0x22, 0x01, 0x90, 0xab, 0xbb, 0xbd, 0xbb, 0xbd, 0xdb, 0xbb, 0xbc,
+    0xbc, 0xcb, 0xba, 0xac, 0xbb, 0xcb, 0xaa, 0xbb, 0xaa, 0xaa, 0xa9, 0x10, 0x21, 0x33, 0x43, 0x33,
+    0x35, 0x34, 0x53, 0x33, 0x53, 0x32, 0x24, 0x33, 0x24, 0x33, 0x33, 0x43, 0x31, 0x12, 0x13, 0x11,
+    0x99, 0xaa, 0xbb, 0xbc, 0xcb, 0xcb, 0xac, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbb, 0xbc, 0xbb,
+    0xba, 0xbb, 0xbb, 0x99, 0x10, 0x21, 0x32, 0x33, 0x25, 0x33, 0x34, 0x34, 0x24, 0x34, 0x33, 0x25,
+    0x33, 0x33, 0x34, 0x33, 0x32, 0x24, 0x11, 0x13, 0x01, 0x99, 0xaa, 0xbb, 0xcb, 0xbb, 0xeb, 0xba,
+    0xbb, 0xbc, 0xbc, 0xcb, 0xba, 0xac, 0xbb, 0xcb, 0xaa, 0xba, 0xbb, 0xa9, 0x99, 0x10, 0x21, 0x22,
+    0x33, 0x53, 0x32, 0x33, 0x35, 0x43, 0x33, 0x34, 0x43, 0x33, 0x43, 0x32, 0x33, 0x43, 0x12, 0x31,
+    0xff, 0x77, 0x47, 0x43, 0x53, 0x32, 0x33, 0x33, 0x11, 0x90, 0xcc, 0xcd, 0xcc, 0xdb, 0xcb, 0xcb,
+    0xbb, 0xcb, 0xab, 0xab, 0xaa, 0x88, 0x21, 0x54, 0x54, 0x43, 0x34, 0x33, 0x44, 0x32, 0x32, 0x32,
+    0x22, 0x02, 0x81, 0xaa, 0xcc, 0xcc, 0xbc, 0xbc, 0xbc, 0xcb, 0xcb, 0xba, 0xab, 0xab, 0x9a, 0x8a,
+    0x10, 0x32, 0x45, 0x44, 0x43, 0x34, 0x43, 0x33, 0x34, 0x32, 0x33, 0x23, 0x22, 0x00, 0xa9, 0xdb,
+    0xcc, 0xcc, 0xbb, 0xbd, 0xcb, 0xbb, 0xbb, 0xbc, 0xba, 0xaa, 0x99, 0x00, 0x31, 0x44, 0x44, 0x34,
+    0x34, 0x34, 0x34, 0x33, 0x43, 0x23, 0x23, 0x12, 0x01, 0x98, 0xca, 0xcc, 0xdb, 0xdb, 0xbb, 0xdb,
+    0xab, 0xac, 0xab, 0xab, 0xab, 0x99, 0x09, 0x11, 0x34, 0x45, 0x34, 0x34, 0x34, 0x34, 0x33, 0x34,
+    0x33, 0x32, 0x22, 0x02, 0x80, 0xba, 0xcd, 0xcc, 0xcb, 0xbc, 0xcb, 0xcb, 0xba, 0xcb, 0xaa, 0xaa,
+    0x9a, 0x89, 0x10, 0x33, 0x45, 0x34, 0x35, 0x43, 0x34, 0x33, 0x43, 0x33, 0x32, 0x23, 0x11, 0x81,
+    0xa9, 0xcc, 0xcc, 0xbc, 0xbc, 0xbc, 0xbc, 0xcb, 0xba, 0xbb, 0xab, 0xaa, 0x99, 0x00, 0x32, 0x36,
+    0x35, 0x44, 0x43, 0x43, 0x33, 0x43, 0x32, 0x33, 0x22, 0x22, 0x00, 0x98, 0xdb, 0xcc, 0xdb, 0xcb,
+    0xcb, 0xbb, 0xbc, 0xbb, 0xac, 0xab, 0xaa, 0x99, 0x08, 0x21, 0x44, 0x34, 0x35, 0x44, 0x33, 0x43,
+    0x24, 0x23, 0x33, 0x23, 0x22, 0x01, 0x88, 0xca, 0xcc, 0xbc, 0xbd, 0xcb, 0xbc, 0xbb, 0xbc, 0xbb,
+    0xbb, 0xab, 0xaa, 0x88, 0x21, 0x53, 0x35, 0x35, 0x34, 0x25, 0x43, 0x23, 0x24, 0x32, 0x32, 0x12,
+    0x11, 0x80, 0xb9, 0xcc, 0xcc, 0xcb, 0xbc, 0xdb, 0xba, 0xcb, 0xab, 0xbb, 0xaa, 0xaa, 0x89, 0x10,
+    0x42, 0x44, 0x44, 0x43, 0x43, 0x33, 0x34, 0x24, 0x33, 0x32, 0x22, 0x12, 0x81, 0xa9, 0xdb, 0xcc,
+    0xbc, 0xcc, 0xbb, 0xbc, 0xcb, 0xab, 0xbb, 0xbb, 0xab, 0x99, 0x00, 0x32, 0x45, 0x44, 0x34, 0x53,
+    0x33, 0x34, 0x33, 0x24, 0x33, 0x22, 0x12, 0x01, 0x98, 0xca, 0xbd, 0xbd, 0xbc, 0xad, 0xac, 0xbb,
+    0xcb, 0xab, 0xab, 0xab, 0x99, 0x08, 0x20, 0x44, 0x44, 0x43, 0x34, 0x34, 0x43, 0x33, 0x24, 0x23,
+    0x23, 0x22, 0x11, 0x88, 0xba, 0xcd, 0xbc, 0xbd, 0xbc, 0xdb, 0xba, 0xcb, 0xba, 0xab, 0xba, 0xa9,
+    0x88, 0x20, 0x52, 0x53, 0x34, 0x44, 0x33, 0x34, 0x34, 0x42, 0x22, 0x32, 0x12, 0x11, 0x80, 0xa9,
+    0xdb, 0xcc, 0xdb, 0xbb, 0xcc, 0xba, 0xac, 0xbb, 0xbb, 0xba, 0xaa, 0x89, 0x18, 0x42, 0x44, 0x44,
+    0x43, 0x43, 0x43, 0x33, 0x24, 0x33, 0x33, 0x32, 0x21, 0x00, 0x99, 0xbc, 0xbe, 0xcc, 0xcb, 0xac,
+    0xac, 0xbb, 0xcb, 0xba, 0xba, 0xaa, 0x89, 0x08, 0x31, 0x44, 0x44, 0x53, 0x33, 0x25, 0x24, 0x33,
+    0x42, 0x22, 0x22, 0x12, 0x01, 0x98, 0xba, 0xcd, 0xdb, 0xcb, 0xcb, 0xac, 0xcb, 0xba, 0xba, 0xbb,
+    0xba, 0x99, 0x09, 0x20, 0x44, 0x44, 0x43, 0x34, 0x34, 0x34, 0x33, 0x24, 0x33, 0x23, 0x22, 0x02,
+    0x80, 0xba, 0xcd, 0xbc, 0xbd, 0xbc, 0xbc, 0xcb, 0xbb, 0xac, 0xab, 0xaa, 0x9a, 0x89, 0x10, 0x42,
+    0x44, 0x34, 0x44, 0x43, 0x33, 0x43, 0x43, 0x32, 0x22, 0x13, 0x12, 0x80, 0xa9, 0xdb, 0xcc, 0xdb,
+    0xcb, 0xbb, 0xbc, 0xac, 0xbb, 0xcb, 0xaa, 0xa9, 0x98, 0x00, 0x31, 0x44, 0x44, 0x43, 0x34, 0x43,
+    0x33, 0x34, 0x23, 0x24, 0x12, 0x12, 0x00, 0x98, 0xca, 0xbc, 0xcd, 0xbb, 0xbd, 0xcb, 0xbb, 0xcb,
+    0xba, 0xab, 0xab, 0x99, 0x08, 0x31, 0x44, 0x44, 0x34, 0x34, 0x34, 0x24, 0x24, 0x23, 0x33, 0x22,
+    0x22, 0x01, 0x90, 0xba, 0xbe, 0xbd, 0xcc, 0xcb, 0xbb, 0xbc, 0xcb, 0xba, 0xab, 0xab, 0x9a, 0x88,
+    0x20, 0x53, 0x44, 0x53, 0x43, 0x33, 0x44, 0x32, 0x33, 0x24, 0x32, 0x12, 0x11, 0x80, 0xb9, 0xcc,
+    0xeb, 0xbb, 0xbd, 0xcb, 0xcb, 0xbb, 0xbb, 0xbb, 0xac, 0xa9, 0x88, 0x18, 0x42, 0x53, 0x34, 0x35,
+    0x43, 0x24, 0x24, 0x23, 0x33, 0x33, 0x32, 0x12, 0x00, 0xa9, 0xcc, 0xcc, 0xdb, 0xcb, 0xcb, 0xbb,
+    0xbc, 0xca, 0xaa, 0xab, 0xa9, 0x89, 0x08, 0x31, 0x44, 0x44, 0x43, 0x34, 0x43, 0x43, 0x33, 0x33,
+    0x33, 0x33, 0x22, 0x01, 0xa8, 0xdb, 0xcc, 0xbc, 0xbd, 0xdb, 0xca, 0xba, 0xbb, 0xbb, 0xbb, 0xab,
+    0x9a, 0x09, 0x31, 0x54, 0x34, 0x35, 0x34, 0x44, 0x32, 0x24, 0x33, 0x32, 0x33, 0x22, 0x01, 0x90,
+    0xba, 0xcd, 0xcc, 0xbc, 0xcb, 0xbc, 0xbb, 0xbc, 0xbb, 0xcb, 0xaa, 0x99, 0x09, 0x10, 0x42, 0x44,
+    0x53, 0x43, 0x43, 0x33, 0x34, 0x43, 0x32, 0x32, 0x22, 0x11, 0x80, 0xb9, 0xeb, 0xdb, 0xdb, 0xbb,
+    0xbc, 0xbc, 0xcb, 0xba, 0xbb, 0xba, 0xaa, 0x89, 0x00, 0x33, 0x36, 0x45, 0x43, 0x43, 0x33, 0x25,
+    0x33, 0x33, 0x33, 0x23, 0x22, 0x00, 0x99, 0xcc, 0xcc, 0xbc, 0xbc, 0xad, 0xcb, 0xbb, 0xbb, 0xcb,
+    0xba, 0x9a, 0x8a, 0x08, 0x31, 0x44, 0x44, 0x43, 0x34, 0x34, 0x43, 0x33, 0x33, 0x24, 0x32, 0x21,
+    0x10, 0x98, 0xca, 0xbc, 0xcd, 0xcb, 0xcb, 0xcb, 0xbb, 0xcb, 0xba, 0xab, 0xab, 0x9a, 0x88, 0x21,
+    0x34, 0x36, 0x44, 0x43, 0x43, 0x43, 0x32, 0x24, 0x32, 0x22, 0x22, 0x11, 0x88, 0xb9, 0xcc, 0xbd,
+    0xbc, 0xcc, 0xbb, 0xbc, 0xbb, 0xbc, 0xba, 0xba, 0x9a, 0x89, 0x20, 0x42, 0x35, 0x35, 0x44, 0x33,
+    0x34, 0x34, 0x33, 0x33, 0x24, 0x22, 0x11, 0x80, 0xa8, 0xdb, 0xcc, 0xdb, 0xbb, 0xcc, 0xbb, 0xbb,
+    0xbc, 0xbb, 0xbb, 0xaa, 0x99, 0x00, 0x42, 0x44, 0x34, 0x35, 0x34, 0x34, 0x43, 0x42, 0x22, 0x23,
+    0x22, 0x21, 0x00, 0xa8, 0xca, 0xcc, 0xbc, 0xcc, 0xbb, 0xbc, 0xbc, 0xbb, 0xbb, 0xac, 0x9a, 0x8a,
+    0x88, 0x21, 0x44, 0x53, 0x34, 0x34, 0x34, 0x43, 0x33, 0x24, 0x23, 0x23, 0x22, 0x01, 0x88, 0xca,
+    0xeb, 0xcb, 0xbc, 0xbc, 0xbc, 0xcb, 0xca, 0xaa, 0xba, 0xaa, 0x99, 0x88, 0x20, 0x52, 0x53, 0x43,
+    0x34, 0x34, 0x34, 0x33, 0x34, 0x33, 0x32, 0x22, 0x12, 0x90, 0xb9, 0xdc, 0xbc, 0xbd, 0xbc, 0xbc,
+    0xcb, 0xcb, 0xba, 0xba, 0xaa, 0xaa, 0x98, 0x10, 0x33, 0x36, 0x35, 0x44, 0x43, 0x33, 0x34, 0x33,
+    0x24, 0x23, 0x22, 0x12, 0x00, 0xa9, 0xdb, 0xcc, 0xcb, 0xbc, 0xbc, 0xbc, 0xbb, 0xbc, 0xbb, 0xba,
+    0xaa, 0x99, 0x18, 0x31, 0x45, 0x44, 0x43, 0x53, 0x42, 0x32, 0x33, 0x43, 0x32, 0x22, 0x12, 0x01,
+    0x98, 0xca, 0xcc, 0xbc, 0xbd, 0xcb, 0xcb, 0xbb, 0xbc, 0xba, 0xbb, 0xaa, 0x9a, 0x08, 0x21, 0x44,
+    0x44, 0x34, 0x34, 0x34, 0x34, 0x33, 0x24, 0x33, 0x23, 0x22, 0x11, 0x90, 0xba, 0xcd, 0xcc, 0xcb,
+    0xbc, 0xcb, 0xcb, 0xba, 0xbb, 0xbb, 0xbb, 0xaa, 0x88, 0x20, 0x53, 0x44, 0x44, 0x33, 0x35, 0x43,
+    0x33, 0x24, 0x33, 0x32, 0x22, 0x12, 0x80, 0xb9, 0xcc, 0xcc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbb, 0xbc,
+    0xba, 0xab, 0xaa, 0x89, 0x18, 0x42, 0x44, 0x53, 0x53, 0x33, 0x34, 0x43, 0x33, 0x24, 0x32, 0x22,
+    0x21, 0x00, 0x99, 0xcb, 0xbd, 0xbd, 0xbc, 0xbc, 0xbc, 0xac, 0xbb, 0xbb, 0xbb, 0xaa, 0x8a, 0x08,
+    0x31, 0x45, 0x44, 0x43, 0x34, 0x43, 0x43, 0x33, 0x33, 0x24, 0x22, 0x22, 0x00, 0x90, 0xca, 0xdb,
+    0xcc, 0xbb, 0xbd, 0xcb, 0xcb, 0xba, 0xbb, 0xbb, 0xab, 0x9a, 0x09, 0x21, 0x44, 0x44, 0x53, 0x43,
+    0x43, 0x33, 0x34, 0x33, 0x43, 0x22, 0x22, 0x01, 0x80, 0xaa, 0xdc, 0xcb, 0xbc, 0xcc, 0xbb, 0xcb,
+    0xcb, 0xba, 0xab, 0xab, 0xa9, 0x89, 0x20, 0x42, 0x44, 0x44, 0x43, 0x43, 0x33, 0x34, 0x24, 0x23,
+    0x23, 0x23, 0x11, 0x80, 0xa8, 0xcc, 0xbc, 0xbd, 0xcc, 0xbb, 0xbc, 0xcb, 0xba, 0xbb, 0xbb, 0xaa,
+    0x89, 0x18, 0x32, 0x36, 0x35, 0x35, 0x34, 0x43, 0x43, 0x33, 0x33, 0x43, 0x22, 0x11, 0x81, 0x98,
+    0xca, 0xcc, 0xbc, 0xbc, 0xcc, 0xbb, 0xcb, 0xbb, 0xbb, 0xbb, 0xbb, 0x99, 0x09, 0x32, 0x45, 0x34,
+    0x45, 0x33, 0x34, 0x34, 0x43, 0x23, 0x33, 0x23, 0x13, 0x02, 0x98, 0xca, 0xcc, 0xbc, 0xbd, 0xbc,
+    0xcb, 0xac, 0xbb, 0xbb, 0xbb, 0xbb, 0x9a, 0x89, 0x21, 0x63, 0x34, 0x35, 0x44, 0x33, 0x34, 0x24,
+    0x33, 0x24, 0x22, 0x12, 0x02, 0x80, 0xa9, 0xcc, 0xbc, 0xcc, 0xcb, 0xac, 0xcb, 0xba, 0xbb, 0xac,
+    0xaa, 0xa9, 0x88, 0x18, 0x32, 0x45, 0x53, 0x43, 0x43, 0x24, 0x33, 0x24, 0x33, 0x23, 0x23, 0x12,
+    0x00, 0xa9, 0xeb, 0xdb, 0xdb, 0xbb, 0xad, 0xac, 0xbb, 0xbb, 0xac, 0xab, 0xaa, 0x89, 0x08, 0x32,
+    0x44, 0x44, 0x34, 0x34, 0x34, 0x43, 0x33, 0x33, 0x24, 0x23, 0x21, 0x00, 0x98, 0xca, 0xcc, 0xbc,
+    0xcc, 0xbb, 0xbc, 0xbc, 0xbb, 0xcb, 0xba, 0xaa, 0x99, 0x08, 0x21, 0x53, 0x44, 0x53, 0x33, 0x25,
+    0x24, 0x33, 0x33, 0x24, 0x23, 0x12, 0x11, 0x98, 0xb9, 0xbd, 0xcd, 0xcb, 0xac, 0xbc, 0xbb, 0xcb,
+    0xbb, 0xbb, 0xbb, 0x9a, 0x89, 0x11, 0x34, 0x36, 0x44, 0x43, 0x34, 0x33, 0x25, 0x33, 0x33, 0x23,
+    0x23, 0x12, 0x80, 0xb9, 0xbd, 0xbe, 0xbc, 0xbd, 0xcb, 0xcb, 0xba, 0xac, 0xba, 0xaa, 0x9a, 0x89,
+    0x18, 0x32, 0x35, 0x36, 0x53, 0x43, 0x33, 0x34, 0x43, 0x32, 0x23, 0x32, 0x11, 0x01, 0xa9, 0xcb,
+    0xcd, 0xdb, 0xbb, 0xbd, 0xcb, 0xbb, 0xcb, 0xba, 0xba, 0xaa, 0x99, 0x08, 0x22, 0x35, 0x45, 0x43,
+    0x53, 0x42, 0x32, 0x33, 0x24, 0x33, 0x22, 0x22, 0x01, 0x98, 0xca, 0xcc, 0xbc, 0xcc, 0xcb, 0xbb,
+    0xbc, 0xcb, 0xba, 0xba, 0xaa, 0x9a, 0x88, 0x21, 0x53, 0x44, 0x53, 0x43, 0x43, 0x33, 0x43, 0x33,
+    0x24, 0x22, 0x22, 0x01, 0x90, 0xa9, 0xbd, 0xcc, 0xbc, 0xcc, 0xca, 0xba, 0xbb, 0xac, 0xab, 0xab,
+    0x9a, 0x89, 0x10, 0x43, 0x44, 0x44, 0x33, 0x35, 0x43, 0x33, 0x34, 0x32, 0x33, 0x22, 0x12, 0x81,
+    0xb9, 0xcc, 0xcc, 0xbc, 0xbc, 0xbc, 0xbc, 0xcb, 0xba, 0xbb, 0xba, 0xaa, 0x99, 0x00, 0x42, 0x63,
+    0x53, 0x33, 0x35, 0x43, 0x43, 0x33, 0x42, 0x22, 0x22, 0x11, 0x01, 0x98, 0xcb, 0xbc, 0xbe, 0xcb,
+    0xbc, 0xcb, 0xbb, 0xac, 0xbb, 0xab, 0xab, 0x99, 0x09, 0x22, 0x35, 0x45, 0x43, 0x34, 0x43, 0x24,
+    0x33, 0x24, 0x23, 0x22, 0x22, 0x01, 0x90, 0xca, 0xdb, 0xbc, 0xbd, 0xbc, 0xcb, 0xcb, 0xba, 0xbb,
+    0xac, 0x9a, 0x9a, 0x88, 0x20, 0x33, 0x46, 0x43, 0x34, 0x53, 0x42, 0x32, 0x32, 0x43, 0x22, 0x12,
+    0x11, 0x90, 0xa9, 0xeb, 0xcb, 0xbc, 0xad, 0xac, 0xcb, 0xba, 0xbb, 0xbb, 0xab, 0xab, 0x89, 0x10,
+    0x53, 0x63, 0x43, 0x34, 0x53, 0x33, 0x43, 0x33, 0x24, 0x23, 0x22, 0x11, 0x81, 0xa8, 0xdb, 0xcc,
+    0xcb, 0xbc, 0xbc, 0xcb, 0xbb, 0xac, 0xbb, 0xba, 0xaa, 0x99, 0x18, 0x31, 0x45, 0x34, 0x35, 0x34,
+    0x53, 0x32, 0x43, 0x23, 0x23, 0x23, 0x22, 0x01, 0xa8, 0xcb, 0xcc, 0xcc, 0xcb, 0xcb, 0xcb, 0xbb,
+    0xcb, 0xab, 0xab, 0xab, 0x99, 0x09, 0x21, 0x44, 0x44, 0x43, 0x34, 0x34, 0x43, 0x33, 0x24, 0x33,
+    0x32, 0x22, 0x01, 0x90, 0xc9, 0xeb, 0xcb, 0xbc, 0xbc, 0xdb, 0xba, 0xac, 0xab, 0xab, 0xab, 0x9a,
+    0x89, 0x20, 0x43, 0x35, 0x35, 0x35, 0x43, 0x43, 0x33, 0x33, 0x34, 0x32, 0x22, 0x11, 0x81, 0xb9,
+    0xcc, 0xcc, 0xbc, 0xdb, 0xbb, 0xbc, 0xac, 0xbb, 0xbb, 0xab, 0x9b, 0x8a, 0x10, 0x42, 0x54, 0x43,
+    0x34, 0x34, 0x34, 0x43, 0x32, 0x24, 0x32, 0x22, 0x11, 0x81, 0xa8, 0xcb, 0xcc, 0xbc, 0xbd, 0xcb,
+    0xcb, 0xbb, 0xcb, 0xba, 0xba, 0xaa, 0x99, 0x18, 0x31, 0x44, 0x35, 0x34, 0x35, 0x43, 0x43, 0x32,
+    0x43, 0x22, 0x22, 0x12, 0x11, 0x98, 0xca, 0xeb, 0xcb, 0xcb, 0xdb, 0xba, 0xac, 0xbb, 0xcb, 0xaa,
+    0xaa, 0x99, 0x09, 0x20, 0x53, 0x53, 0x34, 0x34, 0x34, 0x34, 0x33, 0x34, 0x23, 0x33, 0x22, 0x02,
+    0x80, 0xba, 0xcd, 0xcc, 0xcb, 0xbc, 0xcb, 0xbb, 0xbc, 0xbb, 0xbb, 0xbb, 0xab, 0x89, 0x11, 0x53,
+    0x44, 0x34, 0x35, 0x43, 0x24, 0x43, 0x32, 0x33, 0x32, 0x23, 0x12, 0x80, 0xa9, 0xcc, 0xcc, 0xbc,
+    0xbc, 0xbc, 0xbc, 0xbb, 0xbc, 0xab, 0xbb, 0xaa, 0x99, 0x00, 0x32, 0x36, 0x35, 0x35, 0x53, 0x42,
+    0x32, 0x33, 0x43, 0x23, 0x22, 0x12, 0x01, 0xa8, 0xda, 0xdb, 0xbc, 0xbc, 0xbc, 0xbc, 0xcb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0x9a, 0x08, 0x32, 0x54, 0x44, 0x43, 0x34, 0x43, 0x43, 0x33, 0x43, 0x32, 0x22,
+    0x22, 0x01, 0x90, 0xba, 0xbe, 0xcc, 0xbc, 0xcb, 0xbc, 0xbb, 0xbc, 0xbb, 0xbb, 0xbb, 0x9a, 0x89,
+    0x31, 0x63, 0x63, 0x33, 0x35, 0x53, 0x33, 0x43, 0x32, 0x33, 0x24, 0x21, 0x11, 0x80, 0xb9, 0xdb,
+    0xcc, 0xdb, 0xbb, 0xbc, 0xbc, 0xbb, 0xbc, 0xba, 0xab, 0xaa, 0x89, 0x10, 0x42, 0x35, 0x35, 0x34,
+    0x44, 0x33, 0x43, 0x33, 0x43, 0x32, 0x22, 0x21, 0x80, 0xa8, 0xdb, 0xbc, 0xbd, 0xbd, 0xbb, 0xbd,
+    0xbb, 0xcb, 0xab, 0xab, 0xab, 0x99, 0x00, 0x32, 0x35, 0x45, 0x34, 0x34, 0x43, 0x24, 0x33, 0x43,
+    0x32, 0x22, 0x12, 0x01, 0xa8, 0xca, 0xcc, 0xdb, 0xcb, 0xcb, 0xcb, 0xbb, 0xcb, 0xba, 0xab, 0xab,
+    0x9a, 0x08, 0x31, 0x63, 0x53, 0x53, 0x33, 0x25, 0x43, 0x33, 0x33, 0x33, 0x24, 0x22, 0x01, 0x90,
+    0xba, 0xcc, 0xbd, 0xbc, 0xbd, 0xcb, 0xbb, 0xcb, 0xbb, 0xbb, 0xbb, 0x9a, 0x89, 0x20, 0x53, 0x44,
+    0x34, 0x44, 0x33, 0x34, 0x34, 0x33, 0x33, 0x24, 0x22, 0x11, 0x80, 0xa9, 0xbc, 0xcd, 0xbc, 0xdb,
+    0xcb, 0xba, 0xac, 0xbb, 0xbb, 0xbb, 0x9b, 0x99, 0x10, 0x42, 0x44, 0x34, 0x35, 0x34, 0x34, 0x43,
+    0x33, 0x33, 0x24, 0x22, 0x12, 0x00, 0x99, 0xdb, 0xdb, 0xdb, 0xcb, 0xbb, 0xbc, 0xbc, 0xbb, 0xbb,
+    0xac, 0xaa, 0x89, 0x08, 0x31, 0x34, 0x36, 0x34, 0x35, 0x43, 0x43, 0x32, 0x33, 0x24, 0x23, 0x21,
+    0x01, 0x98, 0xbb, 0xcd, 0xdb, 0xdb, 0xca, 0xba, 0xac, 0xbb, 0xcb, 0xaa, 0x9b, 0x9a, 0x08, 0x20,
+    0x43, 0x35, 0x44, 0x53, 0x33, 0x53, 0x32, 0x33, 0x43, 0x22, 0x22, 0x01, 0x80, 0xaa, 0xcc, 0xbc,
+    0xbd, 0xbc, 0xbc, 0xbc, 0xbb, 0xcb, 0xab, 0xab, 0x9a, 0x89, 0x10, 0x33, 0x37, 0x63, 0x33, 0x34,
+    0x34, 0x43, 0x33, 0x43, 0x22, 0x13, 0x11, 0x81, 0xa9, 0xdb, 0xdb, 0xbc, 0xbc, 0xbc, 0xbc, 0xcb,
+    0xba, 0xbb, 0xbb, 0xaa, 0x99, 0x10, 0x41, 0x34, 0x36, 0x53, 0x43, 0x43, 0x33, 0x43, 0x33, 0x23,
+    0x23, 0x12, 0x11, 0x99, 0xeb, 0xcb, 0xdb, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xba, 0xab, 0xaa, 0x99,
+    0x19, 0x21, 0x44, 0x63, 0x33, 0x35, 0x53, 0x32, 0x24, 0x33, 0x33, 0x32, 0x22, 0x11, 0x89, 0xcb,
+    0xbc, 0xbd, 0xbd, 0xbc, 0xcb, 0xcb, 0xbb, 0xbb, 0xbb, 0xab, 0x9b, 0x89, 0x31, 0x34, 0x35, 0x35,
+    0x34, 0x34, 0x34, 0x24, 0x33, 0x33, 0x33, 0x33, 0x21, 0x90, 0xbb, 0xbd, 0xbd, 0xbc, 0xbc, 0xbc,
+    0xbc, 0xcb, 0xba, 0xbb, 0xba, 0xaa, 0x09, 0x28, 0x43, 0x53, 0x53, 0x33, 0x35, 0x34, 0x33, 0x34,
+    0x33, 0x33, 0x33, 0x21, 0x00, 0xb9, 0xdb, 0xdb, 0xcb, 0xcb, 0xcb, 0xbb, 0xbc, 0xbb, 0xcb, 0xaa,
+    0x9b, 0x8a, 0x00, 0x31, 0x35, 0x34, 0x35, 0x53, 0x33, 0x34, 0x33, 0x34, 0x32, 0x32, 0x12, 0x01,
+    0xa9, 0xbb, 0xbd, 0xbd, 0xbc, 0xdb, 0xbb, 0xcb, 0xbb, 0xcb, 0xba, 0xaa, 0x99, 0x19, 0x21, 0x53,
+    0x43, 0x53, 0x42, 0x33, 0x34, 0x43, 0x33, 0x32, 0x33, 0x23, 0x11, 0x91, 0xbb, 0xbc, 0xbd, 0xeb,
+    0xab, 0xbc, 0xcb, 0xbb, 0xbb, 0xcb, 0xaa, 0x9a, 0x88, 0x21, 0x33, 0x35, 0x34, 0x44, 0x42, 0x33,
+    0x43, 0x33, 0x24, 0x32, 0x31, 0x11, 0x90, 0xaa, 0xdb, 0xbb, 0xbd, 0xbc, 0xbc, 0xcb, 0xbb, 0xcb,
+    0xbb, 0xba, 0x9a, 0x99, 0x10, 0x33, 0x53, 0x43, 0x43, 0x43, 0x34, 0x32, 0x34, 0x33, 0x32, 0x33,
+};
+
+// 24960 frames, 520ms
+static const uint8_t sound_boot_adpcm[12480] = {
+    0x70, 0x77, 0x77, 0x33, 0x44, 0x43, 0x43, 0x43, 0x33, 0x43, 0x33, 0x33, 0x24, 0x21, 0x01, 0x90,
+    0xba, 0xce, 0xbc, 0xcd, 0xcb, 0xdb, 0xbb, 0xbc, 0xad, 0xbb, 0xbb, 0xbc, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xab, 0xaa, 0x88, 0x21, 0x53, 0x35, 0x35, 0x35, 0x53, 0x43, 0x43, 0x33, 0x34, 0x34, 0x43, 0x33,
+    0x24, 0x43, 0x32, 0x32, 0x33, 0x33, 0x33, 0x22, 0x12, 0x81, 0x99, 0xcc, 0xeb, 0xcb, 0xbc, 0xbc,
+    0xcc, 0xbb, 0xbc, 0xbc, 0xbc, 0xbb, 0xbc, 0xcb, 0xbb, 0xbb, 0xac, 0xbb, 0xab, 0xab, 0x9b, 0x9a,
+    0x08, 0x20, 0x53, 0x44, 0x34, 0x35, 0x34, 0x34, 0x34, 0x34, 0x34, 0x33, 0x25, 0x33, 0x34, 0x42,
+    0x32, 0x32, 0x33, 0x32, 0x33, 0x22, 0x11, 0x00, 0xa9, 0xcc, 0xcc, 0xdb, 0xcb, 0xbc, 0xbc, 0xdb,
+    0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbb, 0xcb, 0xba, 0xab, 0xab, 0x9b, 0x8a, 0x08, 0x20,
+    0x44, 0x34, 0x45, 0x43, 0x43, 0x34, 0x43, 0x43, 0x43, 0x33, 0x34, 0x33, 0x34, 0x33, 0x34, 0x33,
+    0x33, 0x33, 0x23, 0x23, 0x11, 0x80, 0xb9, 0xdc, 0xdb, 0xbc, 0xcc, 0xcb, 0xcb, 0xcb, 0xcb, 0xbb,
+    0xbc, 0xac, 0xcb, 0xba, 0xbb, 0xac, 0xbb, 0xba, 0xbb, 0xab, 0xaa, 0x8a, 0x08, 0x31, 0x44, 0x35,
+    0x44, 0x34, 0x34, 0x34, 0x34, 0x34, 0x24, 0x24, 0x33, 0x34, 0x33, 0x43, 0x33, 0x33, 0x43, 0x22,
+    0x23, 0x21, 0x01, 0x80, 0xb9, 0xeb, 0xdb, 0xcb, 0xbc, 0xcc, 0xbb, 0xcc, 0xca, 0xba, 0xac, 0xac,
+    0xab, 0xac, 0xab, 0xcb, 0xaa, 0xab, 0xab, 0xba, 0xa9, 0x89, 0x08, 0x22, 0x44, 0x44, 0x34, 0x34,
+    0x35, 0x43, 0x34, 0x43, 0x33, 0x34, 0x34, 0x33, 0x24, 0x24, 0x32, 0x33, 0x32, 0x33, 0x23, 0x22,
+    0x01, 0x90, 0xb9, 0xcd, 0xcc, 0xcb, 0xbc, 0xad, 0xbc, 0xcb, 0xbb, 0xcc, 0xba, 0xac, 0xbb, 0xac,
+    0xbb, 0xac, 0xab, 0xbb, 0xba, 0xaa, 0xaa, 0x89, 0x00, 0x32, 0x54, 0x34, 0x35, 0x44, 0x33, 0x35,
+    0x43, 0x43, 0x43, 0x33, 0x43, 0x33, 0x34, 0x33, 0x33, 0x34, 0x23, 0x33, 0x32, 0x21, 0x01, 0x88,
+    0xba, 0xcd, 0xcc, 0xdb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xbb, 0xcb, 0xac, 0xbb, 0xac, 0xbb, 0xcb,
+    0xba, 0xba, 0xba, 0xaa, 0x9a, 0x89, 0x10, 0x41, 0x53, 0x44, 0x43, 0x34, 0x34, 0x34, 0x34, 0x34,
+    0x43, 0x43, 0x32, 0x24, 0x33, 0x24, 0x33, 0x32, 0x33, 0x33, 0x23, 0x22, 0x10, 0x98, 0xcb, 0xcc,
+    0xcc, 0xdb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xcb, 0xba, 0xac, 0xba, 0xba,
+    0xaa, 0x9b, 0x9a, 0x89, 0x10, 0x42, 0x53, 0x44, 0x43, 0x34, 0x34, 0x34, 0x34, 0x34, 0x43, 0x43,
+    0x32, 0x24, 0x33, 0x43, 0x32, 0x23, 0x33, 0x33, 0x32, 0x21, 0x00, 0x98, 0xcb, 0xdc, 0xcb, 0xcc,
+    0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xca, 0xba, 0xcb, 0xbb, 0xbb, 0xbc, 0xbb, 0xbb, 0xac, 0xba, 0x9a,
+    0x9a, 0x88, 0x10, 0x42, 0x44, 0x53, 0x53, 0x33, 0x35, 0x43, 0x24, 0x24, 0x43, 0x32, 0x24, 0x43,
+    0x32, 0x32, 0x24, 0x32, 0x32, 0x22, 0x13, 0x12, 0x00, 0xa8, 0xca, 0xcc, 0xcc, 0xcb, 0xdb, 0xbb,
+    0xcc, 0xbb, 0xbc, 0xcb, 0xcb, 0xbb, 0xcb, 0xbb, 0xbb, 0xbc, 0xba, 0xbb, 0xab, 0xab, 0x9a, 0x88,
+    0x21, 0x43, 0x45, 0x34, 0x44, 0x53, 0x42, 0x33, 0x34, 0x43, 0x24, 0x43, 0x32, 0x43, 0x32, 0x43,
+    0x32, 0x32, 0x23, 0x23, 0x13, 0x12, 0x00, 0x99, 0xbc, 0xcd, 0xdb, 0xcb, 0xbc, 0xdb, 0xbb, 0xbc,
+    0xbc, 0xbc, 0xbb, 0xbc, 0xcb, 0xbb, 0xbb, 0xac, 0xbb, 0xab, 0xab, 0xab, 0x99, 0x88, 0x21, 0x53,
+    0x44, 0x34, 0x35, 0x34, 0x34, 0x34, 0x34, 0x34, 0x33, 0x25, 0x33, 0x34, 0x42, 0x32, 0x32, 0x33,
+    0x23, 0x33, 0x22, 0x11, 0x81, 0xa9, 0xcc, 0xcc, 0xdb, 0xcb, 0xbc, 0xbc, 0xdb, 0xbb, 0xbc, 0xcb,
+    0xbb, 0xbc, 0xcb, 0xbb, 0xbb, 0xcb, 0xab, 0xbb, 0xaa, 0x9b, 0x8a, 0x88, 0x21, 0x44, 0x34, 0x45,
+    0x43, 0x43, 0x34, 0x43, 0x43, 0x43, 0x33, 0x34, 0x33, 0x34, 0x33, 0x34, 0x33, 0x33, 0x33, 0x33,
+    0x22, 0x02, 0x91, 0xa9, 0xbd, 0xcd, 0xbc, 0xcc, 0xcb, 0xcb, 0xac, 0xac, 0xbb, 0xbc, 0xac, 0xcb,
+    0xba, 0xbb, 0xac, 0xbb, 0xbb, 0xab, 0xbb, 0x9a, 0x9a, 0x00, 0x21, 0x35, 0x45, 0x53, 0x43, 0x53,
+    0x33, 0x34, 0x34, 0x43, 0x43, 0x33, 0x43, 0x33, 0x34, 0x32, 0x24, 0x32, 0x32, 0x22, 0x21, 0x01,
+    0x80, 0xa9, 0xcc, 0xbc, 0xbd, 0xbd, 0xdb, 0xbb, 0xcc, 0xca, 0xba, 0xac, 0xac, 0xab, 0xac, 0xab,
+    0xcb, 0xaa, 0xab, 0xab, 0xab, 0x9a, 0x89, 0x08, 0x22, 0x44, 0x44, 0x53, 0x43, 0x34, 0x43, 0x34,
+    0x43, 0x33, 0x34, 0x34, 0x33, 0x34, 0x33, 0x43, 0x23, 0x33, 0x33, 0x23, 0x22, 0x01, 0x90, 0xb9,
+    0xcd, 0xcc, 0xcb, 0xbc, 0xad, 0xbc, 0xcb, 0xbb, 0xcc, 0xba, 0xac, 0xbb, 0xbc, 0xca, 0xaa, 0xbb,
+    0xba, 0xba, 0xab, 0x9a, 0x89, 0x18, 0x41, 0x53, 0x34, 0x35, 0x44, 0x33, 0x35, 0x43, 0x43, 0x43,
+    0x33, 0x43, 0x33, 0x34, 0x33, 0x43, 0x23, 0x33, 0x23, 0x23, 0x12, 0x01, 0x90, 0xba, 0xcd, 0xcc,
+    0xdb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xbb, 0xbc, 0xbb, 0xbc, 0xac, 0xbb, 0xcb, 0xba, 0xba, 0xab,
+    0xaa, 0xaa, 0x88, 0x18, 0x32, 0x45, 0x34, 0x35, 0x35, 0x43, 0x34, 0x43, 0x43, 0x33, 0x34, 0x24,
+    0x43, 0x32, 0x33, 0x43, 0x23, 0x33, 0x32, 0x22, 0x12, 0x01, 0x98, 0xba, 0xbe, 0xbd, 0xbd, 0xbc,
+    0xcc, 0xbb, 0xcc, 0xca, 0xba, 0xcb, 0xbb, 0xac, 0xcb, 0xba, 0xba, 0xcb, 0xaa, 0xaa, 0xaa, 0x99,
+    0x89, 0x10, 0x32, 0x35, 0x45, 0x53, 0x33, 0x35, 0x43, 0x24, 0x24, 0x43, 0x33, 0x43, 0x33, 0x43,
+    0x33, 0x43, 0x32, 0x32, 0x32, 0x22, 0x12, 0x00, 0x98, 0xca, 0xcc, 0xbc, 0xbd, 0xbc, 0xcc, 0xbb,
+    0xcc, 0xca, 0xba, 0xcb, 0xbb, 0xcb, 0xbb, 0xcb, 0xab, 0xbb, 0xbb, 0xbb, 0xab, 0x9a, 0x89, 0x11,
+    0x43, 0x45, 0x34, 0x44, 0x43, 0x34, 0x43, 0x24, 0x24, 0x43, 0x23, 0x24, 0x43, 0x32, 0x42, 0x22,
+    0x23, 0x23, 0x32, 0x12, 0x12, 0x00, 0x98, 0xcb, 0xcc, 0xcc, 0xcb, 0xdb, 0xbb, 0xcc, 0xbb, 0xbc,
+    0xcb, 0xcb, 0xbb, 0xcb, 0xbb, 0xcb, 0xba, 0xbb, 0xbb, 0xba, 0xba, 0x99, 0x09, 0x20, 0x53, 0x44,
+    0x34, 0x44, 0x53, 0x42, 0x33, 0x34, 0x43, 0x24, 0x43, 0x32, 0x43, 0x33, 0x33, 0x43, 0x32, 0x23,
+    0x33, 0x22, 0x11, 0x00, 0x99, 0xdb, 0xcc, 0xdb, 0xcb, 0xbc, 0xbc, 0xdb, 0xbb, 0xbc, 0xcb, 0xcb,
+    0xbb, 0xcb, 0xba, 0xac, 0xab, 0xbb, 0xab, 0xbb, 0xaa, 0x99, 0x09, 0x11, 0x44, 0x63, 0x43, 0x43,
+    0x34, 0x44, 0x42, 0x42, 0x32, 0x43, 0x33, 0x34, 0x33, 0x34, 0x33, 0x43, 0x32, 0x23, 0x23, 0x22,
+    0x11, 0x80, 0xa9, 0xdb, 0xcc, 0xdb, 0xcb, 0xbc, 0xbc, 0xbc, 0xcb, 0xac, 0xcb, 0xbb, 0xcb, 0xbb,
+    0xcb, 0xbb, 0xbb, 0xac, 0xba, 0xaa, 0xaa, 0x99, 0x80, 0x21, 0x53, 0x44, 0x53, 0x43, 0x43, 0x34,
+    0x43, 0x24, 0x24, 0x33, 0x34, 0x43, 0x32, 0x24, 0x33, 0x32, 0x24, 0x22, 0x22, 0x12, 0x02, 0x80,
+    0xa9, 0xcb, 0xbd, 0xcd, 0xbb, 0xbd, 0xbc, 0xbc, 0xcb, 0xac, 0xcb, 0xbb, 0xcb, 0xca, 0xba, 0xba,
+    0xcb, 0xaa, 0xab, 0xaa, 0xa9, 0x99, 0x00, 0x21, 0x53, 0x44, 0x53, 0x43, 0x34, 0x43, 0x34, 0x43,
+    0x33, 0x44, 0x32, 0x43, 0x32, 0x24, 0x23, 0x33, 0x33, 0x33, 0x23, 0x23, 0x11, 0x88, 0xba, 0xdc,
+    0xcc, 0xcb, 0xbc, 0xbd, 0xcb, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xac, 0xcb, 0xba, 0xba, 0xab,
+    0xbb, 0xab, 0xaa, 0x99, 0x00, 0x32, 0x54, 0x34, 0x35, 0x44, 0x43, 0x33, 0x35, 0x43, 0x33, 0x44,
+    0x32, 0x33, 0x34, 0x33, 0x34, 0x32, 0x33, 0x33, 0x32, 0x22, 0x01, 0x80, 0xba, 0xbe, 0xdc, 0xcb,
+    0xcb, 0xbc, 0xbc, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbb, 0xbc, 0xab, 0xcb, 0xaa, 0x9a,
+    0x9a, 0x89, 0x18, 0x31, 0x63, 0x34, 0x44, 0x43, 0x53, 0x33, 0x34, 0x34, 0x43, 0x43, 0x42, 0x32,
+    0x33, 0x43, 0x32, 0x33, 0x24, 0x22, 0x22, 0x12, 0x10, 0x98, 0xb9, 0xcc, 0xcc, 0xbc, 0xbc, 0xcc,
+    0xbb, 0xcc, 0xbb, 0xcb, 0xcb, 0xbb, 0xbc, 0xbb, 0xcb, 0xbb, 0xbb, 0xac, 0xba, 0xaa, 0x99, 0x89,
+    0x18, 0x32, 0x35, 0x45, 0x53, 0x33, 0x35, 0x43, 0x34, 0x43, 0x33, 0x34, 0x43, 0x33, 0x34, 0x33,
+    0x33, 0x34, 0x32, 0x33, 0x22, 0x22, 0x10, 0x99, 0xca, 0xeb, 0xdb, 0xcb, 0xbc, 0xdb, 0xbb, 0xcc,
+    0xbb, 0xcb, 0xcb, 0xbb, 0xac, 0xcb, 0xba, 0xab, 0xcb, 0xaa, 0xaa, 0xaa, 0x9a, 0x88, 0x18, 0x33,
+    0x45, 0x53, 0x53, 0x43, 0x33, 0x35, 0x43, 0x24, 0x43, 0x42, 0x32, 0x33, 0x43, 0x33, 0x43, 0x32,
+    0x23, 0x23, 0x23, 0x11, 0x01, 0x98, 0xcb, 0xcc, 0xbc, 0xbd, 0xcc, 0xbb, 0xcc, 0xbb, 0xbc, 0xbc,
+    0xbb, 0xbc, 0xbc, 0xca, 0xba, 0xba, 0xbb, 0xbb, 0xac, 0x9a, 0x99, 0x89, 0x20, 0x32, 0x45, 0x34,
+    0x44, 0x53, 0x33, 0x34, 0x34, 0x34, 0x43, 0x33, 0x34, 0x43, 0x33, 0x33, 0x24, 0x33, 0x33, 0x23,
+    0x23, 0x12, 0x01, 0x99, 0xdb, 0xcc, 0xdb, 0xcb, 0xbc, 0xbc, 0xbc, 0xdb, 0xbb, 0xcb, 0xcb, 0xbb,
+    0xcb, 0xbb, 0xcb, 0xba, 0xbb, 0xbb, 0xbb, 0xba, 0x9a, 0x09, 0x20, 0x34, 0x45, 0x34, 0x35, 0x34,
+    0x44, 0x42, 0x33, 0x43, 0x24, 0x43, 0x23, 0x24, 0x33, 0x33, 0x24, 0x33, 0x23, 0x33, 0x22, 0x21,
+    0x00, 0xa9, 0xdb, 0xcc, 0xdb, 0xbc, 0xdb, 0xbb, 0xcc, 0xbb, 0xbc, 0xcb, 0xcb, 0xbb, 0xcb, 0xbb,
+    0xcb, 0xba, 0xbb, 0xba, 0xbb, 0xaa, 0x9a, 0x09, 0x21, 0x34, 0x36, 0x35, 0x44, 0x43, 0x43, 0x33,
+    0x35, 0x43, 0x33, 0x34, 0x33, 0x34, 0x24, 0x33, 0x33, 0x24, 0x23, 0x22, 0x22, 0x11, 0x00, 0xa9,
+    0xdb, 0xbc, 0xbd, 0xbd, 0xdb, 0xcb, 0xbb, 0xbc, 0xbc, 0xbc, 0xbb, 0xbc, 0xcb, 0xbb, 0xbb, 0xbc,
+    0xba, 0xbb, 0xab, 0xaa, 0x9a, 0x08, 0x31, 0x63, 0x34, 0x35, 0x34, 0x35, 0x34, 0x43, 0x34, 0x33,
+    0x25, 0x43, 0x32, 0x43, 0x32, 0x33, 0x24, 0x33, 0x32, 0x22, 0x13, 0x02, 0x00, 0xaa, 0xeb, 0xdb,
+    0xdb, 0xcb, 0xcb, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xac, 0xcb, 0xab, 0xcb, 0xba, 0xbb, 0xba, 0xac,
+    0x9a, 0x9a, 0x8a, 0x08, 0x21, 0x53, 0x34, 0x35, 0x35, 0x43, 0x34, 0x53, 0x42, 0x32, 0x43, 0x33,
+    0x34, 0x33, 0x43, 0x33, 0x24, 0x23, 0x32, 0x32, 0x21, 0x11, 0x90, 0xb9, 0xeb, 0xdb, 0xbc, 0xbc,
+    0xbd, 0xcb, 0xcb, 0xcb, 0xcb, 0xba, 0xbc, 0xbb, 0xcb, 0xbb, 0xbc, 0xba, 0xbb, 0xbb, 0xab, 0x9b,
+    0x99, 0x08, 0x32, 0x54, 0x34, 0x35, 0x35, 0x53, 0x33, 0x34, 0x34, 0x34, 0x43, 0x33, 0x43, 0x33,
+    0x34, 0x33, 0x33, 0x43, 0x32, 0x22, 0x12, 0x01, 0x80, 0xaa, 0xcc, 0xcc, 0xdb, 0xcb, 0xdb, 0xca,
+    0xba, 0xbc, 0xcb, 0xcb, 0xba, 0xbc, 0xba, 0xac, 0xbb, 0xbb, 0xbb, 0xac, 0xaa, 0x9a, 0x09, 0x08,
+    0x32, 0x63, 0x34, 0x44, 0x53, 0x33, 0x34, 0x25, 0x43, 0x33, 0x53, 0x32, 0x43, 0x32, 0x43, 0x32,
+    0x33, 0x33, 0x33, 0x23, 0x22, 0x01, 0xa0, 0xc9, 0xcc, 0xdb, 0xbc, 0xcc, 0xbb, 0xbd, 0xcb, 0xcb,
+    0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xba, 0xac, 0xbb, 0xba, 0xbb, 0xab, 0xa9, 0x99, 0x10, 0x32, 0x27,
+    0x34, 0x34, 0x35, 0x53, 0x33, 0x34, 0x34, 0x34, 0x33, 0x25, 0x33, 0x43, 0x33, 0x33, 0x43, 0x32,
+    0x23, 0x23, 0x21, 0x01, 0x89, 0xca, 0xeb, 0xcb, 0xbc, 0xcc, 0xbb, 0xbd, 0xcb, 0xcb, 0xbb, 0xbc,
+    0xcb, 0xbb, 0xac, 0xbb, 0xac, 0xab, 0xbb, 0xab, 0xaa, 0xaa, 0x09, 0x10, 0x33, 0x27, 0x43, 0x53,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x32, 0x34, 0x43, 0x32, 0x24, 0x33, 0x33, 0x43, 0x23, 0x23, 0x22,
+    0x12, 0x01, 0x99, 0xbb, 0xbe, 0xbc, 0xcc, 0xcb, 0xbc, 0xcb, 0xbc, 0xbb, 0xcc, 0xba, 0xac, 0xbb,
+    0xac, 0xbb, 0xcb, 0xba, 0xbb, 0xaa, 0xab, 0xa9, 0x08, 0x10, 0x43, 0x53, 0x53, 0x43, 0x53, 0x33,
+    0x25, 0x24, 0x43, 0x33, 0x43, 0x33, 0x34, 0x43, 0x32, 0x43, 0x32, 0x32, 0x22, 0x22, 0x11, 0x01,
+    0x99, 0xcb, 0xdb, 0xcb, 0xbc, 0xcc, 0xcb, 0xbb, 0xbd, 0xbb, 0xbd, 0xca, 0xba, 0xcb, 0xbb, 0xbb,
+    0xac, 0xbb, 0xab, 0xbb, 0xba, 0xa9, 0x08, 0x21, 0x33, 0x36, 0x33, 0x36, 0x53, 0x33, 0x35, 0x33,
+    0x35, 0x33, 0x34, 0x24, 0x43, 0x32, 0x33, 0x24, 0x23, 0x23, 0x23, 0x13, 0x12, 0x00, 0xa9, 0xbb,
+    0xae, 0xcb, 0xdb, 0xcb, 0xbb, 0xbd, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xcb, 0xbb, 0xbb, 0xac,
+    0xba, 0xaa, 0xaa, 0x99, 0x08, 0x31, 0x33, 0x35, 0x34, 0x34, 0x35, 0x34, 0x34, 0x53, 0x33, 0x43,
+    0x43, 0x33, 0x33, 0x25, 0x33, 0x33, 0x42, 0x22, 0x22, 0x22, 0x11, 0x90, 0xb9, 0xbb, 0xbd, 0xbc,
+    0xdb, 0xbc, 0xcb, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xcb, 0xba, 0xbb, 0xac, 0xba, 0xaa,
+    0x9a, 0x8a, 0x09, 0x31, 0x33, 0x35, 0x43, 0x34, 0x44, 0x33, 0x44, 0x42, 0x33, 0x43, 0x33, 0x25,
+    0x33, 0x33, 0x24, 0x33, 0x33, 0x33, 0x33, 0x32, 0x12, 0x01, 0xb9, 0xbb, 0xbc, 0xbc, 0xbd, 0xbc,
+    0xbd, 0xbb, 0xcc, 0xbb, 0xcb, 0xcb, 0xbb, 0xac, 0xcb, 0xba, 0xba, 0xba, 0xbb, 0xbb, 0x9a, 0x9b,
+    0x09, 0x31, 0x33, 0x34, 0x34, 0x44, 0x43, 0x43, 0x43, 0x43, 0x33, 0x34, 0x24, 0x43, 0x32, 0x43,
+    0x32, 0x32, 0x33, 0x33, 0x23, 0x33, 0x12, 0x91, 0xb9, 0xba, 0xbc, 0xbc, 0xbc, 0xbd, 0xdb, 0xbb,
+    0xdb, 0xbb, 0xbc, 0xbb, 0xbc, 0xcb, 0xbb, 0xbb, 0xbc, 0xab, 0xbb, 0xab, 0xaa, 0x9a, 0x10, 0x21,
+    0x33, 0x34, 0x53, 0x43, 0x43, 0x43, 0x53, 0x32, 0x43, 0x33, 0x34, 0x43, 0x33, 0x43, 0x32, 0x33,
+    0x43, 0x22, 0x22, 0x12, 0x12, 0x90, 0xb9, 0xba, 0xdb, 0xbb, 0xdb, 0xcb, 0xcb, 0xbb, 0xbd, 0xbb,
+    0xbc, 0xdb, 0xba, 0xbb, 0xac, 0xbb, 0xbb, 0xac, 0xab, 0xaa, 0x9a, 0x9a, 0x10, 0x21, 0x33, 0x53,
+    0x23, 0x53, 0x33, 0x35, 0x43, 0x43, 0x33, 0x34, 0x43, 0x42, 0x32, 0x33, 0x33, 0x25, 0x22, 0x23,
+    0x12, 0x22, 0x11, 0x90, 0xa9, 0xbb, 0xcb, 0xbb, 0xbd, 0xac, 0xbc, 0xdb, 0xba, 0xbc, 0xbb, 0xbc,
+    0xac, 0xcb, 0xba, 0xab, 0xcb, 0xaa, 0xba, 0xb9, 0xaa, 0x99, 0x11, 0x21, 0x32, 0x43, 0x33, 0x34,
+    0x25, 0x34, 0x33, 0x35, 0x43, 0x43, 0x32, 0x24, 0x33, 0x33, 0x34, 0x33, 0x23, 0x43, 0x12, 0x12,
+    0x11, 0x90, 0xa9, 0xba, 0xbb, 0xbd, 0xbb, 0xbc, 0xbc, 0xbc, 0xdb, 0xbb, 0xbc, 0xbb, 0xbc, 0xbb,
+    0xad, 0xab, 0xbb, 0xab, 0xbb, 0xbb, 0x9b, 0x99, 0x10, 0x31, 0x32, 0x33, 0x34, 0x43, 0x53, 0x32,
+    0x34, 0x53, 0x33, 0x33, 0x35, 0x33, 0x43, 0x32, 0x24, 0x23, 0x23, 0x33, 0x33, 0x21, 0x01, 0x90,
+    0xb9, 0xba, 0xbb, 0xbc, 0xda, 0xbb, 0xcb, 0xdb, 0xba, 0xbc, 0xbb, 0xbc, 0xcb, 0xba, 0xac, 0xbb,
+    0xbb, 0xbb, 0xac, 0x99, 0x9b, 0x09, 0x10, 0x21, 0x32, 0x33, 0x24, 0x43, 0x43, 0x33, 0x34, 0x34,
+    0x24, 0x24, 0x33, 0x34, 0x33, 0x43, 0x33, 0x32, 0x25, 0x21, 0x11, 0x12, 0x01, 0x99, 0xa9, 0xaa,
+    0xbb, 0xdb, 0xaa, 0xcb, 0xba, 0xbc, 0xbc, 0xcb, 0xcb, 0xba, 0xac, 0xbb, 0xcb, 0xba, 0xbb, 0xbb,
+    0xbb, 0xab, 0x99, 0x99, 0x11, 0x21, 0x22, 0x33, 0x43, 0x32, 0x53, 0x33, 0x43, 0x33, 0x25, 0x33,
+    0x34, 0x33, 0x34, 0x33, 0x53, 0x22, 0x12, 0x23, 0x12, 0x12, 0x00, 0x90, 0xa9, 0xaa, 0xbb, 0xbb,
+    0xad, 0xba, 0xcb, 0xcb, 0xbb, 0xdb, 0xbb, 0xcb, 0xbb, 0xac, 0xbb, 0xcb, 0xaa, 0xbb, 0xbb, 0xa9,
+    0x99, 0x09, 0x10, 0x21, 0x22, 0x33, 0x33, 0x24, 0x33, 0x35, 0x32, 0x24, 0x43, 0x33, 0x53, 0x23,
+    0x1f, 0x77, 0x77, 0x24, 0x34, 0x43, 0x43, 0x33, 0x33, 0x24, 0x22, 0x01, 0x90, 0xcb, 0xcd, 0xcc,
+    0xbc, 0xcc, 0xcb, 0xcb, 0xbb, 0xad, 0xbb, 0xac, 0xab, 0xa9, 0x89, 0x88, 0x11, 0x42, 0x53, 0x34,
+    0x44, 0x43, 0x43, 0x33, 0x34, 0x34, 0x33, 0x24, 0x33, 0x33, 0x33, 0x23, 0x13, 0x81, 0x98, 0xcb,
+    0xcd, 0xbc, 0xcc, 0xcb, 0xcb, 0xcb, 0xcb, 0xba, 0xac, 0xbb, 0xbb, 0xac, 0xab, 0xaa, 0x9a, 0x89,
+    0x18, 0x32, 0x54, 0x34, 0x44, 0x53, 0x42, 0x42, 0x32, 0x43, 0x33, 0x43, 0x23, 0x33, 0x24, 0x12,
+    0x12, 0x11, 0x88, 0xa9, 0xbc, 0xcd, 0xdb, 0xcb, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xcb, 0xba,
+    0xbb, 0xba, 0x9a, 0x9a, 0x08, 0x21, 0x44, 0x44, 0x53, 0x43, 0x43, 0x43, 0x43, 0x33, 0x34, 0x33,
+    0x24, 0x33, 0x33, 0x33, 0x23, 0x12, 0x81, 0x99, 0xbc, 0xbe, 0xbd, 0xbc, 0xbd, 0xcb, 0xac, 0xcb,
+    0xbb, 0xcb, 0xbb, 0xbb, 0xcb, 0xaa, 0xaa, 0x9a, 0x09, 0x18, 0x33, 0x45, 0x44, 0x43, 0x34, 0x53,
+    0x42, 0x32, 0x24, 0x43, 0x32, 0x32, 0x33, 0x33, 0x23, 0x13, 0x11, 0x98, 0xba, 0xbe, 0xcd, 0xcb,
+    0xbc, 0xbc, 0xbc, 0xcb, 0xcb, 0xbb, 0xbb, 0xbc, 0xbb, 0xbb, 0xba, 0xaa, 0x8a, 0x08, 0x32, 0x54,
+    0x34, 0x45, 0x33, 0x44, 0x43, 0x33, 0x34, 0x43, 0x33, 0x33, 0x24, 0x33, 0x32, 0x22, 0x11, 0x80,
+    0xa8, 0xcc, 0xeb, 0xcb, 0xcb, 0xbc, 0xdb, 0xbb, 0xcb, 0xcb, 0xab, 0xac, 0xab, 0xbb, 0xba, 0xaa,
+    0x99, 0x89, 0x11, 0x53, 0x53, 0x44, 0x43, 0x43, 0x43, 0x43, 0x43, 0x32, 0x24, 0x33, 0x33, 0x24,
+    0x32, 0x22, 0x11, 0x01, 0x98, 0xba, 0xcd, 0xbc, 0xbd, 0xbc, 0xbc, 0xbc, 0xbc, 0xcb, 0xca, 0xba,
+    0xba, 0xbb, 0xbb, 0xba, 0xaa, 0x89, 0x18, 0x32, 0x45, 0x35, 0x34, 0x35, 0x34, 0x43, 0x24, 0x24,
+    0x33, 0x33, 0x34, 0x33, 0x23, 0x33, 0x22, 0x11, 0x80, 0xb9, 0xdc, 0xbc, 0xbd, 0xcc, 0xbb, 0xcc,
+    0xbb, 0xbc, 0xbb, 0xbc, 0xcb, 0xba, 0xab, 0xab, 0xaa, 0x8a, 0x09, 0x21, 0x53, 0x44, 0x53, 0x43,
+    0x34, 0x43, 0x34, 0x33, 0x34, 0x43, 0x33, 0x33, 0x33, 0x24, 0x22, 0x11, 0x00, 0x98, 0xbb, 0xbe,
+    0xbd, 0xcc, 0xcb, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xba, 0xcb, 0xaa, 0xab, 0xaa, 0x99, 0x89, 0x00,
+    0x32, 0x45, 0x53, 0x34, 0x53, 0x33, 0x25, 0x24, 0x33, 0x24, 0x43, 0x22, 0x33, 0x32, 0x22, 0x22,
+    0x01, 0x80, 0xba, 0xdc, 0xdb, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xca, 0xaa, 0xba,
+    0xaa, 0x9a, 0x8a, 0x08, 0x21, 0x53, 0x44, 0x53, 0x43, 0x43, 0x43, 0x43, 0x33, 0x43, 0x43, 0x32,
+    0x23, 0x33, 0x33, 0x22, 0x12, 0x00, 0xa9, 0xeb, 0xdb, 0xdb, 0xcb, 0xdb, 0xca, 0xba, 0xbc, 0xbb,
+    0xcb, 0xcb, 0xba, 0xba, 0xba, 0xaa, 0x9a, 0x88, 0x10, 0x42, 0x35, 0x44, 0x34, 0x34, 0x44, 0x42,
+    0x32, 0x24, 0x33, 0x43, 0x23, 0x33, 0x33, 0x32, 0x12, 0x11, 0x98, 0xca, 0xcc, 0xcc, 0xcb, 0xbc,
+    0xdb, 0xbb, 0xbc, 0xcb, 0xcb, 0xba, 0xbb, 0xbb, 0xac, 0xaa, 0x9a, 0x89, 0x08, 0x31, 0x44, 0x34,
+    0x35, 0x35, 0x43, 0x43, 0x24, 0x33, 0x34, 0x33, 0x34, 0x32, 0x33, 0x23, 0x23, 0x11, 0x80, 0xb9,
+    0xeb, 0xcc, 0xcb, 0xbc, 0xcc, 0xbb, 0xbc, 0xcb, 0xcb, 0xba, 0xcb, 0xba, 0xba, 0xba, 0xaa, 0x99,
+    0x88, 0x20, 0x53, 0x63, 0x43, 0x43, 0x34, 0x34, 0x34, 0x33, 0x25, 0x33, 0x24, 0x33, 0x33, 0x32,
+    0x23, 0x12, 0x01, 0xa8, 0xda, 0xdb, 0xbc, 0xbd, 0xbc, 0xbc, 0xbc, 0xbc, 0xbb, 0xbc, 0xcb, 0xba,
+    0xbb, 0xab, 0xab, 0xaa, 0x89, 0x18, 0x32, 0x36, 0x45, 0x43, 0x53, 0x33, 0x34, 0x34, 0x43, 0x33,
+    0x24, 0x33, 0x24, 0x22, 0x13, 0x22, 0x01, 0x90, 0xa9, 0xeb, 0xdb, 0xcb, 0xbc, 0xbc, 0xdb, 0xbb,
+    0xcb, 0xcb, 0xbb, 0xbb, 0xcb, 0xba, 0xba, 0x9a, 0x9a, 0x08, 0x21, 0x53, 0x44, 0x34, 0x44, 0x43,
+    0x33, 0x25, 0x43, 0x33, 0x33, 0x34, 0x33, 0x33, 0x24, 0x12, 0x12, 0x80, 0x98, 0xcb, 0xcc, 0xdb,
+    0xcb, 0xbc, 0xbc, 0xcb, 0xcb, 0xbb, 0xac, 0xcb, 0xaa, 0xab, 0xab, 0xab, 0xa9, 0x88, 0x10, 0x32,
+    0x36, 0x35, 0x35, 0x53, 0x33, 0x25, 0x43, 0x33, 0x43, 0x33, 0x33, 0x24, 0x23, 0x23, 0x12, 0x01,
+    0x90, 0xba, 0xdc, 0xdb, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xcb, 0xbb, 0xcb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xaa, 0x9a, 0x18, 0x31, 0x45, 0x44, 0x53, 0x43, 0x43, 0x43, 0x33, 0x34, 0x34, 0x33, 0x43, 0x23,
+    0x33, 0x23, 0x13, 0x12, 0x00, 0xa9, 0xcc, 0xcc, 0xdb, 0xcb, 0xcb, 0xac, 0xac, 0xcb, 0xab, 0xac,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xab, 0x9a, 0x89, 0x21, 0x53, 0x44, 0x44, 0x43, 0x53, 0x33, 0x34, 0x43,
+    0x43, 0x33, 0x33, 0x34, 0x32, 0x33, 0x32, 0x21, 0x01, 0x98, 0xca, 0xcc, 0xcc, 0xcb, 0xbc, 0xbc,
+    0xcb, 0xac, 0xcb, 0xab, 0xac, 0xab, 0xbb, 0xba, 0xab, 0xaa, 0x99, 0x10, 0x31, 0x45, 0x44, 0x43,
+    0x34, 0x34, 0x34, 0x24, 0x24, 0x33, 0x24, 0x33, 0x33, 0x43, 0x22, 0x21, 0x01, 0x80, 0x99, 0xbc,
+    0xcd, 0xcb, 0xbc, 0xcc, 0xbb, 0xdb, 0xbb, 0xcb, 0xbb, 0xcb, 0xba, 0xbb, 0xba, 0xaa, 0x9a, 0x88,
+    0x21, 0x53, 0x35, 0x44, 0x53, 0x33, 0x44, 0x33, 0x43, 0x24, 0x33, 0x43, 0x23, 0x33, 0x32, 0x23,
+    0x21, 0x00, 0x98, 0xdb, 0xdb, 0xcc, 0xcb, 0xcb, 0xac, 0xbc, 0xbb, 0xbc, 0xcb, 0xbb, 0xcb, 0xba,
+    0xaa, 0xab, 0xa9, 0x88, 0x18, 0x32, 0x45, 0x34, 0x35, 0x34, 0x44, 0x42, 0x32, 0x24, 0x43, 0x32,
+    0x23, 0x43, 0x22, 0x22, 0x21, 0x01, 0x90, 0xa9, 0xcc, 0xbc, 0xbd, 0xbc, 0xbd, 0xcb, 0xbb, 0xbc,
+    0xbc, 0xbb, 0xcb, 0xba, 0xbb, 0xba, 0xaa, 0x99, 0x08, 0x31, 0x44, 0x44, 0x34, 0x44, 0x33, 0x35,
+    0x33, 0x25, 0x24, 0x32, 0x33, 0x24, 0x23, 0x23, 0x22, 0x11, 0x00, 0xa9, 0xda, 0xbc, 0xbd, 0xcc,
+    0xcb, 0xcb, 0xbb, 0xcc, 0xba, 0xcb, 0xba, 0xbb, 0xbb, 0xbb, 0xba, 0x9a, 0x89, 0x20, 0x52, 0x44,
+    0x34, 0x44, 0x43, 0x43, 0x24, 0x43, 0x33, 0x33, 0x34, 0x43, 0x32, 0x22, 0x23, 0x21, 0x10, 0x98,
+    0xba, 0xdc, 0xbc, 0xcc, 0xdb, 0xbb, 0xdb, 0xbb, 0xbc, 0xbb, 0xbc, 0xbb, 0xcb, 0xba, 0xaa, 0xaa,
+    0x89, 0x18, 0x21, 0x35, 0x54, 0x43, 0x53, 0x33, 0x34, 0x34, 0x43, 0x43, 0x32, 0x33, 0x24, 0x23,
+    0x32, 0x21, 0x02, 0x80, 0xa8, 0xbc, 0xcd, 0xbc, 0xbc, 0xcc, 0xbb, 0xcc, 0xba, 0xac, 0xbb, 0xcb,
+    0xba, 0xab, 0xbb, 0xaa, 0x9a, 0x88, 0x21, 0x43, 0x45, 0x53, 0x43, 0x34, 0x43, 0x43, 0x43, 0x33,
+    0x43, 0x33, 0x33, 0x43, 0x32, 0x22, 0x11, 0x01, 0x98, 0xbb, 0xcd, 0xcc, 0xcb, 0xbc, 0xdb, 0xbb,
+    0xbc, 0xcb, 0xbb, 0xcb, 0xab, 0xbb, 0xac, 0x9a, 0x9a, 0x89, 0x00, 0x31, 0x44, 0x44, 0x43, 0x34,
+    0x34, 0x34, 0x43, 0x43, 0x33, 0x43, 0x32, 0x33, 0x33, 0x33, 0x22, 0x12, 0x88, 0xb9, 0xcd, 0xcc,
+    0xcb, 0xbc, 0xcc, 0xca, 0xba, 0xbc, 0xca, 0xba, 0xbb, 0xac, 0xba, 0xaa, 0xaa, 0x99, 0x08, 0x20,
+    0x53, 0x44, 0x43, 0x44, 0x33, 0x34, 0x34, 0x34, 0x43, 0x32, 0x24, 0x23, 0x33, 0x32, 0x22, 0x12,
+    0x81, 0xa8, 0xcb, 0xcd, 0xcb, 0xcc, 0xbb, 0xbd, 0xbb, 0xbd, 0xbb, 0xbc, 0xbb, 0xcb, 0xab, 0xbb,
+    0xaa, 0x9a, 0x89, 0x10, 0x42, 0x44, 0x34, 0x35, 0x34, 0x34, 0x34, 0x34, 0x43, 0x33, 0x43, 0x23,
+    0x33, 0x33, 0x33, 0x22, 0x01, 0x90, 0xba, 0xdd, 0xdb, 0xcb, 0xbc, 0xdb, 0xbb, 0xbc, 0xcb, 0xcb,
+    0xba, 0xbb, 0xac, 0xba, 0xaa, 0xaa, 0x89, 0x08, 0x21, 0x44, 0x63, 0x33, 0x35, 0x34, 0x34, 0x34,
+    0x43, 0x33, 0x43, 0x33, 0x43, 0x22, 0x23, 0x12, 0x02, 0x81, 0xa8, 0xdb, 0xbc, 0xbd, 0xcc, 0xcb,
+    0xcb, 0xbb, 0xbc, 0xbc, 0xbb, 0xcb, 0xbb, 0xbb, 0xab, 0xab, 0xaa, 0x88, 0x20, 0x53, 0x44, 0x53,
+    0x34, 0x53, 0x33, 0x34, 0x34, 0x43, 0x33, 0x24, 0x33, 0x33, 0x33, 0x32, 0x12, 0x11, 0xa8, 0xca,
+    0xcc, 0xcc, 0xbc, 0xdb, 0xcb, 0xbb, 0xbc, 0xbc, 0xbb, 0xbc, 0xbb, 0xbb, 0xac, 0xaa, 0xaa, 0x98,
+    0x00, 0x31, 0x44, 0x44, 0x34, 0x34, 0x34, 0x44, 0x32, 0x34, 0x42, 0x32, 0x33, 0x43, 0x22, 0x23,
+    0x12, 0x11, 0x80, 0xa9, 0xbc, 0xcd, 0xbc, 0xbc, 0xcc, 0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xbb, 0xcb,
+    0xab, 0xab, 0xba, 0x99, 0x88, 0x21, 0x53, 0x44, 0x53, 0x43, 0x34, 0x43, 0x43, 0x43, 0x32, 0x24,
+    0x33, 0x43, 0x22, 0x23, 0x22, 0x11, 0x01, 0x99, 0xca, 0xeb, 0xcb, 0xbc, 0xcc, 0xbb, 0xbc, 0xbc,
+    0xbb, 0xbc, 0xac, 0xbb, 0xbb, 0xbb, 0xba, 0xaa, 0x89, 0x10, 0x42, 0x44, 0x44, 0x43, 0x34, 0x34,
+    0x34, 0x43, 0x43, 0x42, 0x22, 0x33, 0x33, 0x32, 0x33, 0x22, 0x11, 0x90, 0xba, 0xcd, 0xcc, 0xdb,
+    0xbb, 0xbd, 0xcb, 0xcb, 0xbb, 0xbc, 0xbb, 0xbc, 0xba, 0xbb, 0xbb, 0xaa, 0x9a, 0x08, 0x31, 0x54,
+    0x53, 0x53, 0x43, 0x43, 0x43, 0x33, 0x34, 0x34, 0x33, 0x43, 0x33, 0x23, 0x33, 0x23, 0x12, 0x81,
+    0xa9, 0xdb, 0xdc, 0xcb, 0xdb, 0xbb, 0xbd, 0xbb, 0xad, 0xcb, 0xba, 0xcb, 0xba, 0xba, 0xba, 0xaa,
+    0x9a, 0x89, 0x10, 0x43, 0x44, 0x44, 0x43, 0x53, 0x42, 0x33, 0x43, 0x43, 0x33, 0x33, 0x34, 0x33,
+    0x23, 0x33, 0x22, 0x01, 0x98, 0xba, 0xbf, 0xbc, 0xbd, 0xcc, 0xbb, 0xbc, 0xbc, 0xac, 0xcb, 0xba,
+    0xbb, 0xbb, 0xac, 0xaa, 0x9a, 0x8a, 0x08, 0x22, 0x44, 0x34, 0x35, 0x35, 0x43, 0x43, 0x43, 0x33,
+    0x34, 0x33, 0x43, 0x33, 0x33, 0x23, 0x23, 0x11, 0x81, 0xaa, 0xcc, 0xcc, 0xbc, 0xbd, 0xcb, 0xbc,
+    0xcb, 0xcb, 0xba, 0xac, 0xbb, 0xbb, 0xac, 0xba, 0x9a, 0x9a, 0x88, 0x11, 0x43, 0x44, 0x34, 0x35,
+    0x53, 0x33, 0x34, 0x34, 0x43, 0x33, 0x43, 0x23, 0x33, 0x33, 0x23, 0x22, 0x01, 0xa8, 0xca, 0xbd,
+    0xbd, 0xbd, 0xbc, 0xbc, 0xbc, 0xac, 0xac, 0xbb, 0xcb, 0xba, 0xbb, 0xbb, 0xba, 0xaa, 0x89, 0x18,
+    0x32, 0x55, 0x53, 0x43, 0x53, 0x33, 0x34, 0x34, 0x43, 0x33, 0x24, 0x33, 0x24, 0x32, 0x22, 0x12,
+    0x11, 0x90, 0xa9, 0xcc, 0xdb, 0xbc, 0xcc, 0xbb, 0xcc, 0xbb, 0xcb, 0xcb, 0xab, 0xac, 0xba, 0xab,
+    0xab, 0xaa, 0x9a, 0x08, 0x21, 0x53, 0x44, 0x34, 0x44, 0x33, 0x35, 0x43, 0x33, 0x34, 0x43, 0x23,
+    0x24, 0x22, 0x23, 0x22, 0x11, 0x81, 0xa8, 0xca, 0xcc, 0xdb, 0xdb, 0xbb, 0xbc, 0xbc, 0xbc, 0xcb,
+    0xbb, 0xbb, 0xbc, 0xbb, 0xab, 0xbb, 0x9a, 0x99, 0x10, 0x43, 0x44, 0x44, 0x53, 0x33, 0x35, 0x43,
+    0x33, 0x34, 0x24, 0x33, 0x24, 0x23, 0x23, 0x23, 0x22, 0x01, 0x90, 0xb9, 0xcd, 0xdb, 0xbc, 0xbc,
+    0xbc, 0xbc, 0xbc, 0xcb, 0xbb, 0xac, 0xbb, 0xcb, 0xaa, 0xab, 0xa9, 0x99, 0x08, 0x21, 0x44, 0x53,
+    0x34, 0x34, 0x44, 0x42, 0x33, 0x43, 0x43, 0x32, 0x43, 0x32, 0x32, 0x23, 0x22, 0x21, 0x80, 0xa8,
+    0xdb, 0xcc, 0xdb, 0xcb, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xba, 0xbb, 0xac, 0xaa, 0x9b, 0x9a,
+    0x09, 0x10, 0x42, 0x34, 0x36, 0x53, 0x43, 0x43, 0x33, 0x44, 0x32, 0x43, 0x32, 0x33, 0x33, 0x24,
+    0x22, 0x12, 0x01, 0x88, 0xba, 0xcd, 0xdb, 0xdb, 0xbb, 0xcc, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0x99, 0x00, 0x33, 0x36, 0x45, 0x53, 0x33, 0x35, 0x43, 0x43, 0x33, 0x34,
+    0x33, 0x43, 0x33, 0x23, 0x33, 0x23, 0x11, 0x80, 0xb9, 0xcc, 0xbd, 0xbd, 0xbc, 0xbc, 0xbc, 0xbc,
+    0xbc, 0xbb, 0xbc, 0xbb, 0xcb, 0xab, 0xab, 0xaa, 0x9a, 0x08, 0x20, 0x53, 0x44, 0x53, 0x43, 0x43,
+    0x43, 0x43, 0x33, 0x34, 0x33, 0x34, 0x33, 0x43, 0x22, 0x22, 0x12, 0x81, 0x98, 0xca, 0xeb, 0xcb,
+    0xdb, 0xcb, 0xcb, 0xbb, 0xbc, 0xbc, 0xbb, 0xcb, 0xbb, 0xac, 0xaa, 0xab, 0xa9, 0x98, 0x01, 0x32,
+    0x35, 0x36, 0x53, 0x43, 0x43, 0x43, 0x33, 0x34, 0x43, 0x33, 0x33, 0x24, 0x33, 0x22, 0x13, 0x11,
+    0x80, 0xba, 0xcc, 0xcc, 0xdb, 0xdb, 0xba, 0xbc, 0xbc, 0xbb, 0xad, 0xbb, 0xbb, 0xac, 0xbb, 0xaa,
+    0xab, 0x99, 0x08, 0x21, 0x63, 0x53, 0x53, 0x33, 0x35, 0x34, 0x43, 0x33, 0x34, 0x43, 0x23, 0x43,
+    0x22, 0x23, 0x12, 0x12, 0x00, 0xa8, 0xcb, 0xeb, 0xdb, 0xcb, 0xcb, 0xcb, 0xcb, 0xbb, 0xdb, 0xba,
+    0xbb, 0xcb, 0xba, 0xab, 0xab, 0x9a, 0x89, 0x10, 0x33, 0x37, 0x53, 0x34, 0x34, 0x34, 0x34, 0x43,
+    0x43, 0x32, 0x24, 0x23, 0x33, 0x33, 0x33, 0x12, 0x02, 0xa0, 0xc9, 0xbc, 0xbe, 0xbc, 0xbd, 0xdb,
+    0xbb, 0xbc, 0xcb, 0xbb, 0xcb, 0xbb, 0xbb, 0xac, 0xaa, 0xaa, 0x89, 0x08, 0x31, 0x63, 0x53, 0x43,
+    0x53, 0x33, 0x35, 0x33, 0x34, 0x34, 0x33, 0x43, 0x33, 0x33, 0x23, 0x23, 0x21, 0x80, 0xb9, 0xcc,
+    0xdb, 0xbc, 0xcc, 0xbb, 0xbd, 0xcb, 0xbb, 0xbc, 0xcb, 0xba, 0xcb, 0xaa, 0xab, 0x9a, 0x9a, 0x98,
+    0x11, 0x43, 0x34, 0x36, 0x53, 0x43, 0x43, 0x43, 0x33, 0x53, 0x32, 0x33, 0x43, 0x23, 0x33, 0x22,
+    0x12, 0x11, 0x99, 0xca, 0xdb, 0xdb, 0xdb, 0xbb, 0xbd, 0xcb, 0xbb, 0xbc, 0xac, 0xbb, 0xac, 0xbb,
+    0xba, 0xaa, 0xaa, 0x99, 0x10, 0x41, 0x43, 0x34, 0x35, 0x35, 0x53, 0x33, 0x53, 0x32, 0x24, 0x33,
+    0x43, 0x32, 0x23, 0x32, 0x22, 0x11, 0x80, 0xba, 0xeb, 0xbb, 0xbd, 0xdb, 0xdb, 0xba, 0xbc, 0xbb,
+    0xad, 0xbb, 0xbb, 0xac, 0xbb, 0xaa, 0xab, 0x99, 0x09, 0x31, 0x53, 0x43, 0x53, 0x43, 0x43, 0x53,
+    0x32, 0x24, 0x43, 0x23, 0x43, 0x32, 0x32, 0x32, 0x22, 0x12, 0x01, 0xb9, 0xbb, 0xbe, 0xbb, 0xbe,
+    0xcb, 0xbc, 0xcb, 0xcb, 0xbb, 0xcb, 0xbb, 0xac, 0xbb, 0xba, 0xaa, 0x9a, 0x0a, 0x10, 0x33, 0x35,
+    0x53, 0x43, 0x34, 0x34, 0x43, 0x24, 0x43, 0x33, 0x33, 0x34, 0x23, 0x33, 0x33, 0x12, 0x11, 0x91,
+    0xba, 0xdb, 0xcb, 0xdb, 0xca, 0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xba, 0xac, 0xab, 0xab, 0xab, 0xaa,
+    0x99, 0x10, 0x31, 0x43, 0x53, 0x42, 0x53, 0x33, 0x34, 0x34, 0x43, 0x43, 0x32, 0x43, 0x32, 0x22,
+    0x23, 0x23, 0x11, 0x01, 0xa9, 0xbb, 0xbd, 0xdb, 0xcb, 0xcb, 0xcb, 0xcb, 0xbb, 0xbc, 0xbb, 0xbc,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xab, 0x99, 0x20, 0x32, 0x34, 0x34, 0x44, 0x43, 0x34, 0x43, 0x33, 0x34,
+    0x24, 0x33, 0x43, 0x32, 0x23, 0x23, 0x21, 0x11, 0x90, 0xba, 0xdb, 0xbb, 0xbc, 0xbd, 0xbc, 0xcb,
+    0xcb, 0xbb, 0xbc, 0xbb, 0xac, 0xbb, 0xbb, 0xab, 0xba, 0xa9, 0x10, 0x31, 0x33, 0x35, 0x53, 0x33,
+    0x34, 0x35, 0x33, 0x34, 0x53, 0x32, 0x32, 0x43, 0x32, 0x22, 0x12, 0x11, 0x01, 0xa9, 0xbb, 0xbc,
+    0xbc, 0xbc, 0xbd, 0xdb, 0xba, 0xbc, 0xca, 0xba, 0xbb, 0xac, 0xab, 0xbb, 0xaa, 0xb9, 0x09, 0x11,
+    0x33, 0x53, 0x33, 0x34, 0x34, 0x34, 0x34, 0x34, 0x43, 0x32, 0x24, 0x33, 0x33, 0x23, 0x33, 0x22,
+    0x11, 0x99, 0xba, 0xbb, 0xbd, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xba, 0xac, 0xbb, 0xac, 0xbb, 0xba,
+    0xaa, 0xaa, 0x99, 0x19, 0x31, 0x33, 0x25, 0x33, 0x35, 0x43, 0x43, 0x43, 0x33, 0x34, 0x43, 0x32,
+    0x33, 0x33, 0x32, 0x33, 0x12, 0x00, 0xb9, 0xba, 0xdb, 0xbb, 0xcb, 0xdb, 0xbb, 0xbc, 0xcb, 0xcb,
+    0xbb, 0xbb, 0xcb, 0xba, 0xaa, 0xbb, 0x9a, 0x09, 0x21, 0x32, 0x33, 0x35, 0x33, 0x44, 0x42, 0x33,
+    0x34, 0x33, 0x35, 0x32, 0x33, 0x24, 0x22, 0x22, 0x12, 0x11, 0x99, 0xba, 0xbb, 0xbc, 0xcb, 0xdb,
+    0xca, 0xbb, 0xcb, 0xbb, 0xad, 0xbb, 0xbb, 0xbb, 0xcb, 0xaa, 0xa9, 0x99, 0x11, 0x31, 0x33, 0x43,
+    0x33, 0x35, 0x43, 0x43, 0x33, 0x34, 0x43, 0x32, 0x24, 0x23, 0x23, 0x33, 0x13, 0x12, 0x90, 0xa9,
+    0xff, 0x77, 0x37, 0x34, 0x35, 0x34, 0x33, 0x24, 0x23, 0x11, 0x90, 0xda, 0xcc, 0xcc, 0xcc, 0xcb,
+    0xcb, 0xbb, 0xcc, 0xba, 0xab, 0xbb, 0xab, 0x99, 0x38, 0x54, 0x53, 0x43, 0x34, 0x34, 0x43, 0x43,
+    0x33, 0x33, 0x43, 0x22, 0x22, 0x02, 0x81, 0xa8, 0xdb, 0xbc, 0xbd, 0xcc, 0xcb, 0xbb, 0xbc, 0xcb,
+    0xba, 0xac, 0xaa, 0xaa, 0xa9, 0x88, 0x10, 0x32, 0x45, 0x53, 0x43, 0x34, 0x43, 0x24, 0x33, 0x24,
+    0x33, 0x33, 0x32, 0x22, 0x11, 0x88, 0xba, 0xcd, 0xcc, 0xcb, 0xbc, 0xbc, 0xcb, 0xcb, 0xba, 0xbb,
+    0xac, 0xba, 0x9a, 0x8a, 0x88, 0x21, 0x53, 0x34, 0x35, 0x44, 0x43, 0x33, 0x34, 0x33, 0x34, 0x33,
+    0x33, 0x23, 0x12, 0x01, 0x98, 0xbc, 0xcd, 0xbc, 0xcc, 0xcb, 0xbb, 0xcc, 0xba, 0xbb, 0xcb, 0xba,
+    0xaa, 0xaa, 0x89, 0x00, 0x32, 0x54, 0x53, 0x53, 0x33, 0x34, 0x34, 0x34, 0x42, 0x32, 0x32, 0x22,
+    0x22, 0x02, 0x00, 0xb9, 0xeb, 0xdb, 0xdb, 0xbb, 0xcc, 0xbb, 0xbc, 0xbb, 0xbc, 0xbb, 0xab, 0xab,
+    0x9a, 0x89, 0x11, 0x53, 0x44, 0x34, 0x35, 0x43, 0x34, 0x33, 0x34, 0x43, 0x23, 0x23, 0x23, 0x22,
+    0x01, 0x98, 0xba, 0xcd, 0xcc, 0xdb, 0xbb, 0xbc, 0xbc, 0xac, 0xbb, 0xac, 0xab, 0xba, 0x9a, 0x99,
+    0x08, 0x31, 0x63, 0x53, 0x53, 0x33, 0x25, 0x24, 0x43, 0x32, 0x33, 0x33, 0x33, 0x33, 0x21, 0x00,
+    0xa9, 0xeb, 0xbc, 0xcd, 0xbb, 0xbd, 0xcb, 0xcb, 0xba, 0xac, 0xab, 0xab, 0xab, 0x9a, 0x89, 0x10,
+    0x32, 0x36, 0x35, 0x35, 0x53, 0x33, 0x34, 0x43, 0x33, 0x33, 0x43, 0x22, 0x12, 0x11, 0x80, 0xaa,
+    0xcc, 0xcc, 0xdb, 0xbb, 0xcc, 0xbb, 0xdb, 0xba, 0xbb, 0xbb, 0xab, 0xab, 0x9a, 0x09, 0x21, 0x44,
+    0x44, 0x34, 0x35, 0x43, 0x24, 0x24, 0x33, 0x33, 0x24, 0x23, 0x32, 0x11, 0x01, 0x98, 0xca, 0xcc,
+    0xbc, 0xcc, 0xcb, 0xcb, 0xbb, 0xbc, 0xbb, 0xac, 0xab, 0xab, 0xaa, 0x89, 0x08, 0x32, 0x54, 0x34,
+    0x44, 0x43, 0x24, 0x24, 0x33, 0x24, 0x33, 0x33, 0x33, 0x22, 0x12, 0x00, 0xb9, 0xcc, 0xbd, 0xcc,
+    0xdb, 0xca, 0xca, 0xba, 0xbb, 0xcb, 0xab, 0xbb, 0xba, 0xa9, 0x88, 0x20, 0x52, 0x63, 0x43, 0x43,
+    0x34, 0x43, 0x24, 0x33, 0x34, 0x32, 0x33, 0x32, 0x12, 0x11, 0x98, 0xc9, 0xcc, 0xdb, 0xbc, 0xdb,
+    0xbb, 0xbc, 0xbc, 0xbb, 0xcb, 0xba, 0xba, 0x9a, 0x9a, 0x80, 0x31, 0x44, 0x34, 0x45, 0x33, 0x35,
+    0x43, 0x33, 0x34, 0x33, 0x33, 0x24, 0x22, 0x11, 0x81, 0x98, 0xcb, 0xcc, 0xbc, 0xbd, 0xdb, 0xbb,
+    0xcb, 0xac, 0xbb, 0xca, 0xaa, 0xaa, 0x99, 0x89, 0x00, 0x32, 0x44, 0x44, 0x34, 0x53, 0x33, 0x34,
+    0x24, 0x43, 0x22, 0x23, 0x23, 0x22, 0x11, 0x88, 0xa9, 0xcc, 0xcc, 0xdb, 0xcb, 0xbb, 0xcc, 0xba,
+    0xac, 0xbb, 0xba, 0xbb, 0xba, 0x99, 0x09, 0x20, 0x34, 0x36, 0x35, 0x34, 0x34, 0x34, 0x34, 0x33,
+    0x34, 0x33, 0x23, 0x33, 0x12, 0x01, 0x98, 0xda, 0xdb, 0xbc, 0xbd, 0xbc, 0xdb, 0xbb, 0xcb, 0xbb,
+    0xbb, 0xcb, 0xaa, 0xaa, 0x89, 0x08, 0x31, 0x44, 0x44, 0x34, 0x34, 0x34, 0x34, 0x33, 0x34, 0x24,
+    0x23, 0x32, 0x22, 0x11, 0x00, 0xa9, 0xdb, 0xcc, 0xdb, 0xcb, 0xcb, 0xbb, 0xbc, 0xac, 0xbb, 0xac,
+    0xaa, 0x9b, 0x9a, 0x09, 0x10, 0x32, 0x45, 0x44, 0x43, 0x43, 0x43, 0x33, 0x34, 0x43, 0x32, 0x32,
+    0x32, 0x12, 0x11, 0x88, 0xba, 0xdc, 0xbc, 0xbd, 0xbc, 0xbc, 0xbc, 0xbb, 0xbc, 0xcb, 0xaa, 0xab,
+    0xaa, 0x99, 0x08, 0x21, 0x53, 0x44, 0x53, 0x43, 0x43, 0x33, 0x34, 0x24, 0x33, 0x33, 0x33, 0x33,
+    0x12, 0x01, 0x99, 0xbc, 0xbe, 0xcc, 0xbc, 0xbc, 0xcb, 0xac, 0xcb, 0xba, 0xab, 0xbb, 0xab, 0xaa,
+    0x99, 0x10, 0x42, 0x44, 0x53, 0x34, 0x34, 0x34, 0x24, 0x24, 0x33, 0x33, 0x24, 0x22, 0x22, 0x11,
+    0x08, 0xb9, 0xdb, 0xcc, 0xbc, 0xbc, 0xbc, 0xbc, 0xac, 0xcb, 0xba, 0xba, 0xab, 0xab, 0xa9, 0x88,
+    0x11, 0x53, 0x44, 0x53, 0x43, 0x43, 0x43, 0x33, 0x34, 0x33, 0x43, 0x32, 0x22, 0x12, 0x01, 0x98,
+    0xba, 0xcd, 0xbc, 0xbd, 0xbc, 0xbc, 0xac, 0xac, 0xbb, 0xbb, 0xbb, 0xbb, 0xab, 0x99, 0x08, 0x32,
+    0x45, 0x44, 0x34, 0x34, 0x34, 0x34, 0x24, 0x43, 0x32, 0x32, 0x32, 0x22, 0x11, 0x81, 0xa8, 0xdb,
+    0xcc, 0xdb, 0xcb, 0xcb, 0xcb, 0xbb, 0xbc, 0xca, 0xaa, 0xab, 0xaa, 0x9a, 0x89, 0x10, 0x32, 0x36,
+    0x44, 0x34, 0x34, 0x34, 0x43, 0x43, 0x32, 0x33, 0x43, 0x22, 0x21, 0x01, 0x88, 0xa9, 0xcc, 0xbc,
+    0xbd, 0xbc, 0xbc, 0xbc, 0xac, 0xbb, 0xac, 0xab, 0xab, 0xaa, 0x99, 0x88, 0x21, 0x53, 0x44, 0x34,
+    0x34, 0x44, 0x33, 0x43, 0x43, 0x32, 0x33, 0x33, 0x32, 0x12, 0x01, 0xa8, 0xda, 0xcc, 0xdb, 0xcb,
+    0xcb, 0xac, 0xcb, 0xbb, 0xbb, 0xbc, 0xba, 0xba, 0x9a, 0x99, 0x00, 0x32, 0x45, 0x34, 0x35, 0x34,
+    0x34, 0x34, 0x43, 0x33, 0x33, 0x24, 0x23, 0x22, 0x11, 0x80, 0xa9, 0xdb, 0xcc, 0xbc, 0xcc, 0xbb,
+    0xbc, 0xac, 0xac, 0xab, 0xbb, 0xab, 0xab, 0x9a, 0x89, 0x11, 0x53, 0x44, 0x53, 0x43, 0x24, 0x34,
+    0x33, 0x34, 0x33, 0x24, 0x23, 0x23, 0x12, 0x11, 0x98, 0xc9, 0xeb, 0xcb, 0xbc, 0xbc, 0xbc, 0xbc,
+    0xcb, 0xba, 0xac, 0xba, 0xaa, 0xaa, 0x99, 0x80, 0x31, 0x63, 0x53, 0x43, 0x34, 0x53, 0x33, 0x43,
+    0x33, 0x24, 0x33, 0x23, 0x23, 0x12, 0x00, 0xa9, 0xdb, 0xcc, 0xdb, 0xcb, 0xcb, 0xac, 0xcb, 0xab,
+    0xcb, 0xba, 0xba, 0xaa, 0x9a, 0x89, 0x18, 0x42, 0x34, 0x45, 0x43, 0x34, 0x43, 0x43, 0x33, 0x43,
+    0x33, 0x32, 0x33, 0x22, 0x11, 0x80, 0xba, 0xdc, 0xcc, 0xcb, 0xbc, 0xcb, 0xbc, 0xbb, 0xbc, 0xbb,
+    0xcb, 0xaa, 0xaa, 0x99, 0x09, 0x20, 0x53, 0x53, 0x34, 0x44, 0x33, 0x44, 0x32, 0x24, 0x33, 0x33,
+    0x33, 0x23, 0x22, 0x01, 0x98, 0xdb, 0xbc, 0xcd, 0xcb, 0xbc, 0xcb, 0xcb, 0xbb, 0xcb, 0xba, 0xbb,
+    0xab, 0xaa, 0x99, 0x00, 0x32, 0x54, 0x44, 0x43, 0x34, 0x53, 0x32, 0x34, 0x33, 0x43, 0x32, 0x32,
+    0x22, 0x11, 0x00, 0xa9, 0xcc, 0xdb, 0xbc, 0xcc, 0xbb, 0xcc, 0xba, 0xcb, 0xab, 0xbb, 0xbb, 0xab,
+    0xaa, 0x89, 0x11, 0x53, 0x44, 0x53, 0x43, 0x34, 0x43, 0x43, 0x33, 0x33, 0x34, 0x32, 0x23, 0x22,
+    0x01, 0x90, 0xba, 0xcd, 0xcc, 0xcb, 0xbc, 0xdb, 0xba, 0xbc, 0xca, 0xaa, 0xab, 0xab, 0xaa, 0x99,
+    0x08, 0x30, 0x63, 0x53, 0x43, 0x34, 0x34, 0x53, 0x32, 0x43, 0x23, 0x33, 0x33, 0x22, 0x22, 0x00,
+    0x99, 0xdb, 0xcc, 0xbc, 0xcc, 0xcb, 0xbb, 0xbc, 0xac, 0xbb, 0xac, 0xba, 0xaa, 0xa9, 0x89, 0x10,
+    0x31, 0x45, 0x53, 0x53, 0x33, 0x34, 0x34, 0x43, 0x33, 0x33, 0x24, 0x23, 0x12, 0x11, 0x80, 0xa9,
+    0xcc, 0xcc, 0xcb, 0xbc, 0xbc, 0xcb, 0xac, 0xbb, 0xcb, 0xba, 0xaa, 0x9b, 0x9a, 0x88, 0x11, 0x53,
+    0x53, 0x34, 0x35, 0x43, 0x43, 0x43, 0x32, 0x24, 0x23, 0x23, 0x23, 0x21, 0x01, 0x98, 0xca, 0xcc,
+    0xdb, 0xdb, 0xbb, 0xbc, 0xbc, 0xcb, 0xca, 0xaa, 0xba, 0xaa, 0xaa, 0x89, 0x18, 0x21, 0x44, 0x44,
+    0x43, 0x34, 0x34, 0x43, 0x43, 0x33, 0x33, 0x43, 0x22, 0x13, 0x12, 0x80, 0xa8, 0xdb, 0xbc, 0xbd,
+    0xbd, 0xcb, 0xcb, 0xcb, 0xba, 0xcb, 0xba, 0xba, 0xaa, 0x9a, 0x88, 0x10, 0x42, 0x44, 0x53, 0x53,
+    0x33, 0x34, 0x34, 0x33, 0x34, 0x33, 0x24, 0x22, 0x12, 0x11, 0x88, 0xb9, 0xcc, 0xcc, 0xdb, 0xbb,
+    0xcc, 0xca, 0xba, 0xbb, 0xac, 0xbb, 0xaa, 0xab, 0x99, 0x08, 0x21, 0x63, 0x53, 0x53, 0x33, 0x35,
+    0x43, 0x33, 0x34, 0x33, 0x33, 0x24, 0x22, 0x12, 0x81, 0x98, 0xbb, 0xce, 0xcb, 0xbc, 0xcc, 0xca,
+    0xba, 0xcb, 0xbb, 0xbb, 0xbb, 0xab, 0x9b, 0x8a, 0x00, 0x33, 0x46, 0x34, 0x44, 0x43, 0x43, 0x43,
+    0x33, 0x33, 0x34, 0x33, 0x32, 0x22, 0x12, 0x80, 0xb9, 0xdc, 0xdb, 0xdb, 0xbb, 0xbd, 0xcb, 0xbb,
+    0xac, 0xcb, 0xaa, 0xab, 0xaa, 0x99, 0x88, 0x20, 0x42, 0x44, 0x34, 0x35, 0x53, 0x42, 0x32, 0x43,
+    0x32, 0x33, 0x33, 0x33, 0x22, 0x01, 0x98, 0xca, 0xdc, 0xcb, 0xcc, 0xbb, 0xbc, 0xbc, 0xac, 0xbb,
+    0xac, 0xab, 0xab, 0x9a, 0x8a, 0x08, 0x31, 0x44, 0x44, 0x53, 0x33, 0x35, 0x33, 0x25, 0x33, 0x24,
+    0x23, 0x23, 0x22, 0x12, 0x80, 0xa8, 0xdb, 0xbc, 0xcd, 0xbb, 0xbd, 0xcb, 0xcb, 0xbb, 0xbb, 0xbc,
+    0xba, 0xaa, 0x9a, 0x89, 0x18, 0x43, 0x44, 0x34, 0x44, 0x43, 0x43, 0x43, 0x32, 0x43, 0x23, 0x23,
+    0x23, 0x13, 0x02, 0x90, 0xb9, 0xbd, 0xbe, 0xbc, 0xcc, 0xbb, 0xad, 0xbb, 0xbc, 0xba, 0xac, 0xaa,
+    0x9a, 0x9a, 0x08, 0x11, 0x53, 0x53, 0x34, 0x34, 0x34, 0x34, 0x24, 0x43, 0x32, 0x33, 0x23, 0x23,
+    0x22, 0x00, 0x98, 0xcb, 0xbd, 0xcd, 0xcb, 0xcb, 0xcb, 0xbb, 0xbc, 0xbb, 0xac, 0xbb, 0xaa, 0xaa,
+    0x99, 0x10, 0x31, 0x45, 0x34, 0x35, 0x34, 0x34, 0x43, 0x43, 0x33, 0x33, 0x24, 0x32, 0x21, 0x11,
+    0x81, 0xa9, 0xbc, 0xbe, 0xbc, 0xbd, 0xcb, 0xac, 0xac, 0xbb, 0xbb, 0xcb, 0xba, 0xaa, 0x99, 0x89,
+    0x20, 0x52, 0x53, 0x53, 0x43, 0x43, 0x43, 0x33, 0x34, 0x33, 0x43, 0x32, 0x22, 0x22, 0x01, 0x88,
+    0xba, 0xcd, 0xbc, 0xbd, 0xbc, 0xbc, 0xcb, 0xcb, 0xbb, 0xbb, 0xbb, 0xbb, 0xab, 0x9a, 0x08, 0x31,
+    0x45, 0x44, 0x34, 0x34, 0x34, 0x34, 0x43, 0x33, 0x24, 0x33, 0x32, 0x22, 0x12, 0x81, 0xa8, 0xdb,
+    0xcc, 0xdb, 0xcb, 0xcb, 0xcb, 0xbb, 0xcb, 0xbb, 0xac, 0xab, 0xaa, 0xaa, 0x98, 0x10, 0x42, 0x53,
+    0x44, 0x43, 0x43, 0x43, 0x43, 0x33, 0x43, 0x32, 0x33, 0x32, 0x22, 0x02, 0x80, 0xb9, 0xcd, 0xbc,
+    0xbd, 0xbc, 0xbc, 0xbc, 0xcb, 0xbb, 0xcb, 0xba, 0xab, 0xaa, 0x9a, 0x88, 0x21, 0x53, 0x44, 0x53,
+    0x43, 0x43, 0x43, 0x33, 0x43, 0x33, 0x43, 0x32, 0x22, 0x21, 0x00, 0xa0, 0xba, 0xbe, 0xcc, 0xbc,
+    0xbc, 0xbc, 0xcb, 0xcb, 0xba, 0xbb, 0xbb, 0xbb, 0xaa, 0x9a, 0x00, 0x42, 0x34, 0x36, 0x44, 0x43,
+    0x33, 0x44, 0x32, 0x24, 0x23, 0x33, 0x23, 0x23, 0x12, 0x00, 0xaa, 0xcc, 0xcc, 0xdb, 0xcb, 0xcb,
+    0xcb, 0xbb, 0xcb, 0xbb, 0xbb, 0xac, 0xaa, 0x9a, 0x88, 0x10, 0x42, 0x44, 0x53, 0x43, 0x43, 0x24,
+    0x43, 0x33, 0x33, 0x24, 0x33, 0x32, 0x22, 0x01, 0x90, 0xba, 0xcd, 0xcc, 0xcb, 0xdb, 0xca, 0xba,
+    0xac, 0xbb, 0xcb, 0xba, 0xaa, 0xaa, 0x8a, 0x09, 0x31, 0x63, 0x53, 0x43, 0x34, 0x53, 0x33, 0x43,
+    0x33, 0x34, 0x23, 0x33, 0x23, 0x12, 0x81, 0xa8, 0xdb, 0xcc, 0xdb, 0xcb, 0xdb, 0xba, 0xbc, 0xbb,
+    0xcb, 0xbb, 0xbb, 0xba, 0xaa, 0x89, 0x18, 0x33, 0x46, 0x53, 0x43, 0x34, 0x43, 0x43, 0x33, 0x43,
+    0x33, 0x33, 0x33, 0x22, 0x12, 0x80, 0xba, 0xdc, 0xbc, 0xbd, 0xcc, 0xbb, 0xbc, 0xcb, 0xcb, 0xba,
+    0xab, 0xbb, 0xaa, 0x9a, 0x09, 0x20, 0x34, 0x45, 0x34, 0x44, 0x33, 0x44, 0x32, 0x24, 0x33, 0x33,
+    0x24, 0x22, 0x21, 0x10, 0x98, 0xca, 0xdb, 0xbc, 0xcc, 0xbb, 0xbd, 0xcb, 0xca, 0xba, 0xba, 0xbb,
+    0xbb, 0xaa, 0x9a, 0x00, 0x32, 0x54, 0x44, 0x43, 0x34, 0x53, 0x42, 0x32, 0x33, 0x24, 0x33, 0x32,
+    0x22, 0x12, 0x00, 0xa9, 0xeb, 0xdb, 0xcb, 0xbc, 0xbc, 0xbc, 0xcb, 0xbb, 0xcb, 0xab, 0xbb, 0xab,
+    0x9a, 0x89, 0x10, 0x52, 0x53, 0x34, 0x44, 0x43, 0x33, 0x34, 0x34, 0x33, 0x24, 0x23, 0x23, 0x12,
+    0x02, 0x90, 0xaa, 0xcd, 0xdb, 0xdb, 0xbb, 0xbc, 0xbc, 0xbc, 0xca, 0xba, 0xba, 0xba, 0xaa, 0x9a,
+    0x08, 0x21, 0x63, 0x53, 0x53, 0x33, 0x35, 0x33, 0x25, 0x33, 0x24, 0x33, 0x32, 0x23, 0x12, 0x01,
+    0x99, 0xcb, 0xdc, 0xcb, 0xbc, 0xbc, 0xbc, 0xbc, 0xbb, 0xbc, 0xbb, 0xbb, 0xbb, 0xaa, 0x9a, 0x10,
+    0x33, 0x46, 0x53, 0x34, 0x53, 0x33, 0x34, 0x43, 0x33, 0x43, 0x23, 0x23, 0x22, 0x11, 0x00, 0xaa,
+    0xeb, 0xdb, 0xbc, 0xdb, 0xbb, 0xad, 0xbb, 0xbc, 0xbb, 0xbb, 0xac, 0xaa, 0x9a, 0x88, 0x20, 0x42,
+    0x44, 0x34, 0x44, 0x43, 0x33, 0x34, 0x34, 0x33, 0x33, 0x24, 0x22, 0x22, 0x10, 0x98, 0xc9, 0xdb,
+    0xbc, 0xbd, 0xdb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbb, 0xac, 0xab, 0xaa, 0x99, 0x08, 0x31, 0x44, 0x44,
+    0x53, 0x33, 0x25, 0x24, 0x43, 0x32, 0x33, 0x33, 0x43, 0x12, 0x12, 0x00, 0x99, 0xcb, 0xbd, 0xbd,
+    0xdb, 0xcb, 0xbb, 0xbc, 0xbc, 0xbb, 0xbb, 0xbb, 0xac, 0x9a, 0x89, 0x10, 0x42, 0x53, 0x34, 0x35,
+    0x34, 0x53, 0x32, 0x24, 0x33, 0x24, 0x32, 0x22, 0x13, 0x11, 0x90, 0xb9, 0xcc, 0xbc, 0xbe, 0xcb,
+    0xcb, 0xcb, 0xbb, 0xcb, 0xbb, 0xbb, 0xac, 0x9a, 0x9a, 0x08, 0x20, 0x53, 0x53, 0x53, 0x43, 0x33,
+    0x35, 0x33, 0x34, 0x33, 0x34, 0x32, 0x22, 0x22, 0x00, 0x98, 0xcb, 0xcc, 0xbc, 0xbd, 0xdb, 0xbb,
+    0xbc, 0xcb, 0xbb, 0xbb, 0xcb, 0xaa, 0xaa, 0x89, 0x00, 0x32, 0x44, 0x44, 0x53, 0x43, 0x33, 0x34,
+    0x34, 0x33, 0x24, 0x33, 0x32, 0x23, 0x11, 0x00, 0xb9, 0xeb, 0xbc, 0xcc, 0xdb, 0xbb, 0xbc, 0xcb,
+    0xcb, 0xba, 0xba, 0xbb, 0xab, 0x9a, 0x89, 0x10, 0x53, 0x34, 0x36, 0x53, 0x33, 0x34, 0x34, 0x43,
+    0x33, 0x33, 0x33, 0x24, 0x12, 0x01, 0x90, 0xba, 0xcc, 0xcc, 0xdb, 0xbb, 0xbd, 0xcb, 0xca, 0xba,
+    0xba, 0xbb, 0xbb, 0xab, 0x9a, 0x00, 0x21, 0x45, 0x53, 0x34, 0x34, 0x34, 0x34, 0x24, 0x43, 0x32,
+    0x32, 0x33, 0x22, 0x22, 0x00, 0x99, 0xdb, 0xcc, 0xdb, 0xcb, 0xcb, 0xcb, 0xbb, 0xbc, 0xbb, 0xcb,
+    0xab, 0xab, 0x9a, 0x89, 0x18, 0x42, 0x53, 0x34, 0x35, 0x34, 0x34, 0x24, 0x24, 0x33, 0x33, 0x43,
+    0x22, 0x12, 0x02, 0x80, 0xb9, 0xeb, 0xdb, 0xcb, 0xdb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xba, 0xab,
+    0xba, 0xa9, 0x08, 0x20, 0x63, 0x43, 0x34, 0x34, 0x44, 0x33, 0x34, 0x33, 0x34, 0x33, 0x24, 0x22,
+    0x11, 0x01, 0x90, 0xbb, 0xdc, 0xdb, 0xcb, 0xcb, 0xac, 0xcb, 0xbb, 0xac, 0xbb, 0xbb, 0xba, 0xaa,
+    0x8a, 0x18, 0x41, 0x43, 0x44, 0x34, 0x34, 0x34, 0x34, 0x24, 0x33, 0x34, 0x32, 0x23, 0x22, 0x12,
+    0x00, 0xb9, 0xbc, 0xbd, 0xbd, 0xbc, 0xbc, 0xad, 0xcb, 0xba, 0xbb, 0xac, 0xab, 0xaa, 0x9a, 0x89,
+    0x10, 0x43, 0x34, 0x35, 0x34, 0x35, 0x43, 0x43, 0x33, 0x43, 0x32, 0x33, 0x32, 0x22, 0x01, 0x90,
+    0xbb, 0xbd, 0xcc, 0xcb, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xbb, 0xbb, 0xcb, 0x9a, 0x99, 0x09, 0x21,
+    0x53, 0x53, 0x43, 0x33, 0x35, 0x34, 0x43, 0x33, 0x33, 0x34, 0x22, 0x23, 0x12, 0x01, 0xb9, 0xcb,
+    0xdb, 0xcb, 0xdb, 0xbb, 0xcc, 0xbb, 0xcb, 0xbb, 0xbb, 0xcb, 0xba, 0xa9, 0x89, 0x10, 0x32, 0x35,
+    0x53, 0x43, 0x34, 0x43, 0x43, 0x33, 0x34, 0x23, 0x33, 0x24, 0x12, 0x02, 0x80, 0xb9, 0xbc, 0xeb,
+    0xcb, 0xcb, 0xcb, 0xcb, 0xbb, 0xcb, 0xab, 0xcb, 0xaa, 0xaa, 0xa9, 0x90, 0x22, 0x33, 0x35, 0x34,
+    0x34, 0x35, 0x43, 0x33, 0x34, 0x33, 0x24, 0x33, 0x32, 0x21, 0x11, 0x99, 0xbb, 0xbc, 0xbc, 0xbd,
+    0xcc, 0xbb, 0xcb, 0xcb, 0xbb, 0xbb, 0xcb, 0xaa, 0xaa, 0x89, 0x19, 0x22, 0x53, 0x33, 0x34, 0x35,
+    0x34, 0x43, 0x43, 0x23, 0x43, 0x32, 0x32, 0x22, 0x11, 0x01, 0xa9, 0xbb, 0xbd, 0xcb, 0xbc, 0xbc,
+    0xbc, 0xcb, 0xbb, 0xcb, 0xbb, 0xbb, 0xab, 0xaa, 0x99, 0x10, 0x33, 0x53, 0x43, 0x42, 0x43, 0x43,
+    0x33, 0x43, 0x43, 0x32, 0x23, 0x23, 0x13, 0x21, 0x90, 0xb9, 0xcb, 0xcb, 0xcb, 0xdb, 0xbb, 0xad,
+    0xbb, 0xcb, 0xbb, 0xbb, 0xbb, 0xab, 0x9b, 0x99, 0x31, 0x32, 0x34, 0x34, 0x34, 0x35, 0x43, 0x43,
+    0x32, 0x43, 0x32, 0x32, 0x22, 0x12, 0x11, 0x90, 0xbb, 0xcb, 0xcb, 0xcb, 0xdb, 0xbb, 0xbc, 0xcb,
+    0x77, 0x67, 0x54, 0x43, 0x43, 0x23, 0x23, 0x01, 0xb9, 0xdd, 0xdc, 0xcb, 0xbc, 0xbc, 0xcb, 0xba,
+    0xba, 0x99, 0x08, 0x42, 0x45, 0x34, 0x35, 0x34, 0x34, 0x33, 0x23, 0x13, 0x11, 0x98, 0xda, 0xdb,
+    0xbc, 0xbd, 0xbb, 0xad, 0xbb, 0xbb, 0xaa, 0x9a, 0x88, 0x22, 0x54, 0x53, 0x53, 0x33, 0x53, 0x32,
+    0x23, 0x33, 0x22, 0x10, 0xa8, 0xca, 0xbd, 0xbd, 0xbd, 0xbb, 0xbc, 0xac, 0xab, 0xaa, 0x99, 0x08,
+    0x21, 0x44, 0x44, 0x43, 0x34, 0x33, 0x34, 0x33, 0x33, 0x12, 0x11, 0x99, 0xdb, 0xcc, 0xbc, 0xcc,
+    0xbb, 0xcb, 0xbb, 0xbb, 0xaa, 0x9a, 0x18, 0x31, 0x45, 0x44, 0x43, 0x34, 0x33, 0x34, 0x23, 0x33,
+    0x12, 0x01, 0xa8, 0xdb, 0xcc, 0xbc, 0xcc, 0xbb, 0xcb, 0xba, 0xbb, 0xaa, 0x8a, 0x08, 0x32, 0x45,
+    0x44, 0x43, 0x24, 0x43, 0x23, 0x33, 0x32, 0x12, 0x81, 0xa8, 0xeb, 0xdb, 0xcb, 0xbc, 0xcb, 0xbb,
+    0xcb, 0xba, 0x9a, 0x99, 0x00, 0x32, 0x54, 0x34, 0x44, 0x33, 0x34, 0x33, 0x43, 0x22, 0x21, 0x80,
+    0xa8, 0xdb, 0xbc, 0xbd, 0xbc, 0xbc, 0xcb, 0xba, 0xab, 0xaa, 0x89, 0x18, 0x42, 0x63, 0x43, 0x34,
+    0x34, 0x33, 0x34, 0x33, 0x32, 0x21, 0x80, 0xa9, 0xcc, 0xcc, 0xbc, 0xbc, 0xbc, 0xbb, 0xac, 0xab,
+    0xaa, 0x89, 0x10, 0x42, 0x34, 0x36, 0x43, 0x34, 0x43, 0x32, 0x23, 0x23, 0x12, 0x80, 0xa9, 0xbd,
+    0xcd, 0xcb, 0xcb, 0xcb, 0xbb, 0xbb, 0xab, 0x9b, 0x99, 0x20, 0x43, 0x45, 0x34, 0x34, 0x34, 0x34,
+    0x32, 0x33, 0x23, 0x12, 0x80, 0xba, 0xdc, 0xcc, 0xcb, 0xcb, 0xcb, 0xba, 0xbb, 0xab, 0x9b, 0x89,
+    0x20, 0x52, 0x44, 0x34, 0x34, 0x34, 0x24, 0x33, 0x23, 0x23, 0x11, 0x80, 0xb9, 0xcd, 0xcc, 0xcb,
+    0xcb, 0xbb, 0xbc, 0xab, 0xab, 0xaa, 0x09, 0x20, 0x43, 0x45, 0x34, 0x34, 0x34, 0x43, 0x23, 0x33,
+    0x22, 0x11, 0x88, 0xba, 0xcd, 0xbc, 0xbd, 0xbc, 0xcb, 0xba, 0xcb, 0x9a, 0x9a, 0x88, 0x11, 0x52,
+    0x43, 0x44, 0x33, 0x25, 0x33, 0x24, 0x32, 0x21, 0x11, 0x88, 0xba, 0xdc, 0xdb, 0xcb, 0xcb, 0xbb,
+    0xcb, 0xba, 0xba, 0x99, 0x09, 0x20, 0x34, 0x45, 0x34, 0x34, 0x53, 0x32, 0x23, 0x33, 0x22, 0x11,
+    0x98, 0xca, 0xcc, 0xbc, 0xbd, 0xcb, 0xcb, 0xab, 0xbb, 0xba, 0xa9, 0x08, 0x21, 0x44, 0x44, 0x34,
+    0x53, 0x33, 0x43, 0x23, 0x23, 0x13, 0x01, 0x90, 0xbb, 0xce, 0xdb, 0xcb, 0xbb, 0xbc, 0xcb, 0xaa,
+    0x9b, 0x9a, 0x08, 0x21, 0x44, 0x53, 0x34, 0x53, 0x33, 0x33, 0x34, 0x22, 0x13, 0x01, 0x98, 0xcb,
+    0xcc, 0xbc, 0xbd, 0xcb, 0xbb, 0xac, 0xab, 0xab, 0x99, 0x08, 0x31, 0x44, 0x35, 0x34, 0x44, 0x32,
+    0x24, 0x23, 0x32, 0x21, 0x01, 0x99, 0xda, 0xdb, 0xdb, 0xbb, 0xad, 0xcb, 0xba, 0xaa, 0xaa, 0x8a,
+    0x08, 0x31, 0x54, 0x43, 0x44, 0x33, 0x43, 0x24, 0x32, 0x22, 0x12, 0x81, 0x98, 0xcb, 0xdc, 0xcb,
+    0xcb, 0xcb, 0xbb, 0xbb, 0xac, 0xaa, 0x89, 0x08, 0x22, 0x35, 0x45, 0x33, 0x35, 0x33, 0x34, 0x33,
+    0x23, 0x12, 0x01, 0xa9, 0xeb, 0xdb, 0xdb, 0xbb, 0xbc, 0xbc, 0xba, 0xbb, 0xaa, 0x99, 0x00, 0x42,
+    0x44, 0x34, 0x44, 0x43, 0x42, 0x22, 0x23, 0x23, 0x21, 0x80, 0xa8, 0xdb, 0xcc, 0xdb, 0xbb, 0xbc,
+    0xcb, 0xbb, 0xba, 0xaa, 0x89, 0x18, 0x42, 0x44, 0x34, 0x35, 0x43, 0x33, 0x34, 0x32, 0x22, 0x12,
+    0x00, 0xa9, 0xcc, 0xcc, 0xcb, 0xbc, 0xcb, 0xbb, 0xac, 0xaa, 0xaa, 0x89, 0x10, 0x32, 0x45, 0x34,
+    0x35, 0x43, 0x33, 0x43, 0x23, 0x22, 0x12, 0x80, 0xa9, 0xcc, 0xcc, 0xdb, 0xbb, 0xdb, 0xba, 0xbb,
+    0xba, 0xaa, 0x89, 0x10, 0x43, 0x45, 0x43, 0x34, 0x34, 0x43, 0x32, 0x23, 0x23, 0x12, 0x90, 0xb9,
+    0xdc, 0xdb, 0xdb, 0xbb, 0xcb, 0xcb, 0xba, 0xaa, 0x9a, 0x89, 0x20, 0x42, 0x44, 0x34, 0x25, 0x24,
+    0x33, 0x24, 0x32, 0x12, 0x02, 0x80, 0xb9, 0xcc, 0xcc, 0xcb, 0xbc, 0xbb, 0xbc, 0xbb, 0xba, 0xaa,
+    0x88, 0x20, 0x53, 0x44, 0x34, 0x25, 0x24, 0x33, 0x33, 0x43, 0x12, 0x11, 0x88, 0xb9, 0xcc, 0xcc,
+    0xcb, 0xbc, 0xbb, 0xbc, 0xba, 0xab, 0x9a, 0x89, 0x21, 0x53, 0x35, 0x44, 0x43, 0x33, 0x34, 0x33,
+    0x33, 0x23, 0x11, 0x88, 0xbb, 0xce, 0xbc, 0xcc, 0xbb, 0xbc, 0xbb, 0xac, 0xaa, 0x9a, 0x09, 0x11,
+    0x34, 0x45, 0x43, 0x34, 0x43, 0x33, 0x33, 0x24, 0x12, 0x01, 0x90, 0xba, 0xdc, 0xbc, 0xcc, 0xbb,
+    0xbc, 0xbb, 0xbb, 0xbb, 0x9a, 0x09, 0x31, 0x54, 0x44, 0x43, 0x34, 0x33, 0x34, 0x24, 0x22, 0x12,
+    0x01, 0x90, 0xca, 0xdb, 0xbc, 0xcc, 0xca, 0xba, 0xbb, 0xac, 0x9a, 0x8a, 0x09, 0x21, 0x53, 0x44,
+    0x43, 0x34, 0x33, 0x34, 0x33, 0x33, 0x22, 0x01, 0x98, 0xdb, 0xcc, 0xdb, 0xcb, 0xcb, 0xbb, 0xbb,
+    0xac, 0xaa, 0x99, 0x08, 0x31, 0x63, 0x34, 0x44, 0x33, 0x34, 0x24, 0x23, 0x23, 0x22, 0x00, 0x98,
+    0xcb, 0xbd, 0xbd, 0xbc, 0xbc, 0xbc, 0xba, 0xbb, 0xaa, 0x9a, 0x18, 0x31, 0x45, 0x44, 0x43, 0x43,
+    0x43, 0x32, 0x33, 0x32, 0x12, 0x01, 0x99, 0xdb, 0xcc, 0xbc, 0xbc, 0xbc, 0xac, 0xbb, 0xba, 0xaa,
+    0x8a, 0x08, 0x32, 0x45, 0x44, 0x43, 0x43, 0x33, 0x34, 0x32, 0x32, 0x12, 0x00, 0xa8, 0xeb, 0xcb,
+    0xcc, 0xcb, 0xbb, 0xbc, 0xba, 0xbb, 0xab, 0x99, 0x10, 0x32, 0x46, 0x53, 0x43, 0x43, 0x33, 0x43,
+    0x23, 0x23, 0x21, 0x80, 0xa8, 0xbc, 0xbe, 0xbc, 0xbd, 0xcb, 0xca, 0xaa, 0xaa, 0xaa, 0x89, 0x00,
+    0x32, 0x45, 0x53, 0x43, 0x43, 0x33, 0x33, 0x24, 0x23, 0x11, 0x00, 0xa9, 0xcc, 0xdb, 0xbc, 0xbc,
+    0xac, 0xac, 0xba, 0xba, 0xa9, 0x89, 0x10, 0x32, 0x36, 0x35, 0x34, 0x34, 0x34, 0x32, 0x33, 0x23,
+    0x12, 0x81, 0xb9, 0xcd, 0xbc, 0xbd, 0xbc, 0xcb, 0xbb, 0xcb, 0xaa, 0x9a, 0x89, 0x10, 0x32, 0x36,
+    0x35, 0x34, 0x34, 0x24, 0x33, 0x33, 0x22, 0x12, 0x80, 0xb9, 0xcd, 0xbc, 0xbd, 0xbc, 0xcb, 0xbb,
+    0xbb, 0xbb, 0xaa, 0x89, 0x20, 0x53, 0x35, 0x44, 0x34, 0x43, 0x33, 0x43, 0x32, 0x22, 0x01, 0x80,
+    0xb9, 0xcc, 0xbd, 0xbc, 0xcc, 0xba, 0xcb, 0xba, 0xaa, 0x9a, 0x09, 0x10, 0x43, 0x35, 0x35, 0x34,
+    0x34, 0x33, 0x34, 0x32, 0x22, 0x11, 0x90, 0xba, 0xdc, 0xcc, 0xcb, 0xbb, 0xcc, 0xba, 0xba, 0xaa,
+    0xaa, 0x88, 0x11, 0x34, 0x45, 0x34, 0x53, 0x33, 0x43, 0x33, 0x23, 0x23, 0x11, 0x88, 0xbb, 0xbe,
+    0xcd, 0xcb, 0xbb, 0xbc, 0xac, 0xab, 0xba, 0x99, 0x09, 0x20, 0x34, 0x45, 0x34, 0x53, 0x33, 0x43,
+    0x23, 0x33, 0x12, 0x02, 0x88, 0xbb, 0xce, 0xcb, 0xbc, 0xbc, 0xbc, 0xba, 0xac, 0x9a, 0x8a, 0x09,
+    0x21, 0x43, 0x35, 0x44, 0x43, 0x43, 0x32, 0x33, 0x33, 0x22, 0x11, 0x98, 0xcb, 0xcd, 0xcb, 0xbc,
+    0xbc, 0xac, 0xbb, 0xbb, 0xaa, 0x9a, 0x09, 0x31, 0x35, 0x36, 0x34, 0x34, 0x34, 0x43, 0x32, 0x23,
+    0x12, 0x01, 0x98, 0xbb, 0xce, 0xdb, 0xbb, 0xcc, 0xba, 0xbb, 0xac, 0x9a, 0x8a, 0x08, 0x21, 0x34,
+    0x36, 0x34, 0x34, 0x34, 0x33, 0x24, 0x23, 0x21, 0x81, 0x98, 0xda, 0xdb, 0xcb, 0xbc, 0xbc, 0xbb,
+    0xbc, 0xba, 0xaa, 0x9a, 0x00, 0x31, 0x45, 0x53, 0x34, 0x43, 0x43, 0x23, 0x33, 0x33, 0x12, 0x01,
+    0xa8, 0xbc, 0xbe, 0xcc, 0xcb, 0xcb, 0xbb, 0xbb, 0xbb, 0xbb, 0x99, 0x18, 0x42, 0x44, 0x44, 0x53,
+    0x42, 0x32, 0x33, 0x33, 0x33, 0x22, 0x81, 0xb8, 0xeb, 0xcc, 0xcb, 0xbc, 0xcb, 0xcb, 0xba, 0xaa,
+    0xaa, 0x99, 0x00, 0x32, 0x45, 0x34, 0x44, 0x33, 0x34, 0x43, 0x32, 0x22, 0x11, 0x81, 0xa8, 0xdb,
+    0xcc, 0xcb, 0xbc, 0xcb, 0xbb, 0xac, 0xba, 0xa9, 0x89, 0x18, 0x32, 0x45, 0x34, 0x44, 0x33, 0x34,
+    0x33, 0x43, 0x22, 0x11, 0x00, 0xa9, 0xbc, 0xcd, 0xcb, 0xbc, 0xcb, 0xbb, 0xbb, 0xbb, 0xab, 0x89,
+    0x10, 0x43, 0x45, 0x34, 0x44, 0x33, 0x34, 0x42, 0x22, 0x22, 0x11, 0x80, 0xa9, 0xdb, 0xcc, 0xcb,
+    0xbc, 0xbb, 0xbc, 0xbb, 0xbb, 0x9b, 0x8a, 0x20, 0x53, 0x44, 0x53, 0x43, 0x43, 0x33, 0x43, 0x22,
+    0x13, 0x02, 0x80, 0xa9, 0xcc, 0xcc, 0xcb, 0xac, 0xac, 0xbb, 0xbb, 0xab, 0xaa, 0x89, 0x20, 0x53,
+    0x44, 0x34, 0x34, 0x44, 0x32, 0x23, 0x33, 0x23, 0x11, 0x80, 0xba, 0xcd, 0xcc, 0xcb, 0xcb, 0xcb,
+    0xab, 0xbb, 0xab, 0xaa, 0x88, 0x20, 0x53, 0x44, 0x34, 0x34, 0x34, 0x24, 0x33, 0x23, 0x23, 0x11,
+    0x88, 0xba, 0xcd, 0xcc, 0xcb, 0xcb, 0xcb, 0xba, 0xab, 0xab, 0x9a, 0x89, 0x21, 0x53, 0x44, 0x34,
+    0x34, 0x34, 0x43, 0x23, 0x23, 0x13, 0x02, 0x90, 0xba, 0xcd, 0xcc, 0xcb, 0xcb, 0xbb, 0xac, 0xbb,
+    0xaa, 0x9a, 0x88, 0x21, 0x53, 0x44, 0x34, 0x34, 0x34, 0x43, 0x32, 0x32, 0x12, 0x11, 0x98, 0xba,
+    0xdd, 0xcb, 0xbc, 0xcb, 0xac, 0xbb, 0xba, 0xab, 0x9a, 0x88, 0x31, 0x44, 0x44, 0x34, 0x34, 0x34,
+    0x33, 0x43, 0x32, 0x21, 0x01, 0x88, 0xbb, 0xbe, 0xbd, 0xbc, 0xbc, 0xbc, 0xbb, 0xbb, 0xba, 0xa9,
+    0x08, 0x31, 0x45, 0x34, 0x35, 0x34, 0x43, 0x43, 0x22, 0x23, 0x12, 0x01, 0x98, 0xbb, 0xbe, 0xbd,
+    0xbc, 0xbc, 0xbc, 0xba, 0xbb, 0xab, 0x99, 0x08, 0x31, 0x45, 0x34, 0x35, 0x34, 0x43, 0x33, 0x33,
+    0x24, 0x11, 0x01, 0x98, 0xbb, 0xbe, 0xbd, 0xbc, 0xbc, 0xac, 0xbb, 0xba, 0xab, 0x99, 0x18, 0x31,
+    0x45, 0x34, 0x35, 0x34, 0x43, 0x33, 0x33, 0x23, 0x22, 0x01, 0xa9, 0xeb, 0xdb, 0xbc, 0xbc, 0xbc,
+    0xcb, 0xba, 0xab, 0xaa, 0x8a, 0x08, 0x32, 0x45, 0x44, 0x43, 0x43, 0x33, 0x43, 0x23, 0x23, 0x12,
+    0x00, 0x99, 0xbc, 0xcd, 0xbc, 0xbc, 0xbc, 0xbb, 0xac, 0xab, 0xaa, 0x99, 0x00, 0x42, 0x53, 0x44,
+    0x43, 0x33, 0x34, 0x24, 0x23, 0x23, 0x12, 0x80, 0xa8, 0xbc, 0xcd, 0xbc, 0xbc, 0xcb, 0xcb, 0xba,
+    0xaa, 0xaa, 0x89, 0x18, 0x32, 0x36, 0x44, 0x34, 0x43, 0x43, 0x32, 0x23, 0x23, 0x12, 0x80, 0xb8,
+    0xcc, 0xcc, 0xdb, 0xbb, 0xbc, 0xac, 0xbb, 0xba, 0x9a, 0x89, 0x18, 0x43, 0x44, 0x34, 0x35, 0x43,
+    0x33, 0x34, 0x32, 0x22, 0x02, 0x81, 0xb9, 0xcc, 0xcc, 0xbc, 0xcb, 0xbc, 0xca, 0xaa, 0xaa, 0xaa,
+    0x88, 0x10, 0x32, 0x36, 0x44, 0x34, 0x43, 0x33, 0x43, 0x32, 0x22, 0x11, 0x80, 0xb9, 0xcc, 0xcc,
+    0xbc, 0xcb, 0xac, 0xbb, 0xbb, 0xbb, 0x9b, 0x89, 0x20, 0x53, 0x44, 0x44, 0x33, 0x44, 0x32, 0x33,
+    0x33, 0x23, 0x11, 0x80, 0xba, 0xdd, 0xcb, 0xbc, 0xcc, 0xba, 0xcb, 0xaa, 0xab, 0x99, 0x89, 0x11,
+    0x43, 0x44, 0x44, 0x33, 0x34, 0x34, 0x32, 0x33, 0x32, 0x11, 0x88, 0xca, 0xeb, 0xdb, 0xcb, 0xbb,
+    0xbc, 0xac, 0xab, 0xab, 0xa9, 0x88, 0x11, 0x34, 0x45, 0x53, 0x33, 0x34, 0x24, 0x33, 0x23, 0x22,
+    0x02, 0x90, 0xca, 0xcc, 0xdb, 0xbc, 0xcb, 0xbb, 0xbc, 0xba, 0xab, 0x9a, 0x88, 0x21, 0x44, 0x44,
+    0x43, 0x34, 0x43, 0x33, 0x24, 0x23, 0x12, 0x01, 0x90, 0xba, 0xcd, 0xbc, 0xbd, 0xcb, 0xbb, 0xac,
+    0xab, 0xab, 0x9a, 0x08, 0x21, 0x44, 0x44, 0x43, 0x34, 0x43, 0x33, 0x33, 0x24, 0x21, 0x01, 0x98,
+    0xba, 0xcd, 0xbc, 0xbd, 0xbb, 0xad, 0xbb, 0xab, 0xab, 0x9a, 0x08, 0x31, 0x54, 0x53, 0x53, 0x33,
+    0x43, 0x24, 0x32, 0x32, 0x21, 0x01, 0x98, 0xcb, 0xcc, 0xbc, 0xcc, 0xbb, 0xcb, 0xbb, 0xbb, 0xab,
+    0x9a, 0x08, 0x41, 0x53, 0x44, 0x43, 0x34, 0x33, 0x34, 0x33, 0x33, 0x12, 0x01, 0x98, 0xbc, 0xcd,
+    0xbc, 0xcc, 0xbb, 0xcb, 0xbb, 0xbb, 0xaa, 0x8a, 0x08, 0x41, 0x63, 0x43, 0x34, 0x34, 0x34, 0x42,
+    0x22, 0x22, 0x12, 0x81, 0x98, 0xcb, 0xcc, 0xbc, 0xcc, 0xca, 0xba, 0xba, 0xbb, 0xaa, 0x8a, 0x18,
+    0x41, 0x44, 0x53, 0x43, 0x24, 0x43, 0x23, 0x33, 0x32, 0x21, 0x00, 0xa9, 0xdb, 0xcc, 0xbc, 0xcc,
+    0xba, 0xac, 0xbb, 0xba, 0xaa, 0x99, 0x00, 0x42, 0x44, 0x53, 0x43, 0x43, 0x33, 0x34, 0x32, 0x22,
+    0x12, 0x81, 0xa8, 0xcc, 0xbc, 0xbd, 0xbc, 0xbc, 0xcb, 0xba, 0xab, 0xaa, 0x89, 0x00, 0x42, 0x44,
+    0x53, 0x43, 0x43, 0x33, 0x24, 0x23, 0x23, 0x11, 0x00, 0xa9, 0xcc, 0xcc, 0xcb, 0xcb, 0xac, 0xbb,
+    0xbb, 0xbb, 0xab, 0x89, 0x10, 0x43, 0x45, 0x34, 0x34, 0x44, 0x32, 0x33, 0x33, 0x23, 0x12, 0x80,
+    0xb9, 0xcd, 0xbc, 0xbd, 0xbc, 0xbc, 0xbb, 0xbb, 0xac, 0x9a, 0x89, 0x10, 0x43, 0x44, 0x53, 0x43,
+    0x43, 0x32, 0x24, 0x32, 0x12, 0x02, 0x80, 0xa9, 0xcc, 0xcc, 0xcb, 0xcb, 0xcb, 0xba, 0xbb, 0xab,
+    0xaa, 0x89, 0x20, 0x53, 0x44, 0x34, 0x34, 0x34, 0x43, 0x33, 0x23, 0x23, 0x11, 0x90, 0xb9, 0xcd,
+    0xcc, 0xcb, 0xcb, 0xbb, 0xbc, 0xab, 0xab, 0xaa, 0x88, 0x20, 0x53, 0x44, 0x34, 0x34, 0x34, 0x43,
+    0x32, 0x33, 0x22, 0x11, 0x88, 0xba, 0xcd, 0xcc, 0xcb, 0xcb, 0xbb, 0xac, 0xbb, 0xaa, 0x9a, 0x89,
+    0x21, 0x53, 0x44, 0x34, 0x34, 0x34, 0x33, 0x34, 0x22, 0x13, 0x02, 0x90, 0xba, 0xbe, 0xcc, 0xbc,
+    0xdb, 0xba, 0xbb, 0xac, 0xaa, 0x99, 0x09, 0x20, 0x53, 0x34, 0x35, 0x34, 0x34, 0x33, 0x43, 0x32,
+    0x12, 0x11, 0x98, 0xba, 0xcd, 0xcc, 0xcb, 0xbb, 0xbc, 0xac, 0xab, 0xaa, 0x9a, 0x08, 0x30, 0x53,
+    0x44, 0x34, 0x34, 0x43, 0x43, 0x22, 0x23, 0x12, 0x01, 0x90, 0xbb, 0xdd, 0xcb, 0xcb, 0xbc, 0xbb,
+    0xac, 0xab, 0xab, 0x99, 0x09, 0x31, 0x44, 0x35, 0x34, 0x44, 0x33, 0x33, 0x34, 0x22, 0x22, 0x01,
+    0xa8, 0xca, 0xbd, 0xbd, 0xbc, 0xbc, 0xcb, 0xab, 0xbb, 0xab, 0x99, 0x08, 0x31, 0x45, 0x34, 0x35,
+    0x53, 0x32, 0x24, 0x23, 0x23, 0x21, 0x00, 0x98, 0xcb, 0xcc, 0xcc, 0xbb, 0xad, 0xcb, 0xaa, 0xab,
+    0xaa, 0x99, 0x08, 0x32, 0x44, 0x44, 0x34, 0x43, 0x24, 0x33, 0x33, 0x23, 0x13, 0x01, 0xa9, 0xdb,
+    0xbd, 0xbd, 0xbc, 0xdb, 0xba, 0xbb, 0xab, 0xab, 0x99, 0x18, 0x32, 0x55, 0x53, 0x43, 0x33, 0x34,
+    0x24, 0x33, 0x22, 0x12, 0x81, 0xa8, 0xdb, 0xcc, 0xbc, 0xdb, 0xbb, 0xcb, 0xbb, 0xba, 0xaa, 0x8a,
+    0x18, 0x42, 0x44, 0x34, 0x35, 0x43, 0x43, 0x32, 0x33, 0x22, 0x12, 0x81, 0xb8, 0xeb, 0xbc, 0xcc,
+    0xcb, 0xcb, 0xab, 0xcb, 0xaa, 0xa9, 0x98, 0x10, 0x31, 0x45, 0x43, 0x34, 0x34, 0x24, 0x33, 0x33,
+    0x23, 0x12, 0x81, 0xb9, 0xdc, 0xdb, 0xbc, 0xcb, 0xac, 0xcb, 0xaa, 0xab, 0xa9, 0x89, 0x10, 0x32,
+    0x36, 0x44, 0x43, 0x24, 0x43, 0x32, 0x32, 0x22, 0x02, 0x81, 0xb9, 0xcc, 0xcc, 0xdb, 0xbb, 0xdb,
+    0xba, 0xbb, 0xba, 0x9a, 0x99, 0x20, 0x43, 0x35, 0x45, 0x33, 0x34, 0x34, 0x33, 0x33, 0x23, 0x12,
+    0x90, 0xb9, 0xcd, 0xcc, 0xbc, 0xcb, 0xcb, 0xbb, 0xbb, 0xba, 0xaa, 0x89, 0x20, 0x53, 0x35, 0x44,
+    0x43, 0x43, 0x33, 0x33, 0x24, 0x22, 0x01, 0x80, 0xb9, 0xcc, 0xcc, 0xdb, 0xca, 0xba, 0xbb, 0xac,
+    0xaa, 0x9a, 0x88, 0x20, 0x52, 0x53, 0x43, 0x34, 0x24, 0x24, 0x23, 0x23, 0x22, 0x01, 0x80, 0xba,
+    0xcd, 0xdb, 0xdb, 0xca, 0xba, 0xbb, 0xbb, 0xbb, 0x9a, 0x09, 0x30, 0x63, 0x44, 0x43, 0x34, 0x43,
+    0x33, 0x24, 0x23, 0x22, 0x01, 0x88, 0xba, 0xcd, 0xbc, 0xcc, 0xbb, 0xbc, 0xbb, 0xac, 0xaa, 0x9a,
+    0x88, 0x21, 0x53, 0x44, 0x43, 0x34, 0x43, 0x33, 0x33, 0x24, 0x12, 0x01, 0x90, 0xba, 0xcd, 0xbc,
+    0xcc, 0xbb, 0xbc, 0xbb, 0xbb, 0xbb, 0x9a, 0x88, 0x22, 0x45, 0x44, 0x43, 0x34, 0x33, 0x34, 0x24,
+    0x22, 0x12, 0x01, 0x98, 0xba, 0xcd, 0xbc, 0xcc, 0xca, 0xba, 0xbb, 0xcb, 0x9a, 0x99, 0x08, 0x20,
+    0x44, 0x53, 0x43, 0x34, 0x33, 0x34, 0x33, 0x33, 0x22, 0x01, 0xa8, 0xda, 0xcc, 0xbc, 0xcc, 0xbb,
+    0xcb, 0xbb, 0xbb, 0xaa, 0x9a, 0x08, 0x32, 0x54, 0x44, 0x43, 0x24, 0x24, 0x33, 0x23, 0x33, 0x22,
+    0x00, 0x98, 0xdb, 0xcc, 0xbc, 0xcc, 0xca, 0xba, 0xab, 0xbb, 0xba, 0x99, 0x18, 0x41, 0x63, 0x43,
+    0x34, 0x34, 0x43, 0x33, 0x33, 0x33, 0x22, 0x81, 0xa8, 0xcc, 0xcc, 0xbc, 0xbc, 0xbc, 0xcb, 0xbb,
+    0xba, 0xaa, 0x99, 0x18, 0x32, 0x45, 0x44, 0x43, 0x43, 0x33, 0x34, 0x32, 0x32, 0x12, 0x00, 0xa9,
+    0xdb, 0xcc, 0xbc, 0xbc, 0xbc, 0xcb, 0xba, 0xab, 0xaa, 0x99, 0x10, 0x41, 0x44, 0x53, 0x43, 0x43,
+    0x33, 0x43, 0x23, 0x23, 0x11, 0x81, 0xa9, 0xdb, 0xcc, 0xbc, 0xbc, 0xbc, 0xbb, 0xac, 0xab, 0xaa,
+    0x89, 0x18, 0x42, 0x44, 0x53, 0x43, 0x43, 0x33, 0x33, 0x24, 0x23, 0x11, 0x00, 0xa9, 0xcc, 0xbc,
+    0xbd, 0xbc, 0xbc, 0xbb, 0xcb, 0xaa, 0xaa, 0x98, 0x10, 0x42, 0x44, 0x53, 0x43, 0x43, 0x42, 0x22,
+    0x23, 0x22, 0x11, 0x80, 0xa9, 0xcc, 0xbc, 0xbd, 0xbc, 0xcb, 0xbb, 0xac, 0xaa, 0x9a, 0x89, 0x10,
+    0x42, 0x44, 0x53, 0x43, 0x33, 0x34, 0x33, 0x24, 0x12, 0x02, 0x80, 0xa9, 0xcc, 0xbc, 0xbd, 0xbc,
+    0xcb, 0xbb, 0xbb, 0xbb, 0xaa, 0x89, 0x20, 0x63, 0x53, 0x34, 0x34, 0x34, 0x43, 0x23, 0x33, 0x22,
+    0x02, 0x80, 0xba, 0xcd, 0xbc, 0xbd, 0xbc, 0xcb, 0xba, 0xac, 0xaa, 0x99, 0x88, 0x10, 0x43, 0x44,
+    0x53, 0x33, 0x25, 0x33, 0x24, 0x23, 0x12, 0x11, 0x90, 0xb9, 0xcd, 0xdb, 0xcb, 0xbb, 0xad, 0xbb,
+    0xbb, 0xba, 0x9a, 0x09, 0x20, 0x44, 0x44, 0x34, 0x53, 0x33, 0x24, 0x33, 0x33, 0x22, 0x11, 0x98,
+    0xca, 0xcc, 0xbc, 0xbd, 0xcb, 0xcb, 0xab, 0xbb, 0xba, 0x9a, 0x88, 0x21, 0x44, 0x44, 0x34, 0x34,
+    0x43, 0x33, 0x24, 0x23, 0x12, 0x02, 0x98, 0xba, 0xcd, 0xcc, 0xbb, 0xbd, 0xbb, 0xac, 0xbb, 0xaa,
+    0x9a, 0x88, 0x31, 0x44, 0x44, 0x53, 0x33, 0x34, 0x43, 0x23, 0x23, 0x22, 0x01, 0x98, 0xca, 0xbd,
+    0xcc, 0xbc, 0xcb, 0xbb, 0xcb, 0xab, 0xba, 0x99, 0x08, 0x31, 0x44, 0x44, 0x53, 0x33, 0x34, 0x33,
+    0x34, 0x22, 0x12, 0x01, 0x98, 0xca, 0xdc, 0xcb, 0xcb, 0xcb, 0xbb, 0xac, 0xab, 0xaa, 0x99, 0x08,
+    0x31, 0x44, 0x44, 0x53, 0x33, 0x34, 0x33, 0x43, 0x22, 0x12, 0x01, 0xa8, 0xca, 0xbd, 0xcc, 0xcb,
+    0xac, 0xbb, 0xac, 0xba, 0x9a, 0x8a, 0x08, 0x22, 0x54, 0x43, 0x34, 0x44, 0x32, 0x33, 0x24, 0x22,
+    0x12, 0x81, 0x98, 0xdb, 0xdb, 0xdb, 0xbb, 0xbc, 0xbc, 0xba, 0xbb, 0xaa, 0x8a, 0x18, 0x41, 0x44,
+    0x34, 0x44, 0x43, 0x42, 0x22, 0x33, 0x22, 0x12, 0x00, 0xa9, 0xdb, 0xbc, 0xcd, 0xbb, 0xbc, 0xcb,
+    0xbb, 0xba, 0xaa, 0x99, 0x10, 0x32, 0x36, 0x45, 0x33, 0x44, 0x33, 0x33, 0x43, 0x22, 0x12, 0x80,
+    0xa8, 0xbc, 0xcd, 0xdb, 0xbb, 0xbc, 0xcb, 0xba, 0xab, 0xaa, 0x89, 0x18, 0x33, 0x36, 0x45, 0x33,
+    0x44, 0x32, 0x43, 0x22, 0x13, 0x12, 0x80, 0xa9, 0xdb, 0xcc, 0xcb, 0xbc, 0xcb, 0xbb, 0xbb, 0xbb,
+    0xab, 0x89, 0x10, 0x43, 0x45, 0x34, 0x35, 0x33, 0x25, 0x33, 0x23, 0x23, 0x11, 0x81, 0xaa, 0xbd,
+    0xcd, 0xdb, 0xbb, 0xcb, 0xcb, 0xba, 0xaa, 0xaa, 0x88, 0x10, 0x42, 0x44, 0x34, 0x44, 0x33, 0x43,
+    0x33, 0x33, 0x23, 0x12, 0x80, 0xba, 0xcd, 0xcc, 0xcb, 0xbc, 0xbb, 0xbc, 0xbb, 0xab, 0xaa, 0x89,
+    0x20, 0x53, 0x44, 0x34, 0x44, 0x33, 0x43, 0x33, 0x23, 0x23, 0x11, 0x80, 0xba, 0xcd, 0xcc, 0xcb,
+    0xbc, 0xbb, 0xbc, 0xba, 0xab, 0xaa, 0x09, 0x20, 0x53, 0x35, 0x44, 0x43, 0x33, 0x34, 0x33, 0x33,
+    0x23, 0x02, 0x90, 0xba, 0xce, 0xbc, 0xcc, 0xbb, 0xbc, 0xbb, 0xac, 0xab, 0x99, 0x09, 0x20, 0x53,
+    0x34, 0x35, 0x34, 0x34, 0x24, 0x33, 0x32, 0x12, 0x02, 0x90, 0xca, 0xeb, 0xcb, 0xbc, 0xbc, 0xcb,
+    0xab, 0xbb, 0xab, 0xaa, 0x88, 0x31, 0x44, 0x44, 0x34, 0x34, 0x34, 0x43, 0x32, 0x32, 0x12, 0x11,
+    0x98, 0xca, 0xeb, 0xcb, 0xbc, 0xbc, 0xbb, 0xbc, 0xab, 0xab, 0x9a, 0x88, 0x31, 0x44, 0x35, 0x44,
+    0x33, 0x44, 0x32, 0x32, 0x23, 0x13, 0x11, 0x98, 0xcb, 0xbd, 0xbd, 0xcc, 0xca, 0xba, 0xbb, 0xbb,
+    0xab, 0x9a, 0x08, 0x31, 0x45, 0x44, 0x43, 0x43, 0x43, 0x23, 0x33, 0x33, 0x22, 0x01, 0x98, 0xdb,
+    0xcc, 0xbc, 0xbc, 0xbc, 0xac, 0xbb, 0xbb, 0xab, 0x99, 0x08, 0x31, 0x45, 0x44, 0x43, 0x43, 0x43,
+    0x32, 0x33, 0x23, 0x22, 0x00, 0x98, 0xbc, 0xcd, 0xbc, 0xbc, 0xbc, 0xcb, 0xbb, 0xba, 0xba, 0x99,
+    0x00, 0x41, 0x53, 0x44, 0x43, 0x43, 0x33, 0x34, 0x32, 0x23, 0x12, 0x01, 0x99, 0xbc, 0xbe, 0xbc,
+    0xbd, 0xcb, 0xbb, 0xcb, 0xaa, 0xaa, 0x99, 0x00, 0x32, 0x54, 0x53, 0x43, 0x43, 0x33, 0x24, 0x23,
+    0x23, 0x12, 0x81, 0xa8, 0xbc, 0xbe, 0xbc, 0xbd, 0xcb, 0xbb, 0xbb, 0xbb, 0xab, 0x99, 0x00, 0x43,
+    0x35, 0x45, 0x43, 0x43, 0x33, 0x43, 0x32, 0x22, 0x12, 0x80, 0xa8, 0xcc, 0xbc, 0xbd, 0xbc, 0xcb,
+    0xcb, 0xba, 0xaa, 0xaa, 0x89, 0x18, 0x42, 0x34, 0x45, 0x43, 0x33, 0x34, 0x24, 0x23, 0x22, 0x11,
+    0x81, 0xa9, 0xcc, 0xdb, 0xbc, 0xbc, 0xcb, 0xbb, 0xac, 0xab, 0xa9, 0x89, 0x10, 0x42, 0x44, 0x53,
+    0x33, 0x35, 0x33, 0x43, 0x23, 0x23, 0x11, 0x80, 0xb9, 0xcc, 0xcc, 0xbc, 0xdb, 0xca, 0xaa, 0xbb,
+    0xaa, 0xaa, 0x09, 0x28, 0x42, 0x35, 0x35, 0x34, 0x34, 0x43, 0x23, 0x33, 0x22, 0x12, 0x80, 0xba,
+    0xdc, 0xbc, 0xbd, 0xbc, 0xcb, 0xca, 0xaa, 0xaa, 0xa9, 0x88, 0x10, 0x43, 0x34, 0x45, 0x33, 0x44,
+    0x32, 0x33, 0x33, 0x23, 0x11, 0x80, 0xba, 0xbe, 0xcd, 0xcb, 0xbb, 0xad, 0xbb, 0xbb, 0xab, 0xaa,
+    0x88, 0x20, 0x44, 0x34, 0x45, 0x33, 0x34, 0x34, 0x23, 0x33, 0x23, 0x11, 0x88, 0xca, 0xcc, 0xbc,
+    0xcc, 0xcb, 0xbb, 0xcb, 0xba, 0xaa, 0x9a, 0x09, 0x20, 0x53, 0x44, 0x34, 0x53, 0x33, 0x43, 0x23,
+    0x33, 0x22, 0x11, 0x98, 0xba, 0xce, 0xcb, 0xbc, 0xbc, 0xbc, 0xca, 0xaa, 0xaa, 0x99, 0x08, 0x20,
+    0x43, 0x35, 0x35, 0x53, 0x33, 0x33, 0x34, 0x32, 0x22, 0x01, 0x90, 0xbb, 0xce, 0xdb, 0xbb, 0xcc,
+    0xbb, 0xbb, 0xbb, 0xbb, 0x9a, 0x09, 0x31, 0x45, 0x44, 0x53, 0x33, 0x34, 0x33, 0x34, 0x22, 0x13,
+    0x01, 0x98, 0xca, 0xcc, 0xbc, 0xbd, 0xcb, 0xbb, 0xcb, 0xba, 0xaa, 0x99, 0x08, 0x21, 0x44, 0x44,
+    0x53, 0x33, 0x53, 0x32, 0x23, 0x33, 0x12, 0x01, 0x98, 0xcb, 0xcd, 0xcb, 0xbc, 0xbc, 0xbb, 0xbc,
+    0xab, 0xab, 0x99, 0x08, 0x32, 0x54, 0x34, 0x44, 0x43, 0x33, 0x43, 0x23, 0x23, 0x12, 0x01, 0xa8,
+    0xcb, 0xcd, 0xcb, 0xbc, 0xbc, 0xbb, 0xac, 0xab, 0x9b, 0x8a, 0x08, 0x32, 0x54, 0x34, 0x44, 0x33,
+    0x34, 0x24, 0x33, 0x22, 0x12, 0x81, 0xa8, 0xcb, 0xcd, 0xcb, 0xbc, 0xcb, 0xcb, 0xba, 0xba, 0x9a,
+    0x8a, 0x18, 0x32, 0x54, 0x34, 0x44, 0x33, 0x34, 0x24, 0x32, 0x22, 0x12, 0x81, 0xa8, 0xdb, 0xcc,
+    0xcb, 0xbc, 0xcb, 0xbb, 0xac, 0xab, 0x9a, 0x99, 0x00, 0x42, 0x53, 0x34, 0x44, 0x33, 0x34, 0x33,
+    0x24, 0x22, 0x02, 0x81, 0xa8, 0xbc, 0xcd, 0xcb, 0xbc, 0xcb, 0xbb, 0xbb, 0xbb, 0xab, 0x8a, 0x10,
+    0x43, 0x45, 0x34, 0x44, 0x33, 0x34, 0x33, 0x33, 0x23, 0x22, 0x80, 0xb9, 0xcd, 0xcc, 0xcb, 0xdb,
+    0xba, 0xcb, 0xba, 0xba, 0xa9, 0x89, 0x10, 0x42, 0x44, 0x34, 0x34, 0x25, 0x33, 0x24, 0x23, 0x22,
+    0x11, 0x80, 0xa9, 0xcc, 0xcc, 0xcb, 0xcb, 0xac, 0xbb, 0xbb, 0xab, 0x9b, 0x89, 0x10, 0x53, 0x44,
+    0x34, 0x34, 0x44, 0x32, 0x33, 0x23, 0x23, 0x12, 0x90, 0xb9, 0xcd, 0xcc, 0xcb, 0xac, 0xac, 0xbb,
+    0xba, 0xbb, 0x9a, 0x89, 0x20, 0x53, 0x44, 0x34, 0x34, 0x34, 0x24, 0x33, 0x33, 0x22, 0x02, 0x80,
+    0xba, 0xcd, 0xcc, 0xcb, 0xcb, 0xcb, 0xba, 0xbb, 0xba, 0x9a, 0x09, 0x20, 0x53, 0x35, 0x44, 0x33,
+    0x35, 0x42, 0x32, 0x22, 0x22, 0x01, 0x80, 0xba, 0xcd, 0xdb, 0xcb, 0xcb, 0xbb, 0xac, 0xbb, 0xba,
+    0xa9, 0x88, 0x21, 0x63, 0x53, 0x43, 0x53, 0x32, 0x24, 0x23, 0x23, 0x13, 0x11, 0x88, 0xca, 0xcc,
+    0xdb, 0xcb, 0xcb, 0xbb, 0xcb, 0xba, 0xaa, 0x9a, 0x09, 0x21, 0x63, 0x53, 0x43, 0x43, 0x24, 0x33,
+    0x33, 0x24, 0x21, 0x01, 0x98, 0xc9, 0xdb, 0xbc, 0xbc, 0xbc, 0xbc, 0xbb, 0xbb, 0xab, 0x9a, 0x08,
+    0x21, 0x45, 0x34, 0x35, 0x34, 0x24, 0x24, 0x32, 0x22, 0x22, 0x00, 0x90, 0xbb, 0xbe, 0xbd, 0xbc,
+    0xbc, 0xbc, 0xba, 0xbb, 0xab, 0x9a, 0x08, 0x31, 0x45, 0x34, 0x35, 0x34, 0x43, 0x33, 0x24, 0x22,
+    0x12, 0x01, 0x98, 0xbb, 0xbe, 0xbd, 0xbc, 0xbc, 0xac, 0xbb, 0xab, 0xab, 0x9a, 0x00, 0x31, 0x45,
+    0x34, 0x35, 0x34, 0x43, 0x33, 0x33, 0x33, 0x22, 0x01, 0xa9, 0xeb, 0xdb, 0xbc, 0xbc, 0xbc, 0xcb,
+    0xba, 0xab, 0xab, 0x99, 0x18, 0x41, 0x53, 0x44, 0x43, 0x43, 0x33, 0x43, 0x23, 0x23, 0x12, 0x01,
+    0x99, 0xbc, 0xcd, 0xbc, 0xbc, 0xbc, 0xbb, 0xac, 0xbb, 0xaa, 0x89, 0x18, 0x41, 0x63, 0x43, 0x53,
+    0x33, 0x43, 0x43, 0x22, 0x22, 0x12, 0x00, 0x99, 0xdb, 0xbc, 0xbd, 0xbc, 0xcb, 0xcb, 0xba, 0xba,
+    0xaa, 0x89, 0x00, 0x42, 0x63, 0x43, 0x53, 0x42, 0x32, 0x33, 0x33, 0x33, 0x12, 0x81, 0xb9, 0xdc,
+    0xbc, 0xcc, 0xcb, 0xcb, 0xbb, 0xbb, 0xab, 0xab, 0x89, 0x10, 0x52, 0x34, 0x45, 0x33, 0x35, 0x33,
+    0x43, 0x23, 0x23, 0x12, 0x80, 0xb9, 0xcc, 0xcc, 0xdb, 0xbb, 0xbc, 0xcb, 0xba, 0xab, 0xaa, 0x98,
+    0x10, 0x43, 0x44, 0x44, 0x33, 0x25, 0x43, 0x32, 0x32, 0x22, 0x02, 0x91, 0xa9, 0xcc, 0xbd, 0xbc,
+    0xbc, 0xbc, 0xcb, 0xba, 0xaa, 0xaa, 0x09, 0x10, 0x42, 0x35, 0x44, 0x53, 0x32, 0x24, 0x33, 0x32,
+    0x23, 0x11, 0x90, 0xb9, 0xcd, 0xdb, 0xbc, 0xcb, 0xcb, 0xbb, 0xbb, 0xab, 0x9b, 0x89, 0x11, 0x34,
+    0x36, 0x35, 0x34, 0x43, 0x43, 0x23, 0x23, 0x13, 0x02, 0x80, 0xba, 0xdc, 0xbc, 0xbd, 0xcb, 0xcb,
+    0xab, 0xbb, 0xbb, 0x9a, 0x09, 0x20, 0x34, 0x36, 0x35, 0x53, 0x33, 0x43, 0x33, 0x23, 0x13, 0x02,
+    0x80, 0xca, 0xcc, 0xbc, 0xcc, 0xcb, 0xca, 0xaa, 0xab, 0xab, 0xa9, 0x08, 0x20, 0x53, 0x44, 0x53,
+    0x33, 0x34, 0x43, 0x23, 0x33, 0x22, 0x01, 0x90, 0xca, 0xcc, 0xbc, 0xcc, 0xbb, 0xbc, 0xcb, 0xba,
+    0xaa, 0x99, 0x88, 0x21, 0x63, 0x43, 0x34, 0x44, 0x32, 0x24, 0x33, 0x22, 0x13, 0x11, 0x98, 0xbb,
+    0xce, 0xcb, 0xbc, 0xbc, 0xcb, 0xab, 0xbb, 0xab, 0x9a, 0x08, 0x21, 0x45, 0x53, 0x53, 0x33, 0x53,
+    0x32, 0x33, 0x32, 0x22, 0x01, 0x98, 0xcb, 0xbd, 0xbd, 0xbd, 0xbb, 0xad, 0xbb, 0xba, 0xab, 0x99,
+    0x08, 0x31, 0x54, 0x53, 0x53, 0x33, 0x43, 0x43, 0x32, 0x22, 0x12, 0x01, 0xa8, 0xca, 0xcc, 0xbc,
+    0xcc, 0xbb, 0xcb, 0xbb, 0xbb, 0xab, 0x99, 0x08, 0x32, 0x45, 0x44, 0x43, 0x34, 0x33, 0x34, 0x33,
+    0x32, 0x22, 0x00, 0xa8, 0xdb, 0xcc, 0xbc, 0xcc, 0xbb, 0xcb, 0xbb, 0xba, 0xba, 0x99, 0x00, 0x32,
+    0x45, 0x44, 0x43, 0x24, 0x24, 0x23, 0x33, 0x23, 0x22, 0x00, 0x99, 0xcc, 0xdb, 0xbc, 0xcc, 0xca,
+    0xba, 0xba, 0xab, 0xab, 0x89, 0x18, 0x41, 0x44, 0x53, 0x43, 0x43, 0x43, 0x32, 0x23, 0x23, 0x12,
+    0x81, 0xa9, 0xeb, 0xdb, 0xcb, 0xbc, 0xcb, 0xbb, 0xcb, 0xaa, 0xaa, 0x98, 0x00, 0x32, 0x45, 0x34,
+    0x44, 0x33, 0x34, 0x33, 0x33, 0x33, 0x12, 0x81, 0xb9, 0xdc, 0xbc, 0xbd, 0xbc, 0xbc, 0xcb, 0xba,
+    0xba, 0x9a, 0x89, 0x18, 0x42, 0x44, 0x53, 0x43, 0x43, 0x33, 0x43, 0x23, 0x22, 0x02, 0x81, 0xb9,
+    0xeb, 0xdb, 0xcb, 0xbc, 0xbb, 0xbc, 0xbb, 0xbb, 0xaa, 0x8a, 0x20, 0x43, 0x45, 0x34, 0x34, 0x34,
+    0x34, 0x33, 0x23, 0x23, 0x12, 0x91, 0xb9, 0xcd, 0xbc, 0xbd, 0xbc, 0xbc, 0xbb, 0xbb, 0xbb, 0xab,
+    0x89, 0x20, 0x63, 0x53, 0x34, 0x34, 0x34, 0x34, 0x32, 0x33, 0x32, 0x11, 0x80, 0xba, 0xcd, 0xbc,
+    0xbd, 0xbc, 0xcb, 0xbb, 0xac, 0xaa, 0xa9, 0x88, 0x10, 0x43, 0x44, 0x34, 0x34, 0x34, 0x43, 0x33,
+    0x32, 0x22, 0x02, 0x80, 0xba, 0xcd, 0xcc, 0xcb, 0xcb, 0xbb, 0xbc, 0xba, 0xab, 0x9a, 0x09, 0x20,
+    0x63, 0x43, 0x44, 0x43, 0x33, 0x34, 0x32, 0x33, 0x23, 0x11, 0x90, 0xca, 0xcc, 0xcc, 0xcb, 0xcb,
+    0xbb, 0xcb, 0xab, 0xba, 0xa9, 0x08, 0x20, 0x63, 0x53, 0x43, 0x43, 0x43, 0x33, 0x33, 0x24, 0x21,
+    0x01, 0x90, 0xba, 0xdc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbb, 0xbb, 0xab, 0xaa, 0x88, 0x31, 0x45, 0x53,
+    0x34, 0x34, 0x43, 0x43, 0x32, 0x22, 0x22, 0x01, 0x98, 0xba, 0xbe, 0xbd, 0xbc, 0xbc, 0xac, 0xbb,
+    0xbb, 0xbb, 0x9a, 0x08, 0x31, 0x54, 0x34, 0x35, 0x34, 0x43, 0x33, 0x24, 0x32, 0x21, 0x10, 0x98,
+    0xbb, 0xbe, 0xbd, 0xbc, 0xbc, 0xcb, 0xbb, 0xab, 0xab, 0x9a, 0x08, 0x31, 0x45, 0x34, 0x35, 0x34,
+    0x43, 0x33, 0x33, 0x33, 0x22, 0x01, 0x98, 0xcc, 0xcc, 0xdb, 0xbb, 0xad, 0xcb, 0xba, 0xaa, 0x9b,
+    0x9a, 0x00, 0x31, 0x44, 0x35, 0x34, 0x34, 0x34, 0x43, 0x32, 0x22, 0x12, 0x00, 0x98, 0xdb, 0xdb,
+    0xbc, 0xdb, 0xbb, 0xbc, 0xab, 0xbb, 0xab, 0x9a, 0x00, 0x42, 0x44, 0x34, 0x35, 0x43, 0x43, 0x33,
+    0x32, 0x33, 0x12, 0x01, 0xa9, 0xeb, 0xbc, 0xcc, 0xcb, 0xac, 0xbb, 0xbb, 0xac, 0x9a, 0x99, 0x00,
+    0x22, 0x45, 0x43, 0x34, 0x34, 0x34, 0x33, 0x33, 0x33, 0x12, 0x01, 0xb9, 0xcc, 0xbd, 0xbd, 0xbc,
+    0xcb, 0xbb, 0xac, 0xab, 0x9a, 0x8a, 0x00, 0x42, 0x63, 0x43, 0x43, 0x34, 0x33, 0x43, 0x33, 0x22,
+    0x12, 0x81, 0xa9, 0xcc, 0xcc, 0xbc, 0xdb, 0xca, 0xba, 0xba, 0xba, 0xaa, 0x89, 0x10, 0x42, 0x44,
+    0x34, 0x35, 0x43, 0x33, 0x24, 0x23, 0x23, 0x11, 0x81, 0xb9, 0xeb, 0xbc, 0xbd, 0xdb, 0xba, 0xac,
+    0xab, 0xab, 0xaa, 0x98, 0x10, 0x43, 0x44, 0x44, 0x33, 0x44, 0x32, 0x33, 0x43, 0x12, 0x02, 0x80,
+    0xa9, 0xbc, 0xbe, 0xbc, 0xbc, 0xbc, 0xbb, 0xac, 0xab, 0x9a, 0x89, 0x20, 0x42, 0x35, 0x44, 0x43,
+    0x24, 0x33, 0x43, 0x32, 0x12, 0x02, 0x80, 0xb9, 0xcc, 0xcc, 0xdb, 0xbb, 0xcb, 0xbb, 0xac, 0xba,
+    0x99, 0x89, 0x20, 0x52, 0x53, 0x53, 0x33, 0x34, 0x24, 0x33, 0x33, 0x32, 0x11, 0x90, 0xba, 0xbe,
+    0xbd, 0xbd, 0xcb, 0xcb, 0xba, 0xbb, 0xba, 0x9a, 0x89, 0x21, 0x63, 0x53, 0x53, 0x33, 0x34, 0x43,
+    0x33, 0x32, 0x22, 0x02, 0x90, 0xba, 0xbe, 0xcd, 0xbb, 0xcc, 0xab, 0xac, 0xab, 0xaa, 0x9a, 0x88,
+    0x11, 0x34, 0x45, 0x53, 0x33, 0x34, 0x43, 0x32, 0x23, 0x22, 0x11, 0x98, 0xca, 0xcc, 0xdb, 0xcb,
+    0xac, 0xcb, 0xba, 0xba, 0xba, 0xa9, 0x08, 0x21, 0x44, 0x34, 0x35, 0x44, 0x32, 0x24, 0x23, 0x23,
+    0x22, 0x01, 0x98, 0xca, 0xcc, 0xbc, 0xcc, 0xbb, 0xcb, 0xcb, 0xaa, 0xaa, 0x99, 0x08, 0x20, 0x44,
+    0x53, 0x43, 0x34, 0x43, 0x32, 0x24, 0x22, 0x12, 0x01, 0x98, 0xca, 0xbc, 0xbd, 0xcc, 0xbb, 0xcb,
+    0xbb, 0xbb, 0xbb, 0xa9, 0x18, 0x31, 0x45, 0x44, 0x43, 0x34, 0x33, 0x34, 0x33, 0x23, 0x13, 0x11,
+    0x99, 0xbc, 0xbe, 0xcc, 0xcb, 0xcb, 0xba, 0xac, 0xba, 0x9a, 0x8a, 0x08, 0x31, 0x44, 0x44, 0x43,
+    0x43, 0x43, 0x23, 0x33, 0x23, 0x13, 0x01, 0x99, 0xbc, 0xbe, 0xcc, 0xcb, 0xbb, 0xbc, 0xbb, 0xac,
+    0x9a, 0x99, 0x18, 0x31, 0x44, 0x44, 0x43, 0x43, 0x43, 0x32, 0x23, 0x23, 0x22, 0x81, 0xa8, 0xbc,
+    0xbe, 0xcc, 0xcb, 0xbb, 0xbc, 0xbb, 0xbb, 0xaa, 0x9a, 0x10, 0x42, 0x44, 0x44, 0x43, 0x43, 0x33,
+    0x24, 0x33, 0x22, 0x22, 0x00, 0xa9, 0xcc, 0xbc, 0xbd, 0xbc, 0xbc, 0xcb, 0xba, 0xab, 0xaa, 0x89,
+    0x18, 0x42, 0x44, 0x53, 0x43, 0x43, 0x33, 0x43, 0x23, 0x32, 0x11, 0x81, 0xa9, 0xcc, 0xbc, 0xbd,
+    0xbc, 0xbc, 0xbb, 0xac, 0xab, 0xaa, 0x98, 0x10, 0x42, 0x44, 0x53, 0x43, 0x43, 0x33, 0x33, 0x24,
+    0x13, 0x12, 0x80, 0xa9, 0xcc, 0xbc, 0xbd, 0xbc, 0xac, 0xac, 0xba, 0xaa, 0x9a, 0x89, 0x28, 0x42,
+    0x44, 0x53, 0x43, 0x33, 0x34, 0x24, 0x32, 0x12, 0x12, 0x90, 0xa9, 0xcc, 0xbc, 0xbd, 0xbc, 0xcb,
+    0xbb, 0xac, 0xaa, 0x9a, 0x89, 0x10, 0x43, 0x44, 0x53, 0x43, 0x33, 0x34, 0x33, 0x43, 0x12, 0x02,
+    0x80, 0xb9, 0xcc, 0xbc, 0xbd, 0xbc, 0xcb, 0xbb, 0xbb, 0xbb, 0xaa, 0x89, 0x11, 0x44, 0x44, 0x34,
+    0x34, 0x34, 0x43, 0x32, 0x33, 0x22, 0x11, 0x90, 0xba, 0xcd, 0xcc, 0xcb, 0xcb, 0xbb, 0xcb, 0xab,
+    0xab, 0xaa, 0x88, 0x21, 0x53, 0x44, 0x34, 0x34, 0x34, 0x33, 0x24, 0x33, 0x22, 0x01, 0x80, 0xbb,
+    0xcd, 0xcc, 0xcb, 0xcb, 0xbb, 0xcb, 0xba, 0xaa, 0x9a, 0x09, 0x30, 0x53, 0x44, 0x34, 0x34, 0x53,
+    0x32, 0x33, 0x32, 0x22, 0x11, 0x90, 0xcb, 0xcc, 0xcc, 0xcb, 0xbb, 0xbc, 0xac, 0xab, 0xaa, 0x9a,
+    0x08, 0x30, 0x63, 0x53, 0x43, 0x43, 0x43, 0x23, 0x43, 0x22, 0x21, 0x10, 0x98, 0xba, 0xcd, 0xdb,
+    0xcb, 0xbb, 0xbc, 0xcb, 0xaa, 0x9b, 0x9a, 0x08, 0x21, 0x44, 0x53, 0x34, 0x34, 0x43, 0x33, 0x43,
+    0x22, 0x12, 0x01, 0x98, 0xca, 0xbc, 0xcd, 0xcb, 0xbb, 0xbc, 0xbb, 0xbb, 0xbb, 0x9a, 0x08, 0x32,
+    0x36, 0x45, 0x33, 0x35, 0x43, 0x33, 0x33, 0x33, 0x23, 0x01, 0x99, 0xcc, 0xbc, 0xcd, 0xbb, 0xad,
+    0xcb, 0xaa, 0xab, 0x9b, 0x8a, 0x08, 0x31, 0x54, 0x53, 0x43, 0x43, 0x33, 0x43, 0x23, 0x23, 0x22,
+    0x01, 0x99, 0xbc, 0xcd, 0xbc, 0xdb, 0xbb, 0xac, 0xbb, 0xbb, 0xab, 0x8a, 0x08, 0x42, 0x44, 0x34,
+    0x35, 0x43, 0x43, 0x33, 0x32, 0x33, 0x12, 0x01, 0xa9, 0xcc, 0xcc, 0xdb, 0xbb, 0xbc, 0xbc, 0xba,
+    0xbb, 0xaa, 0x99, 0x18, 0x42, 0x44, 0x34, 0x35, 0x43, 0x43, 0x32, 0x33, 0x32, 0x12, 0x81, 0xa9,
+    0xcc, 0xcc, 0xdb, 0xbb, 0xbc, 0xac, 0xbb, 0xba, 0xaa, 0x99, 0x10, 0x42, 0x44, 0x34, 0x44, 0x43,
+    0x32, 0x24, 0x32, 0x22, 0x12, 0x80, 0xa9, 0xeb, 0xcb, 0xbc, 0xad, 0xcb, 0xab, 0xbb, 0xbb, 0xaa,
+    0x8a, 0x10, 0x53, 0x63, 0x43, 0x43, 0x43, 0x43, 0x32, 0x32, 0x22, 0x12, 0x80, 0xb9, 0xcc, 0xcc,
+    0xcb, 0xbc, 0xcb, 0xbb, 0xbb, 0xbb, 0xab, 0x99, 0x11, 0x53, 0x44, 0x34, 0x35, 0x43, 0x33, 0x43,
+    0x22, 0x23, 0x11, 0x80, 0xb9, 0xcc, 0xcc, 0xdb, 0xbb, 0xdb, 0xba, 0xab, 0xab, 0xaa, 0x89, 0x20,
+    0x53, 0x34, 0x45, 0x33, 0x34, 0x34, 0x32, 0x33, 0x33, 0x11, 0x80, 0xba, 0xdd, 0xcb, 0xbc, 0xbc,
+    0xbc, 0xbb, 0xcb, 0xaa, 0x9a, 0x09, 0x10, 0x53, 0x53, 0x53, 0x33, 0x34, 0x24, 0x33, 0x33, 0x22,
+    0x12, 0x88, 0xbb, 0xcd, 0xcc, 0xdb, 0xca, 0xba, 0xbb, 0xbb, 0xbb, 0xaa, 0x89, 0x21, 0x44, 0x35,
+    0x44, 0x43, 0x33, 0x34, 0x33, 0x33, 0x23, 0x12, 0x90, 0xcb, 0xcc, 0xcc, 0xcb, 0xac, 0xcb, 0xab,
+    0xbb, 0xaa, 0x9a, 0x09, 0x30, 0x63, 0x53, 0x53, 0x33, 0x34, 0x33, 0x34, 0x32, 0x22, 0x11, 0x98,
+    0xbb, 0xbe, 0xbd, 0xad, 0xbc, 0xca, 0xba, 0xba, 0xab, 0x99, 0x09, 0x31, 0x63, 0x53, 0x53, 0x42,
+    0x32, 0x24, 0x23, 0x23, 0x22, 0x01, 0x98, 0xbb, 0xbe, 0xbd, 0xad, 0xac, 0xbb, 0xac, 0xab, 0xab,
+    0x99, 0x08, 0x21, 0x44, 0x44, 0x43, 0x24, 0x24, 0x33, 0x33, 0x33, 0x23, 0x01, 0x98, 0xdb, 0xcc,
+    0xbc, 0xcc, 0xca, 0xba, 0xbb, 0xbb, 0xab, 0x9a, 0x08, 0x31, 0x45, 0x44, 0x43, 0x24, 0x24, 0x33,
+    0x33, 0x23, 0x22, 0x01, 0x98, 0xdb, 0xbd, 0xcc, 0xcb, 0xbb, 0xbc, 0xac, 0xaa, 0xaa, 0x99, 0x08,
+    0x22, 0x44, 0x44, 0x43, 0x43, 0x43, 0x23, 0x33, 0x23, 0x22, 0x01, 0xa9, 0xdb, 0xcc, 0xbc, 0xbc,
+    0xbc, 0xac, 0xbb, 0xab, 0xab, 0x99, 0x18, 0x32, 0x45, 0x44, 0x43, 0x43, 0x43, 0x32, 0x23, 0x23,
+    0x22, 0x00, 0xa9, 0xdb, 0xcc, 0xbc, 0xbc, 0xbc, 0xcb, 0xab, 0xbb, 0xaa, 0x99, 0x10, 0x32, 0x55,
+    0x43, 0x34, 0x53, 0x32, 0x43, 0x32, 0x22, 0x11, 0x81, 0xa9, 0xcb, 0xcd, 0xcb, 0xcb, 0xac, 0xbb,
+    0xcb, 0xaa, 0x9a, 0x8a, 0x10, 0x32, 0x35, 0x36, 0x53, 0x33, 0x34, 0x33, 0x33, 0x33, 0x12, 0x81,
+    0xb9, 0xdc, 0xbc, 0xbd, 0xbc, 0xbc, 0xbb, 0xac, 0xab, 0x9a, 0x99, 0x10, 0x33, 0x55, 0x43, 0x34,
+    0x43, 0x43, 0x23, 0x33, 0x22, 0x12, 0x00, 0xaa, 0xdc, 0xdb, 0xcb, 0xcb, 0xcb, 0xbb, 0xbb, 0xba,
+    0x9b, 0x8a, 0x10, 0x53, 0x44, 0x34, 0x34, 0x34, 0x24, 0x33, 0x33, 0x23, 0x12, 0x80, 0xb9, 0xbe,
+    0xbd, 0xcc, 0xbb, 0xbc, 0xcb, 0xba, 0xba, 0x9a, 0x89, 0x20, 0x52, 0x63, 0x33, 0x35, 0x43, 0x33,
+    0x24, 0x23, 0x22, 0x02, 0x80, 0xaa, 0xbd, 0xbe, 0xdb, 0xbb, 0xbc, 0xbb, 0xac, 0xab, 0xa9, 0x09,
+    0x20, 0x52, 0x34, 0x35, 0x34, 0x34, 0x43, 0x32, 0x23, 0x23, 0x11, 0x90, 0xc9, 0xdb, 0xcc, 0xcb,
+    0xcb, 0xbb, 0xcb, 0xab, 0xab, 0x9a, 0x89, 0x11, 0x44, 0x53, 0x34, 0x34, 0x34, 0x33, 0x24, 0x33,
+    0x22, 0x01, 0x90, 0xc9, 0xbc, 0xcd, 0xcb, 0xcb, 0xbb, 0xbb, 0xbc, 0xaa, 0x9a, 0x09, 0x11, 0x44,
+    0x63, 0x33, 0x44, 0x33, 0x43, 0x33, 0x32, 0x22, 0x11, 0x90, 0xcb, 0xcc, 0xbc, 0xbd, 0xcb, 0xcb,
+    0xba, 0xbb, 0xba, 0xa9, 0x88, 0x31, 0x44, 0x44, 0x53, 0x33, 0x34, 0x24, 0x33, 0x32, 0x22, 0x01,
+    0xa0, 0xca, 0xcc, 0xbc, 0xbd, 0xcb, 0xcb, 0xba, 0xba, 0xba, 0xa9, 0x08, 0x31, 0x44, 0x44, 0x34,
+    0x53, 0x32, 0x24, 0x33, 0x22, 0x13, 0x11, 0x99, 0xca, 0xdc, 0xcb, 0xcb, 0xac, 0xcb, 0xba, 0xba,
+    0xaa, 0x99, 0x19, 0x21, 0x54, 0x53, 0x43, 0x43, 0x33, 0x24, 0x33, 0x23, 0x13, 0x01, 0x98, 0xbc,
+    0xcd, 0xdb, 0xbb, 0xad, 0xcb, 0xaa, 0xab, 0xaa, 0x9a, 0x00, 0x31, 0x35, 0x45, 0x43, 0x33, 0x25,
+    0x33, 0x33, 0x33, 0x22, 0x01, 0xa9, 0xcc, 0xbc, 0xbe, 0xcb, 0xcb, 0xbb, 0xbb, 0xcb, 0x9a, 0x8a,
+    0x18, 0x31, 0x54, 0x53, 0x43, 0x33, 0x34, 0x24, 0x33, 0x22, 0x22, 0x00, 0x99, 0xbc, 0xcd, 0xbc,
+    0xdb, 0xbb, 0xcb, 0xbb, 0xab, 0xab, 0x99, 0x00, 0x33, 0x36, 0x36, 0x43, 0x43, 0x43, 0x23, 0x33,
+    0x23, 0x12, 0x81, 0xa9, 0xcc, 0xcc, 0xdb, 0xbb, 0xbc, 0xcb, 0xbb, 0xba, 0xaa, 0x8a, 0x10, 0x42,
+    0x44, 0x34, 0x35, 0x43, 0x33, 0x34, 0x32, 0x23, 0x12, 0x80, 0xa9, 0xcc, 0xcc, 0xdb, 0xbb, 0xbc,
+    0xcb, 0xba, 0xab, 0xaa, 0x99, 0x10, 0x43, 0x44, 0x34, 0x35, 0x43, 0x33, 0x24, 0x23, 0x23, 0x21,
+    0x80, 0xb9, 0xdc, 0xdb, 0xbb, 0xbd, 0xcb, 0xbb, 0xbb, 0xcb, 0xa9, 0x09, 0x18, 0x33, 0x36, 0x35,
+    0x53, 0x33, 0x34, 0x33, 0x33, 0x33, 0x02, 0x91, 0xb9, 0xbe, 0xbd, 0xbd, 0xcb, 0xcb, 0xbb, 0xbb,
+    0xbb, 0xaa, 0x89, 0x20, 0x53, 0x35, 0x35, 0x53, 0x33, 0x24, 0x33, 0x33, 0x33, 0x02, 0x80, 0xba,
+    0xdd, 0xdb, 0xbb, 0xbd, 0xbb, 0xbc, 0xbb, 0xbb, 0xaa, 0x88, 0x20, 0x34, 0x36, 0x35, 0x53, 0x33,
+    0x43, 0x33, 0x23, 0x23, 0x02, 0x80, 0xca, 0xbc, 0xcd, 0xbc, 0xcb, 0xbb, 0xbc, 0xab, 0xbb, 0x9a,
+    0x09, 0x21, 0x53, 0x35, 0x35, 0x53, 0x33, 0x43, 0x32, 0x33, 0x22, 0x02, 0x90, 0xca, 0xcc, 0xdb,
+    0xdb, 0xba, 0xbc, 0xba, 0xcb, 0x9a, 0x9a, 0x88, 0x11, 0x34, 0x44, 0x34, 0x34, 0x34, 0x24, 0x23,
+    0x33, 0x22, 0x01, 0x90, 0xca, 0xcc, 0xdb, 0xdb, 0xba, 0xac, 0xbb, 0xbb, 0xab, 0x9a, 0x09, 0x31,
+    0x44, 0x35, 0x35, 0x43, 0x43, 0x33, 0x33, 0x24, 0x12, 0x11, 0x98, 0xbb, 0xcd, 0xbc, 0xcc, 0xbb,
+    0xdb, 0xba, 0xba, 0xaa, 0x9a, 0x80, 0x31, 0x63, 0x34, 0x44, 0x33, 0x25, 0x33, 0x33, 0x33, 0x23,
+    0x11, 0xa8, 0xdb, 0xcc, 0xdb, 0xcb, 0xcb, 0xbb, 0xcb, 0xaa, 0xab, 0x99, 0x08, 0x22, 0x44, 0x44,
+    0x43, 0x24, 0x24, 0x33, 0x33, 0x23, 0x13, 0x11, 0xa9, 0xdb, 0xcc, 0xdb, 0xcb, 0xcb, 0xab, 0xac,
+    0xba, 0x9a, 0x8a, 0x08, 0x22, 0x35, 0x35, 0x44, 0x33, 0x34, 0x43, 0x32, 0x23, 0x12, 0x81, 0xa8,
+    0xdb, 0xbc, 0xbd, 0xcc, 0xba, 0xac, 0xbb, 0xbb, 0xaa, 0x8a, 0x08, 0x33, 0x45, 0x44, 0x43, 0x43,
+    0x33, 0x34, 0x23, 0x23, 0x22, 0x00, 0xa9, 0xdb, 0xcc, 0xbc, 0xbc, 0xbc, 0xcb, 0xab, 0xbb, 0xaa,
+    0x99, 0x10, 0x32, 0x36, 0x35, 0x34, 0x35, 0x33, 0x43, 0x23, 0x23, 0x12, 0x81, 0xa9, 0xeb, 0xdb,
+    0xcb, 0xac, 0xac, 0xbb, 0xac, 0xba, 0xa9, 0x89, 0x00, 0x32, 0x45, 0x34, 0x44, 0x42, 0x32, 0x33,
+    0x24, 0x22, 0x12, 0x80, 0xa9, 0xeb, 0xcb, 0xdb, 0xcb, 0xbb, 0xcb, 0xbb, 0xab, 0x9b, 0x99, 0x10,
+    0x43, 0x44, 0x44, 0x43, 0x43, 0x42, 0x22, 0x23, 0x13, 0x12, 0x80, 0xb9, 0xeb, 0xdb, 0xcb, 0xdb,
+    0xba, 0xbb, 0xac, 0xab, 0x9a, 0x89, 0x10, 0x33, 0x36, 0x35, 0x34, 0x25, 0x33, 0x43, 0x22, 0x13,
+    0x12, 0x88, 0xb9, 0xcc, 0xbc, 0xbd, 0xbc, 0xcb, 0xbb, 0xac, 0xab, 0xa9, 0x98, 0x11, 0x33, 0x36,
+    0x35, 0x34, 0x34, 0x24, 0x33, 0x33, 0x23, 0x11, 0x80, 0xba, 0xbd, 0xbe, 0xcc, 0xbb, 0xbc, 0xcb,
+    0xba, 0xba, 0x9a, 0x88, 0x20, 0x43, 0x35, 0x35, 0x34, 0x34, 0x43, 0x33, 0x32, 0x13, 0x12, 0x98,
+    0xc9, 0xeb, 0xcb, 0xdb, 0xbb, 0xbc, 0xbb, 0xac, 0xab, 0x99, 0x89, 0x11, 0x53, 0x34, 0x35, 0x34,
+    0x34, 0x43, 0x32, 0x23, 0x13, 0x11, 0x90, 0xba, 0xcd, 0xcc, 0xcb, 0xcb, 0xbb, 0xcb, 0xab, 0xab,
+    0xa9, 0x08, 0x20, 0x63, 0x53, 0x43, 0x53, 0x32, 0x43, 0x32, 0x23, 0x22, 0x01, 0x90, 0xbb, 0xcd,
+    0xcc, 0xcb, 0xbb, 0xad, 0xbb, 0xba, 0xab, 0x9a, 0x19, 0x21, 0x44, 0x44, 0x53, 0x33, 0x34, 0x34,
+    0x32, 0x33, 0x12, 0x02, 0x98, 0xcb, 0xcc, 0xbc, 0xbd, 0xcb, 0xcb, 0xba, 0xbb, 0xaa, 0x9a, 0x08,
+    0x31, 0x44, 0x44, 0x53, 0x33, 0x34, 0x24, 0x33, 0x32, 0x21, 0x01, 0xa0, 0xbb, 0xbf, 0xbc, 0xbd,
+    0xcb, 0xbb, 0xbc, 0xba, 0xaa, 0xa9, 0x18, 0x31, 0x44, 0x44, 0x53, 0x33, 0x34, 0x43, 0x32, 0x23,
+    0x21, 0x01, 0x99, 0xcb, 0xbd, 0xbd, 0xbc, 0xbc, 0xcb, 0xab, 0xbb, 0xaa, 0x9a, 0x18, 0x31, 0x45,
+    0x34, 0x35, 0x53, 0x33, 0x33, 0x24, 0x32, 0x11, 0x01, 0xa8, 0xcb, 0xcc, 0xbc, 0xbd, 0xbb, 0xad,
+    0xbb, 0xab, 0xaa, 0x8a, 0x18, 0x32, 0x45, 0x34, 0x44, 0x43, 0x33, 0x43, 0x23, 0x23, 0x21, 0x01,
+    0xa9, 0xeb, 0xdb, 0xcb, 0xcb, 0xcb, 0xbb, 0xbb, 0xbb, 0xab, 0x9a, 0x10, 0x43, 0x44, 0x34, 0x44,
+    0x33, 0x25, 0x33, 0x33, 0x22, 0x22, 0x00, 0xaa, 0xfb, 0xbb, 0xcc, 0xcb, 0xcb, 0xbb, 0xbb, 0xab,
+    0xab, 0x8a, 0x10, 0x53, 0x53, 0x53, 0x43, 0x33, 0x34, 0x43, 0x32, 0x22, 0x21, 0x00, 0xb9, 0xdb,
+    0xbd, 0xdb, 0xcb, 0xcb, 0xab, 0xcb, 0xaa, 0x99, 0x99, 0x10, 0x33, 0x54, 0x53, 0x33, 0x25, 0x43,
+    0x32, 0x23, 0x32, 0x11, 0x81, 0xaa, 0xcc, 0xcc, 0xcb, 0xbc, 0xcb, 0xbb, 0xbb, 0xbb, 0xab, 0x89,
+    0x20, 0x63, 0x33, 0x35, 0x35, 0x43, 0x33, 0x43, 0x32, 0x22, 0x11, 0x80, 0xaa, 0xcc, 0xcc, 0xcb,
+    0xbc, 0xcb, 0xba, 0xac, 0xaa, 0xa9, 0x88, 0x10, 0x33, 0x36, 0x35, 0x53, 0x33, 0x34, 0x33, 0x32,
+    0x33, 0x11, 0x91, 0xbb, 0xbe, 0xbc, 0xcc, 0xcb, 0xca, 0xba, 0xab, 0xab, 0x9a, 0x09, 0x10, 0x73,
+    0x32, 0x34, 0x44, 0x42, 0x32, 0x33, 0x23, 0x23, 0x11, 0x90, 0xba, 0xbe, 0xbc, 0xbd, 0xcb, 0xcb,
+    0xba, 0xbb, 0xba, 0x9a, 0x89, 0x21, 0x34, 0x45, 0x43, 0x34, 0x43, 0x33, 0x24, 0x23, 0x22, 0x11,
+    0x98, 0xba, 0xbe, 0xdb, 0xcb, 0xac, 0xcb, 0xab, 0xbb, 0xaa, 0xaa, 0x08, 0x21, 0x34, 0x45, 0x53,
+    0x33, 0x34, 0x43, 0x32, 0x32, 0x22, 0x11, 0x98, 0xbb, 0xaf, 0xcb, 0xcb, 0xcb, 0xbb, 0xac, 0xab,
+    0xab, 0x9a, 0x19, 0x30, 0x35, 0x34, 0x35, 0x34, 0x34, 0x43, 0x32, 0x22, 0x13, 0x11, 0x98, 0xcb,
+    0xbc, 0xbd, 0xbd, 0xcb, 0xbb, 0xbb, 0xac, 0xab, 0x99, 0x09, 0x31, 0x35, 0x44, 0x43, 0x53, 0x32,
+    0x24, 0x23, 0x32, 0x12, 0x01, 0xa0, 0xcb, 0xbc, 0xbd, 0xbd, 0xbb, 0xbc, 0xac, 0xba, 0xb9, 0x99,
+};
+
+static const sound_clip_t sound_bank[SOUND_COUNT] = {
+    {sound_tick_adpcm, 576},
+    {sound_mute_adpcm, 7200},
+    {sound_unmute_adpcm, 7200},
+    {sound_boot_adpcm, 24960},
+};
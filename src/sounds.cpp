@@ -0,0 +1,104 @@
+#include <string.h>
+
+#include "pico/stdlib.h"
+
+#include "sounds.h"
+#include "sound_bank.h"
+#include "profile.h"
+
+static const int8_t index_table[16] = {-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8};
+
+static const int16_t step_table[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767
+};
+
+// A single voice keeps the cost per buffer fixed, a new sound cuts off the last
+typedef struct {
+    const uint8_t *adpcm;
+    uint32_t position;
+    uint32_t frames;
+    int32_t predictor;
+    int32_t index;
+    int32_t gain;
+} voice_t;
+
+static voice_t voice = {};
+
+static inline int16_t saturate(int32_t value) {
+    return value > INT16_MAX ? INT16_MAX : (value < INT16_MIN ? INT16_MIN : value);
+}
+
+static inline int32_t adpcm_decode(voice_t *v, uint8_t code) {
+    int32_t step = step_table[v->index];
+    int32_t delta = step >> 3;
+    if(code & 4) delta += step;
+    if(code & 2) delta += step >> 1;
+    if(code & 1) delta += step >> 2;
+
+    v->predictor += (code & 8) ? -delta : delta;
+    v->predictor = saturate(v->predictor);
+
+    v->index += index_table[code];
+    v->index = v->index < 0 ? 0 : (v->index > 88 ? 88 : v->index);
+
+    return v->predictor;
+}
+
+void sounds_play(sound_id_t id, uint8_t gain) {
+    if(id >= SOUND_COUNT) return;
+    voice.adpcm = sound_bank[id].adpcm;
+    voice.frames = sound_bank[id].frames;
+    voice.position = 0;
+    voice.predictor = 0;
+    voice.index = 0;
+    voice.gain = gain;
+}
+
+void sounds_stop() {
+    voice.position = voice.frames;
+}
+
+bool sounds_playing() {
+    return voice.position < voice.frames;
+}
+
+void sounds_mix(int16_t *out, size_t frames) {
+    size_t remaining = voice.frames - voice.position;
+    if(frames > remaining) frames = remaining;
+
+    for(auto i = 0u; i < frames; i++) {
+        uint32_t p = voice.position++;
+        uint8_t code = (voice.adpcm[p >> 1] >> ((p & 1) << 2)) & 0xf;
+        int32_t sample = (adpcm_decode(&voice, code) * voice.gain) >> 8;
+        out[i * 2 + 0] = saturate(out[i * 2 + 0] + sample);
+        out[i * 2 + 1] = saturate(out[i * 2 + 1] + sample);
+    }
+}
+
+uint32_t sounds_bench(size_t frames) {
+    static int16_t out[96 * 2];
+    if(frames > count_of(out) / 2) frames = count_of(out) / 2;
+
+    voice_t saved = voice;
+    uint32_t worst = 0;
+
+    // The boot chime is the longest clip, so every pass is a full block.
+    // The first pass takes the XIP cache misses.
+    sounds_play(SOUND_BOOT, 255);
+    for(auto run = 0u; run < 8; run++) {
+        memset(out, 0, sizeof(out));
+        uint32_t start = profile_start();
+        sounds_mix(out, frames);
+        uint32_t cycles = profile_cycles(start);
+        if(cycles > worst) worst = cycles;
+    }
+
+    voice = saved;
+    return worst;
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// UI feedback sounds, IMA-ADPCM in flash. See generate-sound-bank.py
+enum sound_id_t : uint8_t {
+    SOUND_TICK,
+    SOUND_MUTE,
+    SOUND_UNMUTE,
+    SOUND_BOOT,
+    SOUND_COUNT
+};
+
+typedef struct {
+    const uint8_t *adpcm;   // Read in place from XIP
+    uint32_t frames;
+} sound_clip_t;
+
+// Starts a sound, replacing any that's playing. Gain is 0 - 255.
+void sounds_play(sound_id_t id, uint8_t gain);
+void sounds_stop();
+bool sounds_playing();
+// Decode and sum into interleaved stereo output, saturating
+void sounds_mix(int16_t *out, size_t frames);
+// Worst case cycles to decode and mix `frames` frames
+uint32_t sounds_bench(size_t frames);
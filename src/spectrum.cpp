@@ -0,0 +1,249 @@
+#include <math.h>
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "pico/multicore.h"
+#include "hardware/clocks.h"
+#include "tusb.h"
+#include "spectrum.h"
+#include "profile.h"
+
+// Post-processing output, mixed to mono, shared from core0 to core1.
+// Sized so core0 can run a good 16ms ahead of a copy in progress on core1.
+static const uint RING_SIZE = 1024;
+static int16_t ring[RING_SIZE];
+static volatile uint32_t ring_write = 0;
+
+static volatile bool enabled = false;
+
+static int16_t window[SPECTRUM_FFT_SIZE];
+static int16_t twiddle_cos[SPECTRUM_FFT_SIZE];
+static uint8_t bin_index[SPECTRUM_FFT_SIZE];
+
+// Double buffered so core0 can stream one frame while core1 fills the next
+static spectrum_frame_t frames[2];
+static volatile uint8_t frame_ready = 0;
+static volatile int8_t frame_sending = -1;
+static volatile uint32_t frame_sequence = 0;
+
+static spectrum_stats_t stats;
+
+// core0 side streaming state
+static uint32_t sent_sequence = 0;
+static uint sent_bytes = sizeof(spectrum_frame_t);
+
+void spectrum_push(const int16_t *samples, size_t frames) {
+    if(!enabled) return;
+
+    uint32_t w = ring_write;
+    for(auto i = 0u; i < frames * 2; i += 2) {
+        ring[w++ & (RING_SIZE - 1)] = (samples[i + 0] + samples[i + 1]) >> 1;
+    }
+    ring_write = w;
+}
+
+static inline int16_t twiddle_sin(uint i) {
+    // sin(2πi/N) == cos(2π(i - N/4)/N)
+    return twiddle_cos[(i - SPECTRUM_FFT_SIZE / 4) & (SPECTRUM_FFT_SIZE - 1)];
+}
+
+// In-place radix-4 decimation in frequency, Q15 data scaled by 1/4 per stage
+// so a full scale input can't overflow. Output is in base-4 digit reversed order.
+static void fft_radix4(int32_t *re, int32_t *im) {
+    uint n2 = SPECTRUM_FFT_SIZE;
+    for(uint k = 1; k < SPECTRUM_FFT_SIZE; k *= 4) {
+        uint n1 = n2;
+        n2 /= 4;
+        for(uint j = 0; j < n2; j++) {
+            int32_t w1r = twiddle_cos[j * k],     w1i = twiddle_sin(j * k);
+            int32_t w2r = twiddle_cos[2 * j * k], w2i = twiddle_sin(2 * j * k);
+            int32_t w3r = twiddle_cos[3 * j * k], w3i = twiddle_sin(3 * j * k);
+            for(uint i = j; i < SPECTRUM_FFT_SIZE; i += n1) {
+                uint i1 = i + n2, i2 = i1 + n2, i3 = i2 + n2;
+
+                int32_t t0r = (re[i] + re[i2]) >> 2, t0i = (im[i] + im[i2]) >> 2;
+                int32_t t1r = (re[i] - re[i2]) >> 2, t1i = (im[i] - im[i2]) >> 2;
+                int32_t t2r = (re[i1] + re[i3]) >> 2, t2i = (im[i1] + im[i3]) >> 2;
+                int32_t t3r = (re[i1] - re[i3]) >> 2, t3i = (im[i1] - im[i3]) >> 2;
+
+                re[i] = t0r + t2r;
+                im[i] = t0i + t2i;
+
+                // Multiply by conj(w), since the forward transform uses e^-jθ
+                int32_t yr = t1r + t3i, yi = t1i - t3r;
+                re[i1] = (yr * w1r + yi * w1i) >> 15;
+                im[i1] = (yi * w1r - yr * w1i) >> 15;
+
+                yr = t0r - t2r; yi = t0i - t2i;
+                re[i2] = (yr * w2r + yi * w2i) >> 15;
+                im[i2] = (yi * w2r - yr * w2i) >> 15;
+
+                yr = t1r - t3i; yi = t1i + t3r;
+                re[i3] = (yr * w3r + yi * w3i) >> 15;
+                im[i3] = (yi * w3r - yr * w3i) >> 15;
+            }
+        }
+    }
+}
+
+// 0.5dB steps: 2 * 10 * log10(p) == 6.0206 * log2(p)
+static uint8_t power_to_half_db(uint32_t p) {
+    if(p == 0) return 0;
+    uint log2_int = 31 - __builtin_clz(p);
+    // Linear interpolation of the fractional part is within 0.1 bits
+    uint32_t frac = log2_int >= 8 ? (p >> (log2_int - 8)) & 0xff : (p << (8 - log2_int)) & 0xff;
+    uint32_t log2_q8 = (log2_int << 8) | frac;
+    return (log2_q8 * 1541) >> 16; // 6.0206 / 2^8
+}
+
+void spectrum_analyse(const int16_t *samples, spectrum_frame_t *frame) {
+    static int32_t re[SPECTRUM_FFT_SIZE];
+    static int32_t im[SPECTRUM_FFT_SIZE];
+
+    for(auto i = 0u; i < SPECTRUM_FFT_SIZE; i++) {
+        re[i] = (samples[i] * window[i]) >> 15;
+        im[i] = 0;
+    }
+
+    fft_radix4(re, im);
+
+    uint8_t checksum = 0;
+    for(auto i = 0u; i < SPECTRUM_FFT_SIZE; i++) {
+        uint bin = bin_index[i];
+        if(bin < SPECTRUM_BINS) {
+            uint32_t p = re[i] * re[i] + im[i] * im[i];
+            frame->bins[bin] = power_to_half_db(p);
+            checksum += frame->bins[bin];
+        }
+    }
+    frame->checksum = checksum;
+}
+
+// The latest FFT's worth from the ring, in order
+static void analyse(spectrum_frame_t *frame) {
+    static int16_t samples[SPECTRUM_FFT_SIZE];
+
+    uint32_t start = ring_write - SPECTRUM_FFT_SIZE;
+    for(auto i = 0u; i < SPECTRUM_FFT_SIZE; i++) {
+        samples[i] = ring[(start + i) & (RING_SIZE - 1)];
+    }
+    spectrum_analyse(samples, frame);
+}
+
+static void spectrum_core1_entry() {
+    multicore_lockout_victim_init();
+    profile_init();
+
+    uint32_t busy_cycles = 0;
+    uint64_t window_start_us = time_us_64();
+    absolute_time_t next = get_absolute_time();
+
+    while(true) {
+        next = delayed_by_ms(next, SPECTRUM_INTERVAL_MS);
+        sleep_until(next);
+
+        if(!enabled) continue;
+
+        // core0 only ever picks up the ready frame, so the other one is ours
+        // unless it is still trickling out an older frame from it.
+        uint8_t target = frame_ready ^ 1;
+        if(frame_sending == target) continue;
+        spectrum_frame_t *frame = &frames[target];
+
+        uint32_t start = profile_start();
+        analyse(frame);
+        uint32_t cycles = profile_cycles(start);
+
+        frame->sequence = frame_sequence + 1;
+        __dmb();
+        frame_ready = target;
+        frame_sequence++;
+
+        stats.fft_cycles = cycles;
+        stats.frames++;
+
+        // Utilisation over roughly one second of frames
+        busy_cycles += cycles;
+        uint64_t now = time_us_64();
+        if(now - window_start_us >= 1000000) {
+            uint32_t cycles_per_us = clock_get_hz(clk_sys) / 1000000;
+            stats.busy_permille = busy_cycles / ((now - window_start_us) * cycles_per_us / 1000);
+            busy_cycles = 0;
+            window_start_us = now;
+        }
+    }
+}
+
+void spectrum_init() {
+    for(auto i = 0u; i < SPECTRUM_FFT_SIZE; i++) {
+        float theta = 2.0f * (float)M_PI * i / SPECTRUM_FFT_SIZE;
+        twiddle_cos[i] = (int16_t)fminf(32767.0f, roundf(cosf(theta) * 32768.0f));
+        window[i] = (int16_t)fminf(32767.0f, roundf((0.5f - 0.5f * cosf(theta)) * 32768.0f));
+
+        // Undo the base-4 digit reversal of the radix-4 output
+        uint reversed = 0;
+        for(auto n = i, d = 0u; d < 4; d++, n >>= 2) {
+            reversed = (reversed << 2) | (n & 3);
+        }
+        bin_index[i] = reversed;
+    }
+
+    for(auto &frame : frames) {
+        frame.magic[0] = 'S';
+        frame.magic[1] = 'P';
+        frame.bin_count = SPECTRUM_BINS;
+    }
+
+    multicore_launch_core1(spectrum_core1_entry);
+}
+
+void spectrum_set_streaming(bool streaming) {
+    enabled = streaming;
+    sent_sequence = frame_sequence;
+    sent_bytes = sizeof(spectrum_frame_t);
+    frame_sending = -1;
+}
+
+static void send_some() {
+    const uint8_t *frame = (const uint8_t *)&frames[frame_sending];
+    uint32_t available = tud_cdc_write_available();
+    uint32_t len = sizeof(spectrum_frame_t) - sent_bytes;
+    if(len > available) len = available;
+    if(len) {
+        sent_bytes += tud_cdc_write(frame + sent_bytes, len);
+        tud_cdc_write_flush();
+    }
+}
+
+// Trickle the latest frame out through the CDC FIFO without ever blocking
+void spectrum_task() {
+    if(!enabled || !tud_cdc_connected()) return;
+
+    if(sent_bytes == sizeof(spectrum_frame_t)) {
+        frame_sending = -1;
+        if(sent_sequence == frame_sequence) return;
+        sent_sequence = frame_sequence;
+        sent_bytes = 0;
+        frame_sending = frame_ready;
+    }
+
+    send_some();
+}
+
+// Called by cdc_write(), so a reply never lands in the middle of a frame. A
+// frame that can't be finished in time is abandoned, and fails its checksum.
+void spectrum_flush(uint timeout_ms) {
+    if(frame_sending < 0 || sent_bytes == sizeof(spectrum_frame_t)) return;
+
+    absolute_time_t until = make_timeout_time_ms(timeout_ms);
+    while(tud_cdc_connected() && sent_bytes < sizeof(spectrum_frame_t) && !time_reached(until)) {
+        send_some();
+        if(sent_bytes < sizeof(spectrum_frame_t)) tud_task();
+    }
+    sent_bytes = sizeof(spectrum_frame_t);
+    frame_sending = -1;
+}
+
+void spectrum_get_stats(spectrum_stats_t *out) {
+    *out = stats;
+}
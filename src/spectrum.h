@@ -0,0 +1,37 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+static const uint SPECTRUM_FFT_SIZE = 256;
+static const uint SPECTRUM_BINS = SPECTRUM_FFT_SIZE / 2;
+static const uint SPECTRUM_INTERVAL_MS = 50;
+
+// Magnitude frame streamed over CDC. Each bin is the magnitude in 0.5dB steps
+// above one LSB at the FFT output, so a full scale sine lands around 156.
+// Replies to commands share the stream, so readers resync on the magic and
+// only take a frame whose length and checksum match.
+typedef struct {
+    uint8_t magic[2];       // 'S', 'P'
+    uint8_t sequence;
+    uint8_t bin_count;      // Length of bins
+    uint8_t bins[SPECTRUM_BINS];
+    uint8_t checksum;       // Sum of the bins, modulo 256
+} spectrum_frame_t;
+
+typedef struct {
+    uint32_t fft_cycles;    // Window, FFT and magnitudes for the last frame
+    uint32_t busy_permille; // Share of core1 spent analysing
+    uint32_t frames;
+} spectrum_stats_t;
+
+void spectrum_init();
+void spectrum_push(const int16_t *samples, size_t frames);
+void spectrum_task();
+// Sends the rest of a frame already started, before anything else is written
+void spectrum_flush(uint timeout_ms);
+void spectrum_set_streaming(bool streaming);
+void spectrum_get_stats(spectrum_stats_t *stats);
+
+// Window, FFT and magnitudes of SPECTRUM_FFT_SIZE mono samples, as core1 does
+// for each frame. For the host test, after spectrum_init().
+void spectrum_analyse(const int16_t *samples, spectrum_frame_t *frame);
@@ -98,7 +98,7 @@ extern "C" {
 #define CFG_TUD_MSC               0
 #define CFG_TUD_HID               0
 #define CFG_TUD_MIDI              0
-#define CFG_TUD_AUDIO             1
+#define CFG_TUD_AUDIO             (1 + AUDIO_SYSTEM_MIX)
 #define CFG_TUD_VENDOR            0
 
 //--------------------------------------------------------------------
@@ -111,11 +111,11 @@ extern "C" {
 #define CFG_TUD_AUDIO_FUNC_1_DESC_LEN                                TUD_AUDIO_HEADSET_STEREO_DESC_LEN
 
 // How many formats are used, need to adjust USB descriptor if changed
-#define CFG_TUD_AUDIO_FUNC_1_N_FORMATS                               2
+#define CFG_TUD_AUDIO_FUNC_1_N_FORMATS                               3
 
 // Audio format type I specifications
 #define CFG_TUD_AUDIO_FUNC_1_MAX_SAMPLE_RATE                         48000     // 24bit/96kHz is the best quality for full-speed, high-speed is needed beyond this
-#define CFG_TUD_AUDIO_FUNC_1_N_CHANNELS_TX                           0  // was 1
+#define CFG_TUD_AUDIO_FUNC_1_N_CHANNELS_TX                           (AUDIO_LOOPBACK ? 2 : 0)
 #define CFG_TUD_AUDIO_FUNC_1_N_CHANNELS_RX                           2
 
 // 16bit in 16bit slots
@@ -129,21 +129,55 @@ extern "C" {
 #define CFG_TUD_AUDIO_FUNC_1_FORMAT_2_N_BYTES_PER_SAMPLE_RX          4
 #define CFG_TUD_AUDIO_FUNC_1_FORMAT_2_RESOLUTION_RX                  24
 
+// 32bit IEEE-754 float
+#define CFG_TUD_AUDIO_FUNC_1_FORMAT_3_N_BYTES_PER_SAMPLE_RX          4
+#define CFG_TUD_AUDIO_FUNC_1_FORMAT_3_RESOLUTION_RX                  32
+
 // EP and buffer size - for isochronous EP´s, the buffer and EP size are equal (different sizes would not make sense)
 #define CFG_TUD_AUDIO_ENABLE_EP_OUT               1
 
 #define CFG_TUD_AUDIO_UNC_1_FORMAT_1_EP_SZ_OUT    TUD_AUDIO_EP_SIZE(CFG_TUD_AUDIO_FUNC_1_MAX_SAMPLE_RATE, CFG_TUD_AUDIO_FUNC_1_FORMAT_1_N_BYTES_PER_SAMPLE_RX, CFG_TUD_AUDIO_FUNC_1_N_CHANNELS_RX)
 #define CFG_TUD_AUDIO_UNC_1_FORMAT_2_EP_SZ_OUT    TUD_AUDIO_EP_SIZE(CFG_TUD_AUDIO_FUNC_1_MAX_SAMPLE_RATE, CFG_TUD_AUDIO_FUNC_1_FORMAT_2_N_BYTES_PER_SAMPLE_RX, CFG_TUD_AUDIO_FUNC_1_N_CHANNELS_RX)
+#define CFG_TUD_AUDIO_UNC_1_FORMAT_3_EP_SZ_OUT    TUD_AUDIO_EP_SIZE(CFG_TUD_AUDIO_FUNC_1_MAX_SAMPLE_RATE, CFG_TUD_AUDIO_FUNC_1_FORMAT_3_N_BYTES_PER_SAMPLE_RX, CFG_TUD_AUDIO_FUNC_1_N_CHANNELS_RX)
+
+#define CFG_TUD_AUDIO_FUNC_1_EP_OUT_SW_BUF_SZ     TU_MAX(CFG_TUD_AUDIO_UNC_1_FORMAT_1_EP_SZ_OUT, TU_MAX(CFG_TUD_AUDIO_UNC_1_FORMAT_2_EP_SZ_OUT, CFG_TUD_AUDIO_UNC_1_FORMAT_3_EP_SZ_OUT))*2
+#define CFG_TUD_AUDIO_FUNC_1_EP_OUT_SZ_MAX        TU_MAX(CFG_TUD_AUDIO_UNC_1_FORMAT_1_EP_SZ_OUT, TU_MAX(CFG_TUD_AUDIO_UNC_1_FORMAT_2_EP_SZ_OUT, CFG_TUD_AUDIO_UNC_1_FORMAT_3_EP_SZ_OUT)) // Maximum EP IN size for all AS alternate settings used
 
-#define CFG_TUD_AUDIO_FUNC_1_EP_OUT_SW_BUF_SZ     TU_MAX(CFG_TUD_AUDIO_UNC_1_FORMAT_1_EP_SZ_OUT, CFG_TUD_AUDIO_UNC_1_FORMAT_2_EP_SZ_OUT)*2
-#define CFG_TUD_AUDIO_FUNC_1_EP_OUT_SZ_MAX        TU_MAX(CFG_TUD_AUDIO_UNC_1_FORMAT_1_EP_SZ_OUT, CFG_TUD_AUDIO_UNC_1_FORMAT_2_EP_SZ_OUT) // Maximum EP IN size for all AS alternate settings used
+// Loopback capture is always 16bit stereo, the format sent to I2S
+#if AUDIO_LOOPBACK
+#define CFG_TUD_AUDIO_ENABLE_EP_IN                1
+
+#define CFG_TUD_AUDIO_FUNC_1_EP_IN_SZ_MAX         TUD_AUDIO_EP_SIZE(CFG_TUD_AUDIO_FUNC_1_MAX_SAMPLE_RATE, CFG_TUD_AUDIO_FUNC_1_FORMAT_1_N_BYTES_PER_SAMPLE_TX, CFG_TUD_AUDIO_FUNC_1_N_CHANNELS_TX)
+#define CFG_TUD_AUDIO_FUNC_1_EP_IN_SW_BUF_SZ      CFG_TUD_AUDIO_FUNC_1_EP_IN_SZ_MAX*4
+#endif
 
 // Number of Standard AS Interface Descriptors (4.9.1) defined per audio function - this is required to be able to remember the current alternate settings of these interfaces - We restrict us here to have a constant number for all audio functions (which means this has to be the maximum number of AS interfaces an audio function has and a second audio function with less AS interfaces just wastes a few bytes)
-#define CFG_TUD_AUDIO_FUNC_1_N_AS_INT             1
+#define CFG_TUD_AUDIO_FUNC_1_N_AS_INT             (1 + AUDIO_LOOPBACK)
 
 // Size of control request buffer
 #define CFG_TUD_AUDIO_FUNC_1_CTRL_BUF_SZ          64
 
+//--------------------------------------------------------------------
+// SYSTEM SOUNDS AUDIO FUNCTION
+//--------------------------------------------------------------------
+
+#if AUDIO_SYSTEM_MIX
+#define CFG_TUD_AUDIO_FUNC_2_DESC_LEN                                TUD_AUDIO_SYSTEM_SPEAKER_DESC_LEN
+#define CFG_TUD_AUDIO_FUNC_2_N_FORMATS                               1
+#define CFG_TUD_AUDIO_FUNC_2_N_CHANNELS_TX                           0
+#define CFG_TUD_AUDIO_FUNC_2_N_CHANNELS_RX                           2
+
+// 16bit in 16bit slots
+#define CFG_TUD_AUDIO_FUNC_2_FORMAT_1_N_BYTES_PER_SAMPLE_RX          2
+#define CFG_TUD_AUDIO_FUNC_2_FORMAT_1_RESOLUTION_RX                  16
+
+#define CFG_TUD_AUDIO_FUNC_2_EP_OUT_SZ_MAX        TUD_AUDIO_EP_SIZE(CFG_TUD_AUDIO_FUNC_1_MAX_SAMPLE_RATE, CFG_TUD_AUDIO_FUNC_2_FORMAT_1_N_BYTES_PER_SAMPLE_RX, CFG_TUD_AUDIO_FUNC_2_N_CHANNELS_RX)
+#define CFG_TUD_AUDIO_FUNC_2_EP_OUT_SW_BUF_SZ     CFG_TUD_AUDIO_FUNC_2_EP_OUT_SZ_MAX*2
+
+#define CFG_TUD_AUDIO_FUNC_2_N_AS_INT             1
+#define CFG_TUD_AUDIO_FUNC_2_CTRL_BUF_SZ          64
+#endif
+
 // CDC FIFO size of TX and RX
 #define CFG_TUD_CDC_RX_BUFSIZE                    64
 #define CFG_TUD_CDC_TX_BUFSIZE                    64
@@ -0,0 +1,330 @@
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "pico/bootrom.h"
+#include "pico/multicore.h"
+#include "hardware/flash.h"
+#include "hardware/sync.h"
+#include "hardware/watchdog.h"
+#include "hardware/structs/psm.h"
+#include "hardware/structs/rosc.h"
+#include "hardware/structs/timer.h"
+#include "tusb.h"
+#include "bsp/board_api.h"
+#include "board_config.h"
+#include "update.h"
+#include "flash_ops.h"
+#include "serial.h"
+#include "spectrum.h"
+
+// Staging slot is the upper half of flash, below the settings store
+static const uint32_t SLOT_OFFSET = PICO_FLASH_SIZE_BYTES / 2;
+static const uint32_t SLOT_SIZE = PICO_FLASH_SIZE_BYTES / 2 - 2 * FLASH_SECTOR_SIZE;
+
+// Give up on a transfer that stalls
+static const uint32_t RECEIVE_TIMEOUT_MS = 5000;
+
+// Erasing stalls for tens of milliseconds, wait this long for audio to stop
+// before giving up on the transfer. Never erase under playback.
+static const uint32_t ERASE_MAX_DEFER_MS = 5000;
+
+// Leaving the slot erased waits for audio to have been stopped this long, so
+// it doesn't start between two tracks, then erases a sector at most this
+// often. Each erase is ~45ms with interrupts off.
+static const uint32_t CLEANUP_QUIET_MS = 10000;
+static const uint32_t CLEANUP_ERASE_INTERVAL_MS = 1000;
+
+// Let the final response reach the host before audio and USB go away
+static const uint32_t INSTALL_DELAY_MS = 100;
+
+// Verify a chunk of the staged image per pass of the main loop
+static const uint32_t VERIFY_CHUNK = 1024;
+
+// Survives the watchdog reboot, scratch 4-7 belong to the bootrom
+static const uint32_t INSTALL_MAGIC = 0x55504400;
+
+enum update_state_t {
+    UPDATE_IDLE,
+    UPDATE_RECEIVING,
+    UPDATE_VERIFYING,
+    UPDATE_INSTALL_PENDING,
+};
+
+// Single byte responses to the host
+static const char RESPONSE_READY = 'R';
+static const char RESPONSE_REFUSED = 'F';
+static const char RESPONSE_ACK = 'A';
+static const char RESPONSE_VERIFIED = 'V';
+static const char RESPONSE_BAD_IMAGE = 'C';
+
+static update_state_t state = UPDATE_IDLE;
+static uint32_t expected_crc = 0;
+static uint32_t page_fill = 0;
+static uint8_t page[FLASH_PAGE_SIZE];
+static uint32_t last_data_ms = 0;
+static uint32_t start_ms = 0;
+static uint32_t erase_wait_ms = 0;
+static uint32_t sector_ready = UINT32_MAX;
+static uint32_t verify_offset = 0;
+static uint32_t verify_crc = 0;
+static uint32_t install_at_ms = 0;
+static uint32_t cleanup_offset = 0;
+static uint32_t quiet_since_ms = 0;
+static uint32_t last_erase_ms = 0;
+
+static update_stats_t stats = {};
+
+// End of the running image in flash, from the linker script
+extern char __flash_binary_end;
+
+// Used with audio and interrupts off, while the image it came from is erased
+static uint32_t install_buffer[FLASH_SECTOR_SIZE / 4];
+
+static uint32_t crc32_update(uint32_t crc, const uint8_t *data, size_t len) {
+    // zlib's CRC32, same as the host side
+    for(auto i = 0u; i < len; i++) {
+        crc ^= data[i];
+        for(auto bit = 0u; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xedb88320u & -(crc & 1));
+        }
+    }
+    return crc;
+}
+
+// The bootrom refuses to run boot2 unless its CRC matches, so an image
+// that fails this would leave us stuck in the USB bootloader
+static bool boot2_valid(const uint8_t *image) {
+    uint32_t crc = 0xffffffff;
+    for(auto i = 0u; i < 252; i++) {
+        crc ^= (uint32_t)image[i] << 24;
+        for(auto bit = 0u; bit < 8; bit++) {
+            crc = (crc & 0x80000000u) ? (crc << 1) ^ 0x04c11db7u : crc << 1;
+        }
+    }
+    uint32_t stored;
+    memcpy(&stored, image + 252, sizeof(stored));
+    return crc == stored;
+}
+
+static const uint8_t *staged(uint32_t offset) {
+    return (const uint8_t *)(XIP_BASE + SLOT_OFFSET + offset);
+}
+
+static bool sector_blank(uint32_t offset) {
+    const uint32_t *words = (const uint32_t *)staged(offset);
+    for(auto i = 0u; i < FLASH_SECTOR_SIZE / 4; i++) {
+        if(words[i] != 0xffffffff) return false;
+    }
+    return true;
+}
+
+// Through cdc_write(), so it never lands in the middle of a spectrum frame
+static void respond(char response) {
+    cdc_write(&response, 1);
+}
+
+// Copy the staged image over the running one. Nothing in here may touch
+// flash once the first sector is erased, so it's all RAM and registers.
+static void __no_inline_not_in_flash_func(install)(uint32_t size) {
+    uint32_t start = timer_hw->timerawl;
+    bool ok = false;
+
+    for(auto attempt = 0u; attempt < 2 && !ok; attempt++) {
+        ok = true;
+        for(uint32_t offset = 0; offset < size; offset += FLASH_SECTOR_SIZE) {
+            const volatile uint32_t *src = (const volatile uint32_t *)(XIP_BASE + SLOT_OFFSET + offset);
+            for(auto i = 0u; i < FLASH_SECTOR_SIZE / 4; i++) install_buffer[i] = src[i];
+
+            flash_range_erase(offset, FLASH_SECTOR_SIZE);
+            flash_range_program(offset, (const uint8_t *)install_buffer, FLASH_SECTOR_SIZE);
+
+            const volatile uint32_t *dst = (const volatile uint32_t *)(XIP_BASE + offset);
+            for(auto i = 0u; i < FLASH_SECTOR_SIZE / 4; i++) {
+                if(dst[i] != install_buffer[i]) ok = false;
+            }
+        }
+    }
+
+    watchdog_hw->scratch[0] = INSTALL_MAGIC | (ok ? 1 : 2);
+    watchdog_hw->scratch[1] = timer_hw->timerawl - start;
+
+    // Half written and twice unverifiable, the USB bootloader is the way back
+    if(!ok) {
+        rom_reset_usb_boot_fn reset_usb_boot_rom = (rom_reset_usb_boot_fn)rom_func_lookup_inline(ROM_FUNC_RESET_USB_BOOT);
+        reset_usb_boot_rom(0, 0);
+    }
+
+    // watchdog_reboot() lives in flash, so do the same by hand
+    rosc_hw->ctrl = ROSC_CTRL_ENABLE_VALUE_ENABLE << ROSC_CTRL_ENABLE_LSB;
+    psm_hw->wdsel = PSM_WDSEL_BITS & ~(PSM_WDSEL_ROSC_BITS | PSM_WDSEL_XOSC_BITS);
+    watchdog_hw->scratch[4] = 0;
+    watchdog_hw->ctrl = WATCHDOG_CTRL_TRIGGER_BITS;
+    while(1) {}
+}
+
+static void start_install() {
+    // Copying a whole image takes longer than the health monitor's watchdog allows
+    hw_clear_bits(&watchdog_hw->ctrl, WATCHDOG_CTRL_ENABLE_BITS);
+    gpio_put(PICO_AUDIO_I2S_AMP_ENABLE, 0);
+    multicore_lockout_start_blocking();
+    save_and_disable_interrupts();
+    install(stats.size);
+}
+
+void update_init() {
+    if((watchdog_hw->scratch[0] & 0xffffff00) == INSTALL_MAGIC) {
+        stats.installed = (watchdog_hw->scratch[0] & 0xff) == 1;
+        stats.install_failed = !stats.installed;
+        stats.install_us = watchdog_hw->scratch[1];
+    }
+    watchdog_hw->scratch[0] = 0;
+}
+
+bool update_begin(uint32_t size, uint32_t crc32) {
+    // The host reads single byte responses, so no more frames until it sends
+    // _sp1 again. Finish the one in flight first, it's already half sent.
+    spectrum_flush(50);
+    spectrum_set_streaming(false);
+
+    if(size < 256 || size > SLOT_SIZE) {
+        respond(RESPONSE_REFUSED);
+        return false;
+    }
+
+    // Staging over the running image would corrupt it before the copy
+    if((uintptr_t)&__flash_binary_end - XIP_BASE > SLOT_OFFSET) {
+        respond(RESPONSE_REFUSED);
+        return false;
+    }
+
+    state = UPDATE_RECEIVING;
+    stats.size = size;
+    stats.received = 0;
+    stats.bytes_per_sec = 0;
+    expected_crc = crc32;
+    page_fill = 0;
+    sector_ready = UINT32_MAX;
+    erase_wait_ms = 0;
+    start_ms = last_data_ms = board_millis();
+
+    respond(RESPONSE_READY);
+    return true;
+}
+
+bool update_receiving() {
+    return state == UPDATE_RECEIVING;
+}
+
+static void abandon(char response) {
+    respond(response);
+    state = UPDATE_IDLE;
+    cleanup_offset = 0;
+}
+
+// Make sure the sector holding `offset` is erased, returns false to try again later
+static bool prepare_sector(uint32_t offset, bool playing) {
+    uint32_t sector = offset & ~(FLASH_SECTOR_SIZE - 1);
+    if(sector == sector_ready) return true;
+
+    if(!sector_blank(sector)) {
+        if(playing) {
+            if(!erase_wait_ms) erase_wait_ms = board_millis();
+            if(board_millis() - erase_wait_ms >= ERASE_MAX_DEFER_MS) {
+                // The slot is erased again once audio stops, the host can retry then
+                stats.playback_refusals++;
+                abandon(RESPONSE_REFUSED);
+            }
+            return false;
+        }
+        flash_ops_erase(SLOT_OFFSET + sector, false);
+        erase_wait_ms = 0;
+    }
+
+    sector_ready = sector;
+    return true;
+}
+
+static void receive(bool playing) {
+    // The host pads the last page, so data always arrives in whole pages
+    if(page_fill < FLASH_PAGE_SIZE) {
+        if(tud_cdc_available()) {
+            page_fill += tud_cdc_read(page + page_fill, FLASH_PAGE_SIZE - page_fill);
+            last_data_ms = board_millis();
+        } else if(board_millis() - last_data_ms > RECEIVE_TIMEOUT_MS) {
+            state = UPDATE_IDLE;
+            cleanup_offset = 0;
+        }
+        return;
+    }
+
+    uint32_t offset = stats.received;
+    if(!prepare_sector(offset, playing)) return;
+    if(!flash_ops_can_program(playing)) return;
+
+    flash_ops_program(SLOT_OFFSET + offset, page, playing);
+    stats.received = MIN(stats.size, offset + FLASH_PAGE_SIZE);
+    page_fill = 0;
+    respond(RESPONSE_ACK);
+
+    if(stats.received == stats.size) {
+        uint32_t elapsed_ms = MAX(1u, board_millis() - start_ms);
+        stats.bytes_per_sec = (uint32_t)((uint64_t)stats.size * 1000 / elapsed_ms);
+        state = UPDATE_VERIFYING;
+        verify_offset = 0;
+        verify_crc = 0xffffffff;
+    }
+}
+
+static void verify() {
+    uint32_t len = MIN(VERIFY_CHUNK, stats.size - verify_offset);
+    verify_crc = crc32_update(verify_crc, staged(verify_offset), len);
+    verify_offset += len;
+    if(verify_offset < stats.size) return;
+
+    if(~verify_crc == expected_crc && boot2_valid(staged(0))) {
+        respond(RESPONSE_VERIFIED);
+        state = UPDATE_INSTALL_PENDING;
+        install_at_ms = board_millis() + INSTALL_DELAY_MS;
+    } else {
+        abandon(RESPONSE_BAD_IMAGE);
+    }
+}
+
+// Leave the staging slot erased so the next update never has to erase under playback
+static void cleanup(bool playing) {
+    uint32_t now = board_millis();
+    if(playing) {
+        quiet_since_ms = now;
+        return;
+    }
+    if(cleanup_offset >= SLOT_SIZE) return;
+    if(now - quiet_since_ms < CLEANUP_QUIET_MS) return;
+    if(!sector_blank(cleanup_offset)) {
+        if(now - last_erase_ms < CLEANUP_ERASE_INTERVAL_MS) return;
+        flash_ops_erase(SLOT_OFFSET + cleanup_offset, false);
+        last_erase_ms = now;
+    }
+    cleanup_offset += FLASH_SECTOR_SIZE;
+}
+
+void update_task(bool playing) {
+    switch(state) {
+        case UPDATE_IDLE:
+            cleanup(playing);
+            break;
+        case UPDATE_RECEIVING:
+            receive(playing);
+            break;
+        case UPDATE_VERIFYING:
+            verify();
+            break;
+        case UPDATE_INSTALL_PENDING:
+            tud_task();
+            if((int32_t)(board_millis() - install_at_ms) >= 0) start_install();
+            break;
+    }
+}
+
+void update_get_stats(update_stats_t *stats_out) {
+    *stats_out = stats;
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include <stdint.h>
+
+// Firmware update over CDC, staged in the upper half of flash.
+//
+// The RP2040 always boots from the start of flash, so the staged image is
+// verified and then copied over the running one from RAM, with audio off
+// only for the copy and the reboot.
+
+typedef struct {
+    uint32_t size;
+    uint32_t received;
+    uint32_t bytes_per_sec;     // Transfer rate, including flash programming
+    uint32_t playback_refusals; // Transfers given up waiting for audio to stop to erase
+    // Results of the last install, carried over the reboot
+    bool installed;
+    bool install_failed;
+    uint32_t install_us;        // Erase, program and verify with audio off
+} update_stats_t;
+
+// Pick up the result of an install from before the reboot
+void update_init();
+// Start receiving an image, returns false if it won't fit
+bool update_begin(uint32_t size, uint32_t crc32);
+// While receiving, the CDC port carries image data not commands
+bool update_receiving();
+void update_task(bool playing);
+void update_get_stats(update_stats_t *stats);
@@ -73,11 +73,12 @@ void usb_serial_init(void) {
 //--------------------------------------------------------------------+
 // Configuration Descriptor
 //--------------------------------------------------------------------+
-#define CONFIG_TOTAL_LEN    	(TUD_CONFIG_DESC_LEN + CFG_TUD_AUDIO * TUD_AUDIO_HEADSET_STEREO_DESC_LEN + CFG_TUD_CDC * TUD_CDC_DESC_LEN)
+#define CONFIG_TOTAL_LEN    	(TUD_CONFIG_DESC_LEN + TUD_AUDIO_HEADSET_STEREO_DESC_LEN + AUDIO_SYSTEM_MIX * TUD_AUDIO_SYSTEM_SPEAKER_DESC_LEN + CFG_TUD_CDC * TUD_CDC_DESC_LEN)
 
 #define EPNUM_AUDIO_IN    0x01
 #define EPNUM_AUDIO_OUT   0x01
 #define EPNUM_AUDIO_INT   0x02
+#define EPNUM_AUDIO_SYS_OUT 0x05
 
 #define EPNUM_CDC_NOTIF   0x83
 #define EPNUM_CDC_OUT     0x04
@@ -92,6 +93,11 @@ uint8_t const desc_configuration[] =
     // Interface number, string index, EP Out & EP In address, EP size
     TUD_AUDIO_HEADSET_STEREO_DESCRIPTOR(2, EPNUM_AUDIO_OUT, EPNUM_AUDIO_IN | 0x80, EPNUM_AUDIO_INT | 0x80),
 
+#if AUDIO_SYSTEM_MIX
+    // Interface number, string index, EP Out
+    TUD_AUDIO_SYSTEM_SPEAKER_DESCRIPTOR(7, EPNUM_AUDIO_SYS_OUT),
+#endif
+
     // CDC: Interface number, string index, EP notification address and size, EP data address (out, in) and size.
     TUD_CDC_DESCRIPTOR(ITF_NUM_CDC, 5, EPNUM_CDC_NOTIF, 8, EPNUM_CDC_OUT, EPNUM_CDC_IN, 64)
 };
@@ -118,6 +124,8 @@ char const* string_desc_arr [] =
   usb_serial,                     // 3: Serials, should use chip ID
   "Speakers",                     // 4: Audio Interface
   "CDC",                          // 5: CDC Serial Interface
+  "Loopback",                     // 6: Loopback capture interface
+  "System Sounds",                // 7: System sounds audio function
 };
 
 static uint16_t _desc_str[32 + 1];
@@ -0,0 +1,155 @@
+#include <algorithm>
+
+#include "pico/stdlib.h"
+#include "vbass.h"
+#include "vbass_table.h"
+#include "fixed.h"
+#include "profile.h"
+
+static const int SHIFT = 16 - VBASS_HEADROOM_BITS;
+static const q15_t HIGHPASS_DAMPING = q15_t::from_raw(VBASS_HIGHPASS_DAMPING);
+static const q15_t LOWPASS_DAMPING[2] = {
+    q15_t::from_raw(vbass_lowpass_damping[0]),
+    q15_t::from_raw(vbass_lowpass_damping[1])
+};
+static const q15_t K_RELEASE = q15_t::from_raw(VBASS_K_RELEASE);
+
+// Chamberlin state variable filter, samples in the top 30 bits
+typedef struct {
+    q31_t lp;
+    q31_t bp;
+} svf_t;
+
+static struct {
+    svf_t highpass[2];
+    svf_t lowpass[2];
+    q31_t envelope;
+    q31_t harmonic_lp;
+    int16_t hold[VBASS_HOLD_BLOCKS];    // Low band peak of each recent call
+    uint32_t hold_index;
+} state;
+
+static vbass_config_t config = {false, 150, 0};
+static uint32_t cutoff_index = (150 - VBASS_CUTOFF_MIN) / VBASS_CUTOFF_STEP;
+
+void vbass_set_config(const vbass_config_t *new_config) {
+    uint32_t cutoff = std::clamp<uint32_t>(new_config->cutoff_hz, VBASS_CUTOFF_MIN, VBASS_CUTOFF_MAX);
+    cutoff_index = (cutoff - VBASS_CUTOFF_MIN + VBASS_CUTOFF_STEP / 2) / VBASS_CUTOFF_STEP;
+
+    // Start from silence, so the harmonics fade in rather than jump
+    if(new_config->enabled && !config.enabled) {
+        state = {};
+    }
+    config.enabled = new_config->enabled;
+    config.cutoff_hz = VBASS_CUTOFF_MIN + cutoff_index * VBASS_CUTOFF_STEP;
+    config.gain_db = std::clamp<int32_t>(new_config->gain_db, VBASS_GAIN_MIN, VBASS_GAIN_MAX);
+}
+
+void vbass_get_config(vbass_config_t *out) {
+    *out = config;
+}
+
+bool vbass_enabled() {
+    return config.enabled;
+}
+
+int32_t vbass_config_to_setting(const vbass_config_t *config) {
+    return (config->enabled ? 1 : 0) | (uint8_t)config->gain_db << 8 | config->cutoff_hz << 16;
+}
+
+void vbass_config_from_setting(int32_t value, vbass_config_t *config) {
+    config->enabled = value & 1;
+    config->gain_db = (int8_t)(value >> 8);
+    config->cutoff_hz = (uint16_t)(value >> 16);
+}
+
+int32_t vbass_envelope() {
+    return fixed_shr_round(state.envelope.raw, 16);
+}
+
+static inline q31_t svf(svf_t *s, q31_t input, q15_t f, q15_t half_damping) {
+    s->lp = fixed_add(s->lp, fixed_mul(s->bp, f));
+    q31_t damping = fixed_mul(s->bp, half_damping);
+    q31_t hp = fixed_sub(fixed_sub(fixed_sub(input, s->lp), damping), damping);
+    s->bp = fixed_add(s->bp, fixed_mul(hp, f));
+    return hp;
+}
+
+void __not_in_flash_func(vbass_process)(int16_t *samples, size_t frames) {
+    const q15_t f = q15_t::from_raw(vbass_crossover_f[cutoff_index]);
+    const q15_t k_harmonic = q15_t::from_raw(vbass_harmonic_k[cutoff_index]);
+    const int32_t gain = vbass_gains[config.gain_db - VBASS_GAIN_MIN];
+
+    int32_t held = 0;
+    for(auto i = 0u; i < VBASS_HOLD_BLOCKS; i++) {
+        held = std::max<int32_t>(held, state.hold[i]);
+    }
+    int32_t peak = 0;
+
+    for(auto i = 0u; i < frames; i++) {
+        int16_t *frame = &samples[i * 2];
+
+        int32_t high[2];
+        for(auto c = 0u; c < 2; c++) {
+            q31_t hp = svf(&state.highpass[c], q31_t::from_raw((int32_t)frame[c] << SHIFT), f, HIGHPASS_DAMPING);
+            high[c] = fixed_shr_round(hp.raw, SHIFT);
+        }
+
+        // 4th order Butterworth low band of the mono sum
+        q31_t low = q31_t::from_raw(((int32_t)frame[0] + frame[1]) << (SHIFT - 1));
+        for(auto s = 0u; s < 2; s++) {
+            svf(&state.lowpass[s], low, f, LOWPASS_DAMPING[s]);
+            low = state.lowpass[s].lp;
+        }
+        int32_t bass = fixed_sat16(fixed_shr_round(low.raw, SHIFT));
+
+        // Rises with the peaks at once, then holds the highest of the last
+        // VBASS_HOLD_BLOCKS calls, longer than a period of the lowest bass
+        int32_t magnitude = std::min<int32_t>(bass < 0 ? -bass : bass, INT16_MAX);
+        peak = std::max(peak, magnitude);
+        if((magnitude << 16) >= state.envelope.raw) {
+            state.envelope = q31_t::from_raw(magnitude << 16);
+        } else {
+            q31_t target = q31_t::from_raw(std::max(held, peak) << 16);
+            state.envelope = fixed_add(state.envelope, fixed_mul(fixed_sub(target, state.envelope), K_RELEASE));
+        }
+        int32_t envelope = fixed_shr_round(state.envelope.raw, 16);
+
+        // Scaled to the envelope, Chebyshev polynomial n turns a sine into its nth harmonic
+        int32_t x = envelope ? (bass << 15) / envelope : 0;
+        int32_t t2 = ((x * x) >> 14) - 32768;
+        int32_t t3 = ((x * t2) >> 14) - x;
+        int32_t t4 = ((x * t3) >> 14) - t2;
+        int32_t shape = vbass_weights[0] * t2 + vbass_weights[1] * t3 + vbass_weights[2] * t4;
+        int32_t harmonics = fixed_sat16(fixed_shr_round(fixed_shr_round(shape, 15) * envelope, 15));
+
+        // Drop whatever lands below half the crossover, and any DC
+        q31_t input = q31_t::from_raw(harmonics << 16);
+        state.harmonic_lp = fixed_add(state.harmonic_lp, fixed_mul(fixed_sub(input, state.harmonic_lp), k_harmonic));
+        harmonics -= fixed_shr_round(state.harmonic_lp.raw, 16);
+        int32_t add = fixed_shr_round(harmonics * gain, VBASS_GAIN_BITS);
+
+        frame[0] = fixed_sat16(high[0] + add);
+        frame[1] = fixed_sat16(high[1] + add);
+    }
+
+    state.hold[state.hold_index] = peak;
+    state.hold_index = (state.hold_index + 1) % VBASS_HOLD_BLOCKS;
+}
+
+uint32_t vbass_bench() {
+    static int16_t samples[48 * 2];
+    uint32_t seed = 1;
+    for(auto i = 0u; i < 48 * 2; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        samples[i] = (int16_t)(seed >> 16);
+    }
+
+    // Don't disturb the filters of whatever's playing
+    auto saved = state;
+    uint32_t start = profile_start();
+    vbass_process(samples, 48);
+    uint32_t cycles = profile_cycles(start);
+    state = saved;
+    return cycles;
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// Virtual bass for the cabinet drivers, which give out below about 150Hz.
+// The low band is replaced by its 2nd to 4th harmonics, which the drivers can
+// play and the ear hears as the missing fundamental, and the rest is high
+// passed so the drivers don't waste excursion on it. Coefficients come from
+// src/vbass_table.h, see generate-vbass.py for the design and the distortion.
+
+typedef struct {
+    bool enabled;
+    uint16_t cutoff_hz;     // Crossover, 40 to 250Hz in 10Hz steps
+    int8_t gain_db;         // Harmonic level, -12 to +12dB
+} vbass_config_t;
+
+// Out of range values are clamped, and the cutoff rounded to a step
+void vbass_set_config(const vbass_config_t *config);
+void vbass_get_config(vbass_config_t *config);
+bool vbass_enabled();
+// For SETTING_VBASS
+int32_t vbass_config_to_setting(const vbass_config_t *config);
+void vbass_config_from_setting(int32_t value, vbass_config_t *config);
+
+// In place on stereo frames, after the volume
+void vbass_process(int16_t *samples, size_t frames);
+// Low band envelope, in sample units
+int32_t vbass_envelope();
+// Cycles for one millisecond of audio
+uint32_t vbass_bench();
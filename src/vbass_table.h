@@ -0,0 +1,35 @@
+// Generated by generate-vbass.py, do not edit
+#pragma once
+#include <stdint.h>
+
+// State variable filter coefficients, Q15, for crossovers from 40Hz to 250Hz
+// in 10Hz steps, and one pole coefficients for the harmonic high pass at half of each
+static const uint32_t VBASS_CUTOFF_MIN = 40;
+static const uint32_t VBASS_CUTOFF_MAX = 250;
+static const uint32_t VBASS_CUTOFF_STEP = 10;
+static const int16_t vbass_crossover_f[22] = {
+    172, 214, 257, 300, 343, 386, 429, 472, 515, 558, 600, 643, 686, 729, 772, 815, 858, 901, 944, 987, 1029, 1072
+};
+static const int16_t vbass_harmonic_k[22] = {
+    86, 107, 128, 150, 171, 192, 214, 235, 256, 278, 299, 320, 341, 363, 384, 405, 426, 447, 468, 490, 511, 532
+};
+
+// Half the damping of the low pass sections and the high pass, Q15
+static const int32_t vbass_lowpass_damping[2] = {30274, 12540};
+static const int32_t VBASS_HIGHPASS_DAMPING = 23170;
+static const uint32_t VBASS_HEADROOM_BITS = 2;
+
+// Envelope peak hold in calls, then a 50ms release, Q15
+static const uint32_t VBASS_HOLD_BLOCKS = 32;
+static const int32_t VBASS_K_RELEASE = 14;
+
+// 2nd, 3rd and 4th harmonic weights, Q15
+static const int32_t vbass_weights[3] = {19661, 13107, 6554};
+
+// Harmonic level from -12dB to 12dB, Q12
+static const int32_t VBASS_GAIN_MIN = -12;
+static const int32_t VBASS_GAIN_MAX = 12;
+static const uint32_t VBASS_GAIN_BITS = 12;
+static const int16_t vbass_gains[25] = {
+    1029, 1154, 1295, 1453, 1631, 1830, 2053, 2303, 2584, 2900, 3254, 3651, 4096, 4596, 5157, 5786, 6492, 7284, 8173, 9170, 10289, 11544, 12953, 14533, 16306
+};
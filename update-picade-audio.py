@@ -0,0 +1,63 @@
+import glob
+import struct
+import sys
+import time
+import zlib
+
+import serial
+
+# Usage: update-picade-audio.py firmware.uf2|firmware.bin
+# Streams a new firmware over the CDC serial port. The board keeps playing
+# while the image is staged, then installs it and reboots once it's verified.
+
+FLASH_BASE = 0x10000000
+PAGE_SIZE = 256
+UF2_MAGIC = (0x0A324655, 0x9E5D5157, 0x0AB16F30)
+
+
+def read_uf2(data):
+    pages = {}
+    for i in range(0, len(data), 512):
+        magic0, magic1, flags, address, size = struct.unpack_from("<IIIII", data, i)
+        magic_end, = struct.unpack_from("<I", data, i + 508)
+        if (magic0, magic1, magic_end) != UF2_MAGIC or flags & 1:
+            continue
+        pages[address - FLASH_BASE] = data[i + 32:i + 32 + size]
+    end = max(offset + len(page) for offset, page in pages.items())
+    image = bytearray(b"\xff" * end)
+    for offset, page in pages.items():
+        image[offset:offset + len(page)] = page
+    return bytes(image)
+
+
+path = sys.argv[1]
+with open(path, "rb") as f:
+    image = f.read()
+if path.endswith(".uf2"):
+    image = read_uf2(image)
+
+picade = glob.glob("/dev/serial/by-id/usb-Pimoroni_Picade_USB_Audio_*")[0]
+device = serial.Serial(picade, timeout=10)
+
+device.write(b"multiverse:_upd" + struct.pack("<II", len(image), zlib.crc32(image)))
+if device.read(1) != b"R":
+    raise SystemExit(f"board refused a {len(image)} byte image")
+
+padded = image + b"\xff" * (-len(image) % PAGE_SIZE)
+start = time.monotonic()
+for offset in range(0, len(padded), PAGE_SIZE):
+    device.write(padded[offset:offset + PAGE_SIZE])
+    response = device.read(1)
+    if response == b"F":
+        raise SystemExit(f"\nboard refused the image at offset {offset}, it can't erase while audio plays, retry when it's quiet")
+    if response != b"A":
+        raise SystemExit(f"no ack at offset {offset}")
+    print(f"\r{offset + PAGE_SIZE}/{len(padded)} bytes", end="", flush=True)
+elapsed = time.monotonic() - start
+print(f"\n{len(image) / 1024 / elapsed:.1f} KB/s")
+
+result = device.read(1)
+device.close()
+if result != b"V":
+    raise SystemExit("image failed verification, the board is still running the old firmware")
+print("verified, installing, the board will reboot")
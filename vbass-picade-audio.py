@@ -0,0 +1,23 @@
+import glob
+import struct
+import sys
+
+import serial
+
+# Usage: vbass-picade-audio.py on|off [CUTOFF_HZ [GAIN_DB]]
+# Turns the virtual bass on or off, with the crossover (40 to 250Hz, default
+# 150) and harmonic level (-12 to +12dB, default 0), then prints what the
+# board settled on. The setting is saved. See generate-vbass.py for what the
+# settings do to a tone.
+
+enabled = sys.argv[1] == "on"
+cutoff = int(sys.argv[2]) if len(sys.argv) > 2 else 150
+gain = int(sys.argv[3]) if len(sys.argv) > 3 else 0
+
+picade = glob.glob("/dev/serial/by-id/usb-Pimoroni_Picade_USB_Audio_*")[0]
+
+device = serial.Serial(picade, timeout=1)
+device.write(b"multiverse:_vbs" + struct.pack("<BbH", enabled, gain, cutoff))
+device.write(b"multiverse:_vbi")
+print(device.readline().decode().strip())
+device.close()